@@ -94,6 +94,14 @@ public class GMP : ModuleRules
 			}
 		}
 
+		// minimum inline callable bytes of each listener slot, 0 keeps the default
+		// below GMP_FUNCTION_PREDEFINED_INLINE_SIZE slots grow to fit their functor, otherwise bigger functors go to the heap
+		int SigElmInlineSize = 0;
+		if (SigElmInlineSize > 0)
+		{
+			PublicDefinitions.Add("GMP_SIGELM_INLINE_SIZE=" + SigElmInlineSize);
+		}
+
 		bool bEnableYamlExtensions = false;
 		if (bEnableYamlExtensions)
 		{
@@ -83,16 +83,22 @@ public:
 	static bool UnlistenMessage(const FString& MessageId, UObject* Listener, UGMPManager* Mgr = nullptr, UObject* Obj = nullptr);
 	UFUNCTION(BlueprintCallable, meta = (WorldContext = "Listener", BlueprintInternalUseOnly = true, AutoCreateRefTerm = "MessageId", AdvancedDisplay = "Mgr"))
 	static bool UnlistenMessageByKey(const FString& MessageId, UObject* Listener, UGMPManager* Mgr = nullptr);
+	UFUNCTION(BlueprintCallable, meta = (WorldContext = "Listener", BlueprintInternalUseOnly = true, AdvancedDisplay = "Mgr"))
+	static bool UnlistenMessageByName(FName MessageId, UObject* Listener, UGMPManager* Mgr = nullptr);
+
+	// stop the message being dispatched to lower order listeners, only valid inside a listener
+	UFUNCTION(BlueprintCallable, Category = "GMP|Message", meta = (CallableWithoutWorldContext, AdvancedDisplay = "Mgr"))
+	static bool ConsumeMessage(UGMPManager* Mgr = nullptr);
 
 	// Listen
-	UFUNCTION(BlueprintCallable, meta = (CallableWithoutWorldContext, BlueprintInternalUseOnly = true, Times = "-1", Order = "0", Type = "0", AutoCreateRefTerm = "WatchedObj"))
-	static FGMPTypedAddr ListenMessageByKey(FName MessageId, const FGMPScriptDelegate& Delegate, int32 Times, int32 Order, uint8 Type, UGMPManager* Mgr, const FGMPObjNamePair& WatchedObj);
-	UFUNCTION(BlueprintCallable, meta = (CallableWithoutWorldContext, BlueprintInternalUseOnly = true, Times = "-1", Order = "0", Type = "0", AutoCreateRefTerm = "WatchedObj"))
-	static FGMPTypedAddr ListenMessageByKeyValidate(const TArray<FName>& ArgNames, FName MessageId, const FGMPScriptDelegate& Delegate, int32 Times, int32 Order, uint8 Type, UGMPManager* Mgr, const FGMPObjNamePair& WatchedObj);
-	UFUNCTION(BlueprintCallable, meta = (CallableWithoutWorldContext, BlueprintInternalUseOnly = true, HidePin = "Listener", DefaultToSelf = "Listener", Times = "-1", Order = "0", Type = "0", AutoCreateRefTerm = "WatchedObj"))
-	static FGMPTypedAddr ListenMessageViaKey(UObject* Listener, FName MessageId, FName EventName, int32 Times, int32 Order, uint8 Type, uint8 BodyDataMask, UGMPManager* Mgr, const FGMPObjNamePair& WatchedObj);
-	UFUNCTION(BlueprintCallable, meta = (CallableWithoutWorldContext, BlueprintInternalUseOnly = true, HidePin = "Listener", DefaultToSelf = "Listener", Times = "-1", Order = "0", Type = "0", AutoCreateRefTerm = "WatchedObj"))
-	static FGMPTypedAddr ListenMessageViaKeyValidate(const TArray<FName>& ArgNames, UObject* Listener, FName MessageId, FName EventName, int32 Times, int32 Order, uint8 Type, uint8 BodyDataMask, UGMPManager* Mgr, const FGMPObjNamePair& WatchedObj);
+	UFUNCTION(BlueprintCallable, meta = (CallableWithoutWorldContext, BlueprintInternalUseOnly = true, Times = "-1", Order = "0", bObserveConsumed = "false", Type = "0", AutoCreateRefTerm = "WatchedObj"))
+	static FGMPTypedAddr ListenMessageByKey(FName MessageId, const FGMPScriptDelegate& Delegate, int32 Times, int32 Order, bool bObserveConsumed, uint8 Type, UGMPManager* Mgr, const FGMPObjNamePair& WatchedObj);
+	UFUNCTION(BlueprintCallable, meta = (CallableWithoutWorldContext, BlueprintInternalUseOnly = true, Times = "-1", Order = "0", bObserveConsumed = "false", Type = "0", AutoCreateRefTerm = "WatchedObj"))
+	static FGMPTypedAddr ListenMessageByKeyValidate(const TArray<FName>& ArgNames, FName MessageId, const FGMPScriptDelegate& Delegate, int32 Times, int32 Order, bool bObserveConsumed, uint8 Type, UGMPManager* Mgr, const FGMPObjNamePair& WatchedObj);
+	UFUNCTION(BlueprintCallable, meta = (CallableWithoutWorldContext, BlueprintInternalUseOnly = true, HidePin = "Listener", DefaultToSelf = "Listener", Times = "-1", Order = "0", bObserveConsumed = "false", Type = "0", AutoCreateRefTerm = "WatchedObj"))
+	static FGMPTypedAddr ListenMessageViaKey(UObject* Listener, FName MessageId, FName EventName, int32 Times, int32 Order, bool bObserveConsumed, uint8 Type, uint8 BodyDataMask, UGMPManager* Mgr, const FGMPObjNamePair& WatchedObj);
+	UFUNCTION(BlueprintCallable, meta = (CallableWithoutWorldContext, BlueprintInternalUseOnly = true, HidePin = "Listener", DefaultToSelf = "Listener", Times = "-1", Order = "0", bObserveConsumed = "false", Type = "0", AutoCreateRefTerm = "WatchedObj"))
+	static FGMPTypedAddr ListenMessageViaKeyValidate(const TArray<FName>& ArgNames, UObject* Listener, FName MessageId, FName EventName, int32 Times, int32 Order, bool bObserveConsumed, uint8 Type, uint8 BodyDataMask, UGMPManager* Mgr, const FGMPObjNamePair& WatchedObj);
 
 	// Notify
 	UFUNCTION(BlueprintCallable, meta = (CallableWithoutWorldContext, BlueprintInternalUseOnly = true, AutoCreateRefTerm = "Sender,Params,MessageId"))
@@ -110,6 +116,43 @@ public:
 	static void NotifyMessageByKeyVariadic(const FString& MessageId, const FGMPObjNamePair& Sender, uint8 Type = 0, UGMPManager* Mgr = nullptr);
 	DECLARE_FUNCTION(execNotifyMessageByKeyVariadic);
 
+	// key literals of K2 nodes are compiled as name constants, the thunk skips the string to key conversion
+	UFUNCTION(BlueprintCallable, CustomThunk, meta = (CallableWithoutWorldContext, BlueprintInternalUseOnly = true, AutoCreateRefTerm = "Sender", Variadic))
+	static bool NotifyMessageByNameVariadicRet(FName MessageId, const FGMPObjNamePair& Sender, uint8 Type = 0, UGMPManager* Mgr = nullptr);
+	DECLARE_FUNCTION(execNotifyMessageByNameVariadicRet);
+	UFUNCTION(BlueprintCallable, CustomThunk, meta = (CallableWithoutWorldContext, BlueprintInternalUseOnly = true, AutoCreateRefTerm = "Sender", Variadic))
+	static void NotifyMessageByNameVariadic(FName MessageId, const FGMPObjNamePair& Sender, uint8 Type = 0, UGMPManager* Mgr = nullptr);
+	DECLARE_FUNCTION(execNotifyMessageByNameVariadic);
+
+	// fixed arity sends picked by K2 nodes for up to 8 arguments, the count is known so the thunk never probes for the end of the list
+	UFUNCTION(BlueprintCallable, CustomThunk, meta = (CallableWithoutWorldContext, BlueprintInternalUseOnly = true, AutoCreateRefTerm = "Sender", Variadic))
+	static bool NotifyMessageByName0(FName MessageId, const FGMPObjNamePair& Sender, uint8 Type = 0, UGMPManager* Mgr = nullptr);
+	DECLARE_FUNCTION(execNotifyMessageByName0);
+	UFUNCTION(BlueprintCallable, CustomThunk, meta = (CallableWithoutWorldContext, BlueprintInternalUseOnly = true, AutoCreateRefTerm = "Sender", Variadic))
+	static bool NotifyMessageByName1(FName MessageId, const FGMPObjNamePair& Sender, uint8 Type = 0, UGMPManager* Mgr = nullptr);
+	DECLARE_FUNCTION(execNotifyMessageByName1);
+	UFUNCTION(BlueprintCallable, CustomThunk, meta = (CallableWithoutWorldContext, BlueprintInternalUseOnly = true, AutoCreateRefTerm = "Sender", Variadic))
+	static bool NotifyMessageByName2(FName MessageId, const FGMPObjNamePair& Sender, uint8 Type = 0, UGMPManager* Mgr = nullptr);
+	DECLARE_FUNCTION(execNotifyMessageByName2);
+	UFUNCTION(BlueprintCallable, CustomThunk, meta = (CallableWithoutWorldContext, BlueprintInternalUseOnly = true, AutoCreateRefTerm = "Sender", Variadic))
+	static bool NotifyMessageByName3(FName MessageId, const FGMPObjNamePair& Sender, uint8 Type = 0, UGMPManager* Mgr = nullptr);
+	DECLARE_FUNCTION(execNotifyMessageByName3);
+	UFUNCTION(BlueprintCallable, CustomThunk, meta = (CallableWithoutWorldContext, BlueprintInternalUseOnly = true, AutoCreateRefTerm = "Sender", Variadic))
+	static bool NotifyMessageByName4(FName MessageId, const FGMPObjNamePair& Sender, uint8 Type = 0, UGMPManager* Mgr = nullptr);
+	DECLARE_FUNCTION(execNotifyMessageByName4);
+	UFUNCTION(BlueprintCallable, CustomThunk, meta = (CallableWithoutWorldContext, BlueprintInternalUseOnly = true, AutoCreateRefTerm = "Sender", Variadic))
+	static bool NotifyMessageByName5(FName MessageId, const FGMPObjNamePair& Sender, uint8 Type = 0, UGMPManager* Mgr = nullptr);
+	DECLARE_FUNCTION(execNotifyMessageByName5);
+	UFUNCTION(BlueprintCallable, CustomThunk, meta = (CallableWithoutWorldContext, BlueprintInternalUseOnly = true, AutoCreateRefTerm = "Sender", Variadic))
+	static bool NotifyMessageByName6(FName MessageId, const FGMPObjNamePair& Sender, uint8 Type = 0, UGMPManager* Mgr = nullptr);
+	DECLARE_FUNCTION(execNotifyMessageByName6);
+	UFUNCTION(BlueprintCallable, CustomThunk, meta = (CallableWithoutWorldContext, BlueprintInternalUseOnly = true, AutoCreateRefTerm = "Sender", Variadic))
+	static bool NotifyMessageByName7(FName MessageId, const FGMPObjNamePair& Sender, uint8 Type = 0, UGMPManager* Mgr = nullptr);
+	DECLARE_FUNCTION(execNotifyMessageByName7);
+	UFUNCTION(BlueprintCallable, CustomThunk, meta = (CallableWithoutWorldContext, BlueprintInternalUseOnly = true, AutoCreateRefTerm = "Sender", Variadic))
+	static bool NotifyMessageByName8(FName MessageId, const FGMPObjNamePair& Sender, uint8 Type = 0, UGMPManager* Mgr = nullptr);
+	DECLARE_FUNCTION(execNotifyMessageByName8);
+
 	// RequestMessage
 	UFUNCTION(BlueprintCallable, meta = (CallableWithoutWorldContext, BlueprintInternalUseOnly = true, HidePin = "Sender", DefaultToSelf = "Sender", AutoCreateRefTerm = "Params,MessageId"))
 	static bool RequestMessageRet(FGMPKey& RspKey, FName EventName, const FString& MessageId, const FGMPObjNamePair& Sender, UPARAM(ref) TArray<FGMPTypedAddr>& Params, uint8 Type = 0, UGMPManager* Mgr = nullptr);
@@ -126,6 +169,13 @@ public:
 	static void RequestMessageVariadic(FGMPKey& RspKey, FName EventName, const FString& MessageId, const FGMPObjNamePair& Sender, uint8 Type = 0, UGMPManager* Mgr = nullptr);
 	DECLARE_FUNCTION(execRequestMessageVariadic);
 
+	UFUNCTION(BlueprintCallable, CustomThunk, meta = (CallableWithoutWorldContext, BlueprintInternalUseOnly = true, HidePin = "Sender", DefaultToSelf = "Sender", Variadic))
+	static bool RequestMessageByNameVariadicRet(FGMPKey& RspKey, FName EventName, FName MessageId, const FGMPObjNamePair& Sender, uint8 Type = 0, UGMPManager* Mgr = nullptr);
+	DECLARE_FUNCTION(execRequestMessageByNameVariadicRet);
+	UFUNCTION(BlueprintCallable, CustomThunk, meta = (CallableWithoutWorldContext, BlueprintInternalUseOnly = true, HidePin = "Sender", DefaultToSelf = "Sender", Variadic))
+	static void RequestMessageByNameVariadic(FGMPKey& RspKey, FName EventName, FName MessageId, const FGMPObjNamePair& Sender, uint8 Type = 0, UGMPManager* Mgr = nullptr);
+	DECLARE_FUNCTION(execRequestMessageByNameVariadic);
+
 	// ResponseMessage
 	UFUNCTION(BlueprintCallable, meta = (CallableWithoutWorldContext, BlueprintInternalUseOnly = true, HidePin = "SigSource", DefaultToSelf = "SigSource", AutoCreateRefTerm = "Params,MessageId"))
 	static void ResponseMessage(FGMPKey SeqId, UPARAM(ref) TArray<FGMPTypedAddr>& Params, UObject* SigSource, UGMPManager* Mgr = nullptr);
@@ -8,6 +8,7 @@
 
 #include "Containers/EnumAsByte.h"
 #include "Engine/UserDefinedEnum.h"
+#include "GMPTypeId.h"
 #include "GMPTypeTraits.h"
 #include "HAL/PlatformAtomics.h"
 #include "Misc/AssertionMacros.h"
@@ -94,11 +95,11 @@ struct GMP_API FNameSuccession
 	static FName FindCommonBase(FName lhs, FName rhs);
 
 	static constexpr decltype(auto) ObjectPtrFormatStr() { return NAME_GMP_TObjectPtr TEXT("<%s>"); }
-	static FName FormatObjectPtr(UClass* InClass) { return *FString::Printf(ObjectPtrFormatStr(), *GetClassName(InClass).ToString()); }
+	static FName FormatObjectPtr(UClass* InClass) { return TypeId::ComposeName(TypeId::EKind::ObjectPtr, GetClassName(InClass)); }
 	template<typename T>
 	static FName FormatObjectPtr()
 	{
-		return *FString::Printf(ObjectPtrFormatStr(), *NameUtils::GetFName(TUnwrapObjectPtrType<T>::StaticClass()).ToString());
+		return TypeId::ComposeName(TypeId::EKind::ObjectPtr, NameUtils::GetFName(TUnwrapObjectPtrType<T>::StaticClass()));
 	}
 };
 
@@ -365,7 +366,7 @@ namespace Class2Name
 		{
 			dispatch_value = 2,
 		};
-		static FName GetFName(UClass* MetaClass) { return *FString::Printf(TEXT("TSubClassOf<%s>"), MetaClass->IsNative() ? *NameUtils::GetFName(MetaClass).ToString() : *FSoftClassPath(MetaClass).ToString()); }
+		static FName GetFName(UClass* MetaClass) { return TypeId::ComposeName(TypeId::EKind::SubclassOf, MetaClass->IsNative() ? NameUtils::GetFName(MetaClass) : FName(*FSoftClassPath(MetaClass).ToString())); }
 	};
 
 	// UObject
@@ -593,6 +594,12 @@ namespace Class2Name
 		static FName GetTMapName(const TCHAR* InnerKey, const TCHAR* InnerValue) { return *FString::Printf(TEXT("TMap<%s,%s>"), InnerKey, InnerValue); }
 		static FName GetTSetName(const TCHAR* Inner) { return *FString::Printf(TEXT("TSet<%s>"), Inner); }
 		static FName GetTOptionalName(const TCHAR* Inner) { return *FString::Printf(TEXT("TOptional<%s>"), Inner); }
+
+		// structural, formatted once per inner type
+		static FName GetTArrayName(FName Inner) { return TypeId::ComposeName(TypeId::EKind::Array, Inner); }
+		static FName GetTMapName(FName InnerKey, FName InnerValue) { return TypeId::ComposeName(TypeId::EKind::Map, InnerKey, InnerValue); }
+		static FName GetTSetName(FName Inner) { return TypeId::ComposeName(TypeId::EKind::Set, Inner); }
+		static FName GetTOptionalName(FName Inner) { return TypeId::ComposeName(TypeId::EKind::Optional, Inner); }
 	};
 
 	template<typename T, bool bExactType>
@@ -676,7 +683,7 @@ namespace Class2Name
 		static_assert(!TTraitsTemplate<T, bExactType>::nested, "not support nested container");
 		static auto GetFName()
 		{
-			static auto Ret = TTraitsTemplateBase::GetTOptionalName(*TClass2NameImpl<T, bExactType>::GetFName().ToString());
+			static auto Ret = TTraitsTemplateBase::GetTOptionalName(TClass2NameImpl<T, bExactType>::GetFName());
 			return Ret;
 		}
 	};
@@ -975,14 +982,14 @@ namespace Class2Name
 	auto TTraitsTemplate<TSet<InElementType, KeyFunc, InAllocator>, bExactType>::GetFName()
 	{
 		using ElementType = InElementType;
-		return TTraitsTemplateBase::GetTSetName(*TClass2NameImpl<ElementType, bExactType>::GetFName().ToString());
+		return TTraitsTemplateBase::GetTSetName(TClass2NameImpl<ElementType, bExactType>::GetFName());
 	}
 
 	template<typename InElementType, typename InAllocator, bool bExactType>
 	auto TTraitsTemplate<TArray<InElementType, InAllocator>, bExactType>::GetFName()
 	{
 		using ElementType = InElementType;
-		return TTraitsTemplateBase::GetTArrayName(*TClass2NameImpl<ElementType, bExactType>::GetFName().ToString());
+		return TTraitsTemplateBase::GetTArrayName(TClass2NameImpl<ElementType, bExactType>::GetFName());
 	}
 
 	template<typename InKeyType, typename InValueType, typename SetAllocator, typename KeyFuncs, bool bExactType>
@@ -990,7 +997,7 @@ namespace Class2Name
 	{
 		using KeyType = InKeyType;
 		using ValueType = InValueType;
-		return TTraitsTemplateBase::GetTMapName(*TClass2NameImpl<KeyType, bExactType>::GetFName().ToString(), *TClass2NameImpl<ValueType, bExactType>::GetFName().ToString());
+		return TTraitsTemplateBase::GetTMapName(TClass2NameImpl<KeyType, bExactType>::GetFName(), TClass2NameImpl<ValueType, bExactType>::GetFName());
 	}
 
 	template<typename T, bool bExactType>
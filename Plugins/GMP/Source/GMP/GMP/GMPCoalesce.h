@@ -0,0 +1,39 @@
+//  Copyright GenericMessagePlugin, Inc. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+
+#include "GMPClass2Prop.h"
+#include "GMPUtils.h"
+
+namespace GMP
+{
+enum class ECoalescedFlushPoint : uint8
+{
+	EndOfFrame,
+	BeginOfFrame,
+	Manual,
+};
+
+// latest-value-wins delivery for high frequency state messages
+// notifies of a coalesced key overwrite one pending payload per (key, source) and listeners receive it once at the flush point
+class GMP_API FCoalescedMessageUtils
+{
+public:
+	template<typename... TArgs>
+	FORCEINLINE static bool EnableCoalescing(const MSGKEY_TYPE& K, ECoalescedFlushPoint FlushPoint = ECoalescedFlushPoint::EndOfFrame)
+	{
+		using MyTraits = Class2Prop::TPropertiesTraits<std::decay_t<TArgs>...>;
+		return EnableCoalescing(K, MyTraits::GetProperties(), FlushPoint);
+	}
+	static bool EnableCoalescing(const FName& MessageKey, const TArray<FProperty*>& Props, ECoalescedFlushPoint FlushPoint = ECoalescedFlushPoint::EndOfFrame);
+	static void DisableCoalescing(const FName& MessageKey);
+	static bool IsCoalesced(const FName& MessageKey);
+
+	// deliver pending payloads now, NAME_None flushes every key
+	static int32 FlushCoalesced(const FName& MessageKey = NAME_None);
+
+	// broadcast after each flush, used by UGMPRpcProxy to send collapsed rpcs together
+	static FSimpleMulticastDelegate& OnCoalescedFlushed();
+};
+}  // namespace GMP
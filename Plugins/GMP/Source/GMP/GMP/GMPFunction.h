@@ -401,6 +401,13 @@ public:
 
 	void Reset() { Storage.Reset(); }
 
+	// bytes of the functor stored outside the inline buffer
+	SIZE_T GetHeapAllocatedSize() const
+	{
+		auto HeapPtr = Storage.GetHeapAllocation();
+		return HeapPtr ? FMemory::GetAllocSize(HeapPtr) : 0;
+	}
+
 protected:
 	static constexpr auto ActualAlignVal = (!GMP_FUNCTION_DEBUGVIEW && (alignof(Base) < FStorageEraseBase::kAlignSize || sizeof(Base) % FStorageEraseBase::kAlignSize == 0)) ? 1 : FStorageEraseBase::kAlignSize;
 	using FStorageType = TStorageErase<INLINE_SIZE, ActualAlignVal>;
@@ -425,6 +432,27 @@ protected:
 		}
 	}
 
+	// for owners allocated with InSize bytes from the inline buffer on, the functor never goes to the heap
+	template<typename Functor, GMP_SFINAE_DISABLE_FUNCTIONREF(Functor)>
+	void BindInline(Functor&& InFunc, uint32_t InSize)
+	{
+		using DecayedFunctor = std::decay_t<Functor>;
+		using FunctorType = TTypedObject<DecayedFunctor>;
+		using TFuncType = typename UnrealCompatibility::TFunctionTraits<DecayedFunctor>::TFuncType;
+		GMP_CHECK(!Storage.Callable && InSize >= sizeof(FunctorType));
+
+		void* NewAlloc = Storage.GetInlineAllocation();
+		Storage.SetInlineAllocation(NewAlloc, InSize);
+		auto* NewOwned = new (NewAlloc) FunctorType(std::forward<Functor>(InFunc));
+		Storage.Callable = (void*)&TFunctorInvoker<DecayedFunctor, TFuncType>::StaticCall;
+		GMP_DEBUGVIEW_LOG(TEXT("TAttachedCallableStore::BindInline() ErasedObj %p"), &NewOwned->Obj);
+
+#if GMP_FUNCTION_DEBUGVIEW
+		new ((void*)&DebugViewStorage) TDebugView<DecayedFunctor>;
+		DebugViewStorage.Ptr = (void*)&NewOwned->Obj;
+#endif
+	}
+
 	template<typename B, int32_t S>
 	void Move(TAttachedCallableStore<B, S>&& Other, uint32_t InSize = INLINE_SIZE)
 	{
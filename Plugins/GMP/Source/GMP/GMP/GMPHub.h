@@ -308,13 +308,21 @@ namespace Hub
 }  // namespace Hub
 
 class FMessageUtils;
+namespace Hub
+{
+	class FCoalescedChannels;
+}
 class GMP_API FMessageHub
 {
 public:
 	friend class FMessageUtils;
 	friend struct FGMPResponder;
+	friend class FCoalescedMessageUtils;
+	friend class Hub::FCoalescedChannels;
 
 	FMessageBody* GetCurrentMessageBody() const;
+	// innermost hub dispatching on the game thread, null outside of listeners
+	static FMessageHub* GetDispatchingHub();
 	struct GMP_API FTagTypeSetter
 	{
 		FTagTypeSetter(const TCHAR* Type);
@@ -385,10 +393,23 @@ private:
 	void UnbindMessageImpl(const FName& MessageKey, const UObject* Listener, FSigSource InSigSrc);
 	// Notify
 	FGMPKey NotifyMessageImpl(FSignalBase* Ptr, const FName& MessageKey, FSigSource InSigSrc, FTypedAddresses& Param);
+	FGMPKey FireMessageImpl(FSignalBase* Ptr, const FName& MessageKey, FSigSource InSigSrc, FTypedAddresses& Param);
 	// Request
 	FGMPKey RequestMessageImpl(FSignalBase* Ptr, const FName& MessageKey, FSigSource InSigSrc, FTypedAddresses& Param, FResponseSig&& Sig, const FArrayTypeNames* RspTypes = nullptr);
 	// Respone
 	void ResponseMessageImpl(FGMPKey RequestSequence, FTypedAddresses& Param, const FArrayTypeNames* RspTypes = nullptr, FSigSource InSigSrc = FSigSource::NullSigSrc);
+	// Coalesce
+	Hub::FCoalescedChannels& GetCoalescedChannels();
+	FGMPKey FireCoalescedMessage(const FName& MessageKey, FSigSource InSigSrc, FTypedAddresses& Param);
+	// a world hub only holds listeners with a source, the ones without live on AnySourceHub
+	FORCEINLINE FSignalBase* FindSendSig(const FName& MessageKey)
+	{
+		auto Ptr = FindSig(MessageSignals, MessageKey);
+		return (Ptr || !AnySourceHub) ? Ptr : FindSig(AnySourceHub->MessageSignals, MessageKey);
+	}
+	FORCEINLINE bool HasCallbackMark(const FName& MessageKey) const { return CallbackMarks.Contains(MessageKey) || (AnySourceHub && AnySourceHub->CallbackMarks.Contains(MessageKey)); }
+	// after the slots of this hub, consumed messages only reach the slots observing them
+	void FireAnySourceListeners(FSignalBase* Ptr, const FName& MessageKey, FSigSource InSigSrc, FMessageBody& Msg);
 
 private:
 	//////////////////////////////////////////////////////////////////////////
@@ -429,7 +450,7 @@ public:
 #endif
 		TraceMessageKey(MessageKey, InSigSrc);
 
-		auto Ptr = FindSig(MessageSignals, MessageKey);
+		auto Ptr = FindSendSig(MessageKey);
 		GMP_IF_CONSTEXPR(SendTraits::bIsSingleShot)
 		{
 			if (!ensure(Ptr))
@@ -500,6 +521,9 @@ public:
 	FGMPKey IsAlive(const FName& MessageId, const UObject* Listener, FSigSource InSigSrc = FSigSource::NullSigSrc) const;
 	bool IsValidHub() const;
 	bool IsResponseOn(FGMPKey Key) const;
+	bool IsCoalesced(const FName& MessageId) const;
+	// responses are shared by all hubs, only one of them should report them
+	void CollectMemory(struct FGMPMemoryReport& Report, bool bWithResponses = true) const;
 
 	static const TCHAR* GetNativeTagType();
 	static const TCHAR* GetScriptTagType();
@@ -528,7 +552,7 @@ public:
 #endif
 		TraceMessageKey(MessageKey, InSigSrc);
 
-		if (auto Ptr = FindSig(MessageSignals, MessageKey))
+		if (auto Ptr = FindSendSig(MessageKey))
 		{
 			FTypedAddresses Arr{FGMPTypedAddr::MakeMsg(Args)...};
 
@@ -620,7 +644,7 @@ public:  // for script binding
 			return false;
 
 		TraceMessageKey(MessageKey, InSigSrc);
-		if (auto Ptr = FindSig(MessageSignals, MessageKey))
+		if (auto Ptr = FindSendSig(MessageKey))
 		{
 			return !!NotifyMessageImpl(Ptr, MessageKey, InSigSrc, Param);
 		}
@@ -636,7 +660,7 @@ public:  // for script binding
 			return {};
 		TraceMessageKey(MessageKey, InSigSrc);
 
-		if (auto Ptr = FindSig(MessageSignals, MessageKey))
+		if (auto Ptr = FindSendSig(MessageKey))
 		{
 			return SendObjectMessageImpl(Ptr, MessageKey, InSigSrc, Param, std::move(OnRsp));
 		}
@@ -668,8 +692,11 @@ public:
 
 private:
 	FGMPSignalMap MessageSignals;
+	// set on world hubs, the global hub whose listeners without a source hear this hub too
+	FMessageHub* AnySourceHub = nullptr;
 
 	TSet<FName> CallbackMarks;
+	TUniquePtr<Hub::FCoalescedChannels> CoalescedChannels;
 	void PushMsgBody(FMessageBody* Body);
 	FMessageBody* PopMsgBody();
 	TArray<FMessageBody*, TInlineAllocator<8>> MessageBodyStack;
@@ -728,6 +755,9 @@ public:
 	auto& GetHub() { return MessageHub; }
 	auto& GetHub() const { return MessageHub; }
 
+	virtual void Serialize(FArchive& Ar) override;
+	virtual void GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize) override;
+
 protected:
 	GMP::FMessageHub MessageHub;
 };
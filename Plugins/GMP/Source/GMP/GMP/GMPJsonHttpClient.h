@@ -0,0 +1,154 @@
+//  Copyright GenericMessagePlugin, Inc. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+
+#include "GMPJsonSerializer.h"
+#include "Templates/SharedPointer.h"
+
+#include <atomic>
+
+namespace GMP
+{
+namespace Json
+{
+namespace Http
+{
+	struct FRequest
+	{
+		FString Url;
+		FString Verb;
+		TMap<FString, FString> Headers;
+		// json body, serialized in place and moved into the transport
+		TArray<uint8> Content;
+		float TimeoutSecs = 0.f;
+	};
+
+	struct FResponse
+	{
+		int32 Code = 0;
+		bool bConnected = false;
+		// body of transports that produce it themselves
+		TArray<uint8> Content;
+		// or the http response the body is read from without a copy
+		TSharedPtr<IHttpResponse, ESPMode::ThreadSafe> HttpResponse;
+	};
+
+	using FOnTransportDone = TUniqueFunction<void(FResponse&&)>;
+
+	// moves one request to a server, OnDone is called exactly once and from any thread
+	class GMP_API ITransport
+	{
+	public:
+		virtual ~ITransport() = default;
+		// false when the request could not be started, OnDone is still called
+		virtual bool Send(FRequest&& Req, FOnTransportDone&& OnDone) = 0;
+	};
+	using FTransportRef = TSharedRef<ITransport, ESPMode::ThreadSafe>;
+
+	// FHttpModule backed transport
+	GMP_API FTransportRef MakeHttpModuleTransport();
+
+	// in-process server for tests and benchmarks, the handler fills the response from a background task
+	class GMP_API FLoopbackTransport final : public ITransport
+	{
+	public:
+		using FHandler = TFunction<void(const FRequest&, FResponse&)>;
+		explicit FLoopbackTransport(FHandler InHandler, bool bInAsync = true);
+
+		virtual bool Send(FRequest&& Req, FOnTransportDone&& OnDone) override;
+		int32 GetNumSent() const { return NumSent.load(); }
+
+	private:
+		TSharedRef<FHandler, ESPMode::ThreadSafe> Handler;
+		std::atomic<int32> NumSent{0};
+		bool bAsync;
+	};
+
+	struct FClientSettings
+	{
+		// requests in flight per host, extra requests wait in order, 0 to use gmp.http.maxperhost
+		int32 MaxConcurrentPerHost = 0;
+		// parse responses on a worker when the response type holds no object references
+		bool bDecodeOnWorker = true;
+	};
+
+	// RspData is null on failure, it only lives during the callback
+	using FOnResponse = TFunction<void(bool bSucc, int32 Code, const uint8* RspData)>;
+
+	// json http client with a per host request pool, responses are delivered on the game thread
+	class GMP_API FJsonHttpClient : public TSharedFromThis<FJsonHttpClient, ESPMode::ThreadSafe>
+	{
+	public:
+		static TSharedRef<FJsonHttpClient, ESPMode::ThreadSafe> Create(FTransportRef InTransport, const FClientSettings& InSettings = {});
+		static FJsonHttpClient& Default();
+
+		// the body is encoded on the calling thread with its json formatter scopes, GET when BodyData is null
+		// false when the transport could not start the request, queued requests return true
+		bool Request(const FString& Url, const TMap<FString, FString>& Headers, float TimeoutSecs, FProperty* BodyProp, const uint8* BodyData, FProperty* RspProp, FOnResponse OnRsp);
+
+		template<typename TReq, typename TRsp>
+		bool Post(const FString& Url, const TReq& Req, TFunction<void(bool, int32, const TRsp&)> OnRsp, const TMap<FString, FString>& Headers = {}, float TimeoutSecs = 0.f)
+		{
+			return Request(Url, Headers, TimeoutSecs, TClass2Prop<TReq>::GetProperty(), (const uint8*)std::addressof(Req), TClass2Prop<TRsp>::GetProperty(), [OnRsp{MoveTemp(OnRsp)}](bool bSucc, int32 Code, const uint8* RspData) {
+				if (RspData)
+					OnRsp(bSucc, Code, *reinterpret_cast<const TRsp*>(RspData));
+				else
+					OnRsp(false, Code, TRsp{});
+			});
+		}
+		template<typename TRsp>
+		bool Get(const FString& Url, TFunction<void(bool, int32, const TRsp&)> OnRsp, const TMap<FString, FString>& Headers = {}, float TimeoutSecs = 0.f)
+		{
+			return Request(Url, Headers, TimeoutSecs, nullptr, nullptr, TClass2Prop<TRsp>::GetProperty(), [OnRsp{MoveTemp(OnRsp)}](bool bSucc, int32 Code, const uint8* RspData) {
+				if (RspData)
+					OnRsp(bSucc, Code, *reinterpret_cast<const TRsp*>(RspData));
+				else
+					OnRsp(false, Code, TRsp{});
+			});
+		}
+
+		int32 GetNumInFlight(const FString& Host) const;
+		int32 GetNumQueued(const FString& Host) const;
+		// responses parsed off the game thread so far
+		int32 GetNumDecodedOnWorker() const { return NumDecodedOnWorker.load(); }
+
+		FJsonHttpClient(FTransportRef InTransport, const FClientSettings& InSettings);
+
+	private:
+		// blueprint structs reachable from the response type, they may be recompiled or collected while the request is out
+		struct FLayoutGuard
+		{
+			TArray<TWeakObjectPtr<const UStruct>> Structs;
+			uint32 Epoch = 0;
+
+			bool IsNative() const { return Structs.Num() == 0; }
+			bool IsValid() const;
+		};
+		struct FPending
+		{
+			FRequest Req;
+			FProperty* RspProp = nullptr;
+			FLayoutGuard Layout;
+			FOnResponse OnRsp;
+			bool bDecodeOnWorker = false;
+		};
+		struct FHostPool
+		{
+			int32 InFlight = 0;
+			TArray<TUniquePtr<FPending>> Queue;
+		};
+
+		bool Dispatch(const FString& Host, TUniquePtr<FPending> Pending);
+		void OnTransportDone(const FString& Host, TUniquePtr<FPending> Pending, FResponse&& Rsp);
+		int32 GetMaxPerHost() const;
+
+		FTransportRef Transport;
+		FClientSettings Settings;
+		mutable FCriticalSection Lock;
+		TMap<FString, FHostPool> Hosts;
+		std::atomic<int32> NumDecodedOnWorker{0};
+	};
+}  // namespace Http
+}  // namespace Json
+}  // namespace GMP
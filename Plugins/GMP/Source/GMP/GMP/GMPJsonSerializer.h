@@ -283,6 +283,181 @@ namespace Json
 
 			static const bool GetType();
 		};
+
+		struct FJsonValidationError
+		{
+			// json pointer of the offending value, empty for the document itself
+			FString Pointer;
+			FString Message;
+		};
+
+		struct FJsonSchemaOptions
+		{
+			// keys without a matching property are errors
+			bool bRejectUnknown = true;
+			// every field is required, otherwise only fields with JsonRequired metadata or SetRequired
+			bool bRequireAll = false;
+			// null leaves the field untouched like the plain reader does
+			bool bAllowNull = true;
+			int32 MaxErrors = 32;
+		};
+
+		enum class EJsonKind : uint8
+		{
+			Null = 1 << 0,
+			Bool = 1 << 1,
+			Number = 1 << 2,
+			String = 1 << 3,
+			Array = 1 << 4,
+			Object = 1 << 5,
+			Any = Null | Bool | Number | String | Array | Object,
+		};
+		ENUM_CLASS_FLAGS(EJsonKind)
+
+		struct FJsonFieldRule
+		{
+			// key as the writer emits it with the compiled case options
+			FName JsonName;
+			EJsonKind Accepts = EJsonKind::Any;
+			bool bIntegral = false;
+			bool bHasMin = false;
+			bool bHasMax = false;
+			int32 RequiredSlot = INDEX_NONE;
+			// range of the integer type, exact where a double can not hold the 64 bit bounds
+			int64 IntMin = MIN_int64;
+			uint64 IntMax = MAX_uint64;
+			double Min = 0.0;
+			double Max = 0.0;
+			UEnum* Enum = nullptr;
+		};
+
+		struct FJsonStructRules
+		{
+			const UStruct* Struct = nullptr;
+			int32 NumRequired = 0;
+			TArray<const FProperty*, TInlineAllocator<4>> Required;
+		};
+
+		// a struct compiled once with the numeric and case formatters of the calling thread
+		// rules are checked by the regular reader while it deserializes, so the payload is parsed once
+		class GMP_API FJsonSchemaProgram
+		{
+		public:
+			static TSharedRef<FJsonSchemaProgram, ESPMode::ThreadSafe> Compile(UStruct* Struct, const FJsonSchemaOptions& Options = {});
+
+			// overrides for builds without metadata, FieldName is the property name inside Owner
+			bool SetRequired(const UStruct* Owner, FName FieldName);
+			bool SetRange(const UStruct* Owner, FName FieldName, TOptional<double> Min, TOptional<double> Max);
+
+			UStruct* GetStruct() const { return Root; }
+			const FJsonSchemaOptions& GetOptions() const { return Options; }
+
+			const FJsonFieldRule* FindRule(const FProperty* Prop) const { return Rules.Find(Prop); }
+			const FJsonStructRules* FindStruct(const UStruct* Struct) const
+			{
+				auto Idx = StructIndices.Find(Struct);
+				return Idx ? &Structs[*Idx] : nullptr;
+			}
+
+		protected:
+			void CompileStruct(const UStruct* Struct);
+			void CompileProp(FProperty* Prop, FJsonStructRules* Owner, bool bUserDefined);
+
+			UStruct* Root = nullptr;
+			FJsonSchemaOptions Options;
+			Serializer::FNumericFormatter::ENumericFmt NumericFmt = Serializer::FNumericFormatter::Default;
+			bool bConvertCase = false;
+
+			TArray<FJsonStructRules> Structs;
+			TMap<const UStruct*, int32> StructIndices;
+			TMap<const FProperty*, FJsonFieldRule> Rules;
+		};
+
+		// routes rule checks of the reader on this thread into OutErrors while alive
+		class GMP_API FJsonValidateScope : public FNoncopyable
+		{
+		public:
+			FJsonValidateScope(const FJsonSchemaProgram& InProgram, TArray<FJsonValidationError>& InErrors);
+			~FJsonValidateScope();
+
+			static FJsonValidateScope* Current();
+
+			const FJsonFieldRule* FindRule(const FProperty* Prop) const { return Program.FindRule(Prop); }
+			const FJsonStructRules* FindStruct(const UStruct* Struct) const { return Program.FindStruct(Struct); }
+			bool IsRoot() const { return Path.Num() == 0; }
+
+			// false means the value is rejected and must not be assigned
+			bool CheckKind(const FJsonFieldRule& Rule, EJsonKind Kind);
+			bool CheckNumber(const FJsonFieldRule& Rule, double Val);
+			bool CheckNumber(const FJsonFieldRule& Rule, int64 Val);
+			bool CheckNumber(const FJsonFieldRule& Rule, uint64 Val);
+			bool CheckString(const FJsonFieldRule& Rule, const StringView& Val);
+
+			struct FStructState
+			{
+				const FJsonStructRules* Rules = nullptr;
+				TBitArray<TInlineAllocator<1>> Seen;
+			};
+			void BeginStruct(const UStruct* Struct, FStructState& State);
+			void MarkField(FStructState& State, const FProperty* Prop);
+			void EndStruct(FStructState& State);
+			void UnknownField(const StringView& Key);
+
+			void PushName(FName Name) { Path.Add(FSegment{Name, INDEX_NONE, {}}); }
+			void PushKey(const StringView& Key) { Path.Add(FSegment{NAME_None, INDEX_NONE, Key}); }
+			void PushIndex(int32 Index) { Path.Add(FSegment{NAME_None, Index, {}}); }
+			void Pop() { Path.Pop(EAllowShrinking::No); }
+
+			void Report(const FString& Message, FName Leaf = NAME_None);
+
+		protected:
+			struct FSegment
+			{
+				FName Name;
+				int32 Index;
+				// only valid while the reader is inside the key
+				StringView Key;
+			};
+			FString BuildPointer(FName Leaf) const;
+			template<typename T>
+			bool CheckBounds(const FJsonFieldRule& Rule, T Val);
+
+			const FJsonSchemaProgram& Program;
+			TArray<FJsonValidationError>& Errors;
+			int32 ErrorsBase = 0;
+			TArray<FSegment, TInlineAllocator<16>> Path;
+			FJsonValidateScope* Outer = nullptr;
+		};
+
+		struct FJsonPathGuard
+		{
+			FJsonPathGuard(FJsonValidateScope* InScope, int32 Index)
+				: Scope(InScope)
+			{
+				if (Scope)
+					Scope->PushIndex(Index);
+			}
+			FJsonPathGuard(FJsonValidateScope* InScope, const StringView& Key)
+				: Scope(InScope)
+			{
+				if (Scope)
+					Scope->PushKey(Key);
+			}
+			FJsonPathGuard(FJsonValidateScope* InScope, FName Name)
+				: Scope(InScope)
+			{
+				if (Scope)
+					Scope->PushName(Name);
+			}
+			~FJsonPathGuard()
+			{
+				if (Scope)
+					Scope->Pop();
+			}
+
+		protected:
+			FJsonValidateScope* Scope;
+		};
 	}  // namespace Deserializer
 
 	GMP_API bool PropFromJsonImpl(FArchive& Ar, FProperty* Prop, void* ContainerAddr);
@@ -338,6 +513,31 @@ namespace Json
 		return Reader && UStructFromJson(*Reader, TypeTraits::StaticStruct<DataType>(), (uint8*)std::addressof(OutData));
 	}
 
+	// deserializes and validates against a compiled program in one pass, true only without errors
+	template<typename T>
+	bool UStructFromJsonValidated(T&& In, const Deserializer::FJsonSchemaProgram& Program, void* OutValueAddr, TArray<Deserializer::FJsonValidationError>& OutErrors)
+	{
+		auto Struct = Cast<UScriptStruct>(Program.GetStruct());
+		if (!ensure(Struct))
+			return false;
+
+		const int32 NumErrors = OutErrors.Num();
+		bool bSucc = false;
+		{
+			Deserializer::FJsonValidateScope Scope(Program, OutErrors);
+			bSucc = UStructFromJson(Forward<T>(In), Struct, OutValueAddr);
+		}
+		if (!bSucc && OutErrors.Num() == NumErrors)
+			OutErrors.Add({FString(), TEXT("malformed json")});
+		return bSucc && OutErrors.Num() == NumErrors;
+	}
+	template<typename T, typename DataType>
+	bool UStructFromJsonValidated(T&& In, const Deserializer::FJsonSchemaProgram& Program, DataType& OutData, TArray<Deserializer::FJsonValidationError>& OutErrors)
+	{
+		ensure(Program.GetStruct() == TypeTraits::StaticStruct<DataType>());
+		return UStructFromJsonValidated(Forward<T>(In), Program, (void*)std::addressof(OutData), OutErrors);
+	}
+
 	namespace Serializer
 	{
 		class FJsonBuilderImpl;
@@ -174,6 +174,14 @@ namespace Json
 		bool WriteToJson(WriterType& Writer, FProperty* Prop, const void* Value);
 		template<typename JsonType>
 		bool ReadFromJson(const JsonType& JsonVal, FProperty* Prop, void* Value);
+
+		// writes container elements in chunks on workers and splices them in order, false to stay sequential
+		template<typename WriterType>
+		struct TParallelWriter
+		{
+			template<typename F>
+			static bool Write(WriterType& Writer, int32 Num, bool bObject, const F& WriteOne) { return false; }
+		};
 		namespace Internal
 		{
 			using namespace JsonUtils;
@@ -685,8 +693,14 @@ namespace Json
 			template<typename JsonType>
 			bool FromJsonImpl(const JsonType& JsonVal, UStruct* Struct, void* OutValue)
 			{
+				auto Validate = Deserializer::FJsonValidateScope::Current();
 				if (!JsonUtils::IsObjectType(JsonVal))
+				{
+					// nested values are checked by their field rule
+					if (Validate && Validate->IsRoot())
+						Validate->Report(TEXT("expected object"));
 					return false;
+				}
 				if (Struct->IsChildOf(GMP::Reflection::DynamicStruct<FGMPStructUnion>()))
 				{
 					return FromJson(JsonVal, *reinterpret_cast<FGMPStructUnion*>(OutValue));
@@ -744,6 +758,10 @@ namespace Json
 				}
 				else
 				{
+					Deserializer::FJsonValidateScope::FStructState State;
+					if (Validate)
+						Validate->BeginStruct(Struct, State);
+
 					if (const bool bIsUserdefinedStruct = Struct->IsA(UUserDefinedStruct::StaticClass()))
 					{
 						for (TFieldIterator<FProperty> It(Struct); It; ++It)
@@ -755,6 +773,9 @@ namespace Json
 							auto OriginalName = GMP::Serializer::GetAuthoredFNameForField(SubProp->GetFName());
 							if (auto Val = JsonUtils::FindMember(JsonVal, OriginalName))
 							{
+								Deserializer::FJsonPathGuard PathGuard(State.Rules ? Validate : nullptr, OriginalName);
+								if (State.Rules)
+									Validate->MarkField(State, SubProp);
 								ReadFromJson(*Val, SubProp, OutValue);
 							}
 						}
@@ -763,17 +784,24 @@ namespace Json
 					{
 						JsonUtils::ForEachObjectPair(JsonVal, [&](const StringView& InName, const JsonType& InVal) -> bool {
 							FName Name = InName.ToFName();
-							if (!Name.IsNone())
+							FProperty* SubProp = !Name.IsNone() ? Struct->FindPropertyByName(Name) : nullptr;
+							if (SubProp)
 							{
-								FProperty* SubProp = Struct->FindPropertyByName(Name);
-								if (SubProp)
-								{
-									ReadFromJson(InVal, SubProp, OutValue);
-								}
+								Deserializer::FJsonPathGuard PathGuard(State.Rules ? Validate : nullptr, InName);
+								if (State.Rules)
+									Validate->MarkField(State, SubProp);
+								ReadFromJson(InVal, SubProp, OutValue);
+							}
+							else if (State.Rules)
+							{
+								Validate->UnknownField(InName);
 							}
 							return false;
 						});
 					}
+
+					if (State.Rules)
+						Validate->EndStruct(State);
 				}
 				return true;
 			}
@@ -1239,9 +1267,13 @@ namespace Json
 					auto Value = Prop->template ContainerPtrToValuePtr<void>(Addr, 0);
 					GMP_ENSURE_JSON(Writer.StartArray());
 					FScriptArrayHelper Helper(Prop, Value);
-					for (int32 i = 0; i < Helper.Num(); ++i)
+					auto WriteOne = [&](auto& OutWriter, int32 i) { WriteToJson(OutWriter, Prop->Inner, Helper.GetRawPtr(i)); };
+					if (!GMP::Serializer::Parallel::ShouldSplit(Helper.Num(), Prop->Inner) || !TParallelWriter<WriterType>::Write(Writer, Helper.Num(), false, WriteOne))
 					{
-						WriteToJson(Writer, Prop->Inner, Helper.GetRawPtr(i));
+						for (int32 i = 0; i < Helper.Num(); ++i)
+						{
+							WriteOne(Writer, i);
+						}
 					}
 					GMP_ENSURE_JSON(Writer.EndArray());
 				}
@@ -1257,8 +1289,10 @@ namespace Json
 						auto ItemsToRead = FMath::Max((int32)JsonUtils::ArraySize(JsonVal), 0);
 						FScriptArrayHelper Helper(Prop, OutValue);
 						Helper.Resize(ItemsToRead);
+						auto Validate = Deserializer::FJsonValidateScope::Current();
 						for (auto i = 0; i < Helper.Num(); ++i)
 						{
+							Deserializer::FJsonPathGuard PathGuard(Validate, i);
 							ReadFromJson(JsonUtils::ArrayElm(JsonVal, i), Prop->Inner, Helper.GetRawPtr(i));
 						}
 					}
@@ -1280,11 +1314,17 @@ namespace Json
 					auto Value = Prop->template ContainerPtrToValuePtr<void>(Addr, 0);
 					GMP_ENSURE_JSON(Writer.StartArray());
 					FScriptSetHelper Helper(Prop, Value);
-					for (int32 i = 0; i < Helper.Num(); ++i)
-					{
+					auto WriteOne = [&](auto& OutWriter, int32 i) {
 						if (Helper.IsValidIndex(i))
 						{
-							WriteToJson(Writer, Prop->ElementProp, Helper.GetElementPtr(i));
+							WriteToJson(OutWriter, Prop->ElementProp, Helper.GetElementPtr(i));
+						}
+					};
+					if (!GMP::Serializer::Parallel::ShouldSplit(Helper.Num(), Prop->ElementProp) || !TParallelWriter<WriterType>::Write(Writer, Helper.Num(), false, WriteOne))
+					{
+						for (int32 i = 0; i < Helper.Num(); ++i)
+						{
+							WriteOne(Writer, i);
 						}
 					}
 					GMP_ENSURE_JSON(Writer.EndArray());
@@ -1299,8 +1339,10 @@ namespace Json
 					if (GMP_ENSURE_JSON(JsonUtils::IsArrayType(JsonVal)))
 					{
 						FScriptSetHelper Helper(Prop, OutValue);
+						auto Validate = Deserializer::FJsonValidateScope::Current();
 						for (auto i = 0; i < JsonUtils::ArraySize(JsonVal); ++i)
 						{
+							Deserializer::FJsonPathGuard PathGuard(Validate, i);
 							int32 NewIndex = Helper.AddDefaultValue_Invalid_NeedsRehash();
 							ReadFromJson(JsonUtils::ArrayElm(JsonVal, i), Prop->ElementProp, Helper.GetElementPtr(NewIndex));
 						}
@@ -1325,13 +1367,19 @@ namespace Json
 					auto Value = Prop->template ContainerPtrToValuePtr<void>(Addr, 0);
 					GMP_ENSURE_JSON(Writer.StartObject());
 					FScriptMapHelper Helper(Prop, Value);
-					for (int32 i = 0; i < Helper.Num(); ++i)
-					{
+					auto WriteOne = [&](auto& OutWriter, int32 i) {
 						if (Helper.IsValidIndex(i))
 						{
 							FString StrVal = FValueVisitorBase::ExportText(Prop->KeyProp, Helper.GetKeyPtr(i));
-							GMP_ENSURE_JSON(Writer.Key(*StrVal, StrVal.Len()));
-							WriteToJson(Writer, Prop->ValueProp, Helper.GetValuePtr(i));
+							GMP_ENSURE_JSON(OutWriter.Key(*StrVal, StrVal.Len()));
+							WriteToJson(OutWriter, Prop->ValueProp, Helper.GetValuePtr(i));
+						}
+					};
+					if (!GMP::Serializer::Parallel::ShouldSplit(Helper.Num(), Prop->ValueProp, Prop->KeyProp) || !TParallelWriter<WriterType>::Write(Writer, Helper.Num(), true, WriteOne))
+					{
+						for (int32 i = 0; i < Helper.Num(); ++i)
+						{
+							WriteOne(Writer, i);
 						}
 					}
 					GMP_ENSURE_JSON(Writer.EndObject());
@@ -1346,7 +1394,9 @@ namespace Json
 					FScriptMapHelper Helper(Prop, OutValue);
 					if (GMP_ENSURE_JSON(JsonUtils::IsObjectType(JsonVal)))
 					{
+						auto Validate = Deserializer::FJsonValidateScope::Current();
 						JsonUtils::ForEachObjectPair(JsonVal, [&](const StringView& InName, const JsonType& InVal) -> bool {
+							Deserializer::FJsonPathGuard PathGuard(Validate, InName);
 							int32 NewIndex = Helper.AddDefaultValue_Invalid_NeedsRehash();
 							TValueVisitor<FProperty>::ReadVisit(InName, Prop->KeyProp, Helper.GetKeyPtr(NewIndex), 0);
 							ReadFromJson(InVal, Prop->ValueProp, Helper.GetValuePtr(NewIndex));
@@ -1357,6 +1407,28 @@ namespace Json
 				}
 			};
 
+			// classifies a dispatched json value for the active validation rule
+			template<typename JsonType>
+			struct TValidateElm
+			{
+				Deserializer::FJsonValidateScope& Validate;
+				const Deserializer::FJsonFieldRule& Rule;
+
+				bool operator()(const FMonoState&) const { return Validate.CheckKind(Rule, Deserializer::EJsonKind::Null); }
+				bool operator()(bool) const { return Validate.CheckKind(Rule, Deserializer::EJsonKind::Bool); }
+				template<typename T>
+				std::enable_if_t<std::is_arithmetic<T>::value, bool> operator()(T Val) const
+				{
+					using FCheckType = std::conditional_t<std::is_floating_point<T>::value, double, std::conditional_t<std::is_signed<T>::value, int64, uint64>>;
+					return Validate.CheckNumber(Rule, static_cast<FCheckType>(Val));
+				}
+				bool operator()(const StringView& Val) const { return Validate.CheckString(Rule, Val); }
+				bool operator()(const JsonType* JsonPtr) const
+				{
+					return Validate.CheckKind(Rule, JsonUtils::IsArrayType(*JsonPtr) ? Deserializer::EJsonKind::Array : Deserializer::EJsonKind::Object);
+				}
+			};
+
 			template<typename P>
 			struct TValueDispatcher
 			{
@@ -1383,12 +1455,18 @@ namespace Json
 				static bool Read(const JsonType& JsonVal, P* Prop, void* Addr)
 				{
 					int32 i = 0;
-					auto Visitor = [&](auto&& Elm) { TValueVisitor<P>::ReadVisit(std::forward<decltype(Elm)>(Elm), Prop, Addr, i); };
+					auto Validate = Deserializer::FJsonValidateScope::Current();
+					const Deserializer::FJsonFieldRule* Rule = Validate ? Validate->FindRule(Prop) : nullptr;
+					auto Visitor = [&](auto&& Elm) {
+						if (!Rule || TValidateElm<JsonType>{*Validate, *Rule}(Elm))
+							TValueVisitor<P>::ReadVisit(std::forward<decltype(Elm)>(Elm), Prop, Addr, i);
+					};
 					if (JsonUtils::IsArrayType(JsonVal) && !CastField<FArrayProperty>(Prop) && !CastField<FSetProperty>(Prop))
 					{
 						auto ItemsToRead = FMath::Clamp((int32)JsonVal.Size(), 0, Prop->ArrayDim);
 						for (; i < ItemsToRead; ++i)
 						{
+							Deserializer::FJsonPathGuard PathGuard(Rule ? Validate : nullptr, i);
 #if GMP_USE_STD_VARIANT
 							std::visit(Visitor, JsonUtils::DispatchValue(JsonUtils::ArrayElm(JsonVal, i)));
 #else
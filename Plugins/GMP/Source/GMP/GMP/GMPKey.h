@@ -43,6 +43,14 @@ struct FGMPListenOptions : public FGMPListenOrder
 
 	int32 Times = -1;
 
+	// still invoked after a higher order listener consumed the message, e.g. analytics
+	bool bObserveConsumed = false;
+	FGMPListenOptions& ObserveConsumed(bool bInObserve = true)
+	{
+		bObserveConsumed = bInObserve;
+		return *this;
+	}
+
 	GMP_API static FGMPListenOptions Default;
 };
 }  // namespace GMP
@@ -0,0 +1,61 @@
+//  Copyright GenericMessagePlugin, Inc. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+
+#include "GMPSignals.inl"
+#include "UObject/WeakObjectPtr.h"
+#include "UnrealCompatibility.h"
+
+#if UE_5_00_OR_LATER
+#include "HAL/LowLevelMemTracker.h"
+LLM_DECLARE_TAG_API(GMP, GMP_API);
+#define GMP_LLM_SCOPE() LLM_SCOPE_BYTAG(GMP)
+#else
+#define GMP_LLM_SCOPE()
+#endif
+
+namespace GMP
+{
+class FMessageHub;
+
+struct FGMPMemoryStat
+{
+	SIZE_T Bytes = 0;
+	int32 Count = 0;
+
+	void Add(SIZE_T InBytes, int32 InCount = 1)
+	{
+		Bytes += InBytes;
+		Count += InCount;
+	}
+};
+
+// allocated bytes of the message hub attributed to message keys, listener owners and source objects
+struct GMP_API FGMPMemoryReport
+{
+	TMap<FName, FGMPMemoryStat> MessageKeys;
+	TMap<FWeakObjectPtr, FGMPMemoryStat> Listeners;
+	TMap<FSigSource, FGMPMemoryStat> Sources;
+
+	// containers shared by every key (global slot set, source mappings, signal map)
+	SIZE_T SharedBytes = 0;
+
+	// subtotals, already included in MessageKeys and SharedBytes
+	FGMPMemoryStat StaleListeners;  // owner object is gone but the slot is still stored
+	FGMPMemoryStat Responses;
+	FGMPMemoryStat Meta;
+
+	// listener slot allocator: chunks reserved, slots handed out of them and slots too big for a size class
+	FGMPMemoryStat Slab;
+	FGMPMemoryStat SlabSlots;
+	FGMPMemoryStat LargeSlots;
+
+	void AddListener(FName MessageKey, const FWeakObjectPtr& Listener, FSigSource InSigSrc, SIZE_T InBytes);
+	SIZE_T GetTotalBytes() const;
+
+	// null collects the global hub and every world hub
+	static FGMPMemoryReport Collect(const FMessageHub* Hub = nullptr);
+	void Dump(FOutputDevice& Ar, int32 MaxRows = 20) const;
+};
+}  // namespace GMP
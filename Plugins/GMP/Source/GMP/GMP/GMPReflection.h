@@ -129,7 +129,12 @@ namespace Reflection
 	}
 
 	// Name --> Property
+	// cached results are served on any thread, misses off the game thread wait for the game thread to resolve them
 	GMP_API bool PropertyFromString(FString TypeString, FProperty*& OutProp, bool bTemplateSub = false, bool bContainerSub = false, bool bNew = false);
+	// drops cached PropertyFromString results, done automatically on module load, blueprint compile and package reload
+	GMP_API void InvalidatePropertyFromStringCache();
+	// broadcast on the game thread after those caches were dropped, for caches of type names keyed by property
+	GMP_API FSimpleMulticastDelegate& OnReflectionCachesInvalidated();
 
 #if GMP_USE_NEW_PROP_FROM_STRING
 	GMP_API bool NewPropertyFromString(FString TypeString, FProperty*& OutProp, bool bTemplateSub = false, bool bContainerSub = false);
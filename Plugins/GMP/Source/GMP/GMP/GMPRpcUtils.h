@@ -41,7 +41,7 @@ protected:
 		// make standalone work
 		if (!Package || Package->GetWorld()->GetNetMode() == NM_Standalone)
 		{
-			FMessageUtils::GetMessageHub()->SendObjectMessage(FMSGKEYFind(MessageKey), Sender, Forward<TArgs>(InArgs)...);
+			FMessageUtils::GetSourceHub(Sender)->SendObjectMessage(FMSGKEYFind(MessageKey), Sender, Forward<TArgs>(InArgs)...);
 		}
 		else
 #endif
@@ -77,7 +77,7 @@ public:
 		if (!ensureAlways(PC && bSucc))
 			return;
 #endif
-		FMessageUtils::GetMessageHub()->ListenObjectMessage(Key, WatchedObj, Binder, Forward<F>(Func), Times);
+		FMessageUtils::GetSourceHub(WatchedObj)->ListenObjectMessage(Key, WatchedObj, Binder, Forward<F>(Func), Times);
 	}
 
 	template<typename F>
@@ -109,7 +109,7 @@ struct TRpcMessageUtils<void (UserClass::*)(TArgs...)>
 
 			bool bSucc = FRpcMessageUtils::Z_VerifyRPC(PC, InUserObject, HashKey, Properties);
 			if (ensureAlways(bSucc))
-				FMessageUtils::GetMessageHub()->ListenObjectMessage(HashKey, InUserObject, InUserObject, Func, Times);
+				FMessageUtils::GetSourceHub(InUserObject)->ListenObjectMessage(HashKey, InUserObject, InUserObject, Func, Times);
 		}
 	}
 };
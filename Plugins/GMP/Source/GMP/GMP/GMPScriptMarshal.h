@@ -0,0 +1,218 @@
+//  Copyright GenericMessagePlugin, Inc. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+
+#include "GMPReflection.h"
+#include "GMPStruct.h"
+
+// shared by script bindings (UnLua/Puerts) to avoid resolving properties and converters on every message
+namespace GMP
+{
+namespace Script
+{
+	FORCEINLINE int32 GetPropElementSize(const FProperty* Prop)
+	{
+#if UE_5_05_OR_LATER
+		return Prop->GetElementSize();
+#else
+		return Prop->ElementSize;
+#endif
+	}
+
+	// argument layout resolved once per (message key, signature)
+	template<typename ConverterType>
+	struct TMarshalPlan
+	{
+		struct FArgSlot
+		{
+			FProperty* Prop = nullptr;
+			ConverterType Converter;
+			int32 Offset = 0;
+#if GMP_WITH_TYPENAME
+			FName TypeName;
+#endif
+		};
+
+		FName MessageKey;
+		FArrayTypeNames SigNames;
+		TArray<FArgSlot, TInlineAllocator<8>> Slots;
+		int32 BufferSize = 0;
+		int32 BufferAlign = 1;
+
+		int32 Num() const { return Slots.Num(); }
+		const FArgSlot& operator[](int32 Idx) const { return Slots[Idx]; }
+
+		template<typename GetNameFunc>
+		bool Matches(FName InMessageKey, int32 NumArgs, const GetNameFunc& GetTypeName) const
+		{
+			if (InMessageKey != MessageKey || NumArgs != SigNames.Num())
+				return false;
+			for (int32 Idx = 0; Idx < NumArgs; ++Idx)
+			{
+				if (SigNames[Idx] != GetTypeName(Idx))
+					return false;
+			}
+			return true;
+		}
+
+		// construct every argument inside Buffer and point Params at them
+		void InitializeArgs(uint8* Buffer, FTypedAddresses& OutParams) const
+		{
+			OutParams.Reset(Slots.Num());
+			for (auto& Slot : Slots)
+			{
+				uint8* Addr = Buffer + Slot.Offset;
+				Slot.Prop->InitializeValue_InContainer(Addr);
+				auto& TypedAddr = OutParams.AddDefaulted_GetRef();
+				TypedAddr.SetAddr(Addr);
+#if GMP_WITH_TYPENAME
+				TypedAddr.TypeName = Slot.TypeName;
+#endif
+			}
+		}
+
+		void DestroyArgs(uint8* Buffer) const
+		{
+			for (auto& Slot : Slots)
+				Slot.Prop->DestroyValue_InContainer(Buffer + Slot.Offset);
+		}
+	};
+
+	template<typename ConverterType>
+	class TMarshalPlanCache
+	{
+	public:
+		using FPlan = TMarshalPlan<ConverterType>;
+
+		// CreateConverter : ConverterType(FProperty*), converters are owned by the plan
+		template<typename GetNameFunc, typename CreateFunc>
+		static const FPlan* FindOrAdd(FName MessageKey, int32 NumArgs, const GetNameFunc& GetTypeName, const CreateFunc& CreateConverter)
+		{
+			// the cache is not locked, script vms marshal on the game thread
+			GMP_CHECK(IsInGameThread());
+			uint32 Hash = GetTypeHash(MessageKey);
+			for (int32 Idx = 0; Idx < NumArgs; ++Idx)
+				Hash = HashCombine(Hash, GetTypeHash(GetTypeName(Idx)));
+
+			auto& Plans = GetPlans();
+			for (auto It = Plans.CreateConstKeyIterator(Hash); It; ++It)
+			{
+				if (It.Value()->Matches(MessageKey, NumArgs, GetTypeName))
+					return It.Value().Get();
+			}
+
+			auto Plan = MakeUnique<FPlan>();
+			Plan->MessageKey = MessageKey;
+			for (int32 Idx = 0; Idx < NumArgs; ++Idx)
+			{
+				const FName TypeName = GetTypeName(Idx);
+				FProperty* Prop = nullptr;
+				if (!Reflection::PropertyFromString(TypeName.ToString(), Prop) || !Prop)
+				{
+					GMP_ERROR(TEXT("cannot get property from [%s]"), *TypeName.ToString());
+					return nullptr;
+				}
+
+				auto&& Converter = CreateConverter(Prop);
+				if (!Converter)
+				{
+					GMP_ERROR(TEXT("cannot create converter for [%s]"), *TypeName.ToString());
+					return nullptr;
+				}
+
+				const int32 PropAlign = FMath::Max(Prop->GetMinAlignment(), 1);
+				Plan->BufferSize = Align(Plan->BufferSize, PropAlign);
+				Plan->BufferAlign = FMath::Max(Plan->BufferAlign, PropAlign);
+
+				auto& Slot = Plan->Slots.AddDefaulted_GetRef();
+				Slot.Prop = Prop;
+				Slot.Converter = MoveTemp(Converter);
+				Slot.Offset = Plan->BufferSize;
+#if GMP_WITH_TYPENAME
+				Slot.TypeName = Reflection::GetPropertyName(Prop);
+#endif
+				Plan->SigNames.Add(TypeName);
+				Plan->BufferSize += GetPropElementSize(Prop) * Prop->ArrayDim;
+			}
+			return Plans.Add(Hash, MoveTemp(Plan)).Get();
+		}
+
+		static void Reset()
+		{
+			GMP_CHECK(IsInGameThread());
+			GetPlans().Reset();
+		}
+
+	private:
+		static TMultiMap<uint32, TUniquePtr<FPlan>>& GetPlans()
+		{
+			static TMultiMap<uint32, TUniquePtr<FPlan>> Plans;
+			// plans hold the properties and converters of a layout a recompile or a package reload replaces
+			static FDelegateHandle InvalidateHandle = Reflection::OnReflectionCachesInvalidated().AddStatic(&TMarshalPlanCache::Reset);
+			return Plans;
+		}
+	};
+
+	// reusable argument storage per script vm (main lua_State/v8::Isolate), nested sends get their own depth slot
+	class FArgBuffers
+	{
+		static constexpr int32 kMaxAlign = 16;
+		using FBuffer = TArray<uint8, TAlignedHeapAllocator<kMaxAlign>>;
+		struct FStack
+		{
+			TArray<FBuffer, TInlineAllocator<4>> Buffers;
+			int32 Depth = 0;
+		};
+		static TMap<const void*, FStack>& GetStacks()
+		{
+			static TMap<const void*, FStack> Stacks;
+			return Stacks;
+		}
+
+	public:
+		struct FScope
+		{
+			FScope(const void* InOwner, int32 Size, int32 Align)
+				: Owner(InOwner)
+			{
+				GMP_CHECK_SLOW(IsInGameThread());
+				if (UNLIKELY(Align > kMaxAlign))
+				{
+					Fallback = static_cast<uint8*>(FMemory::Malloc(FMath::Max(Size, 1), Align));
+					Data = Fallback;
+					return;
+				}
+				auto& Stack = GetStacks().FindOrAdd(Owner);
+				if (Stack.Buffers.Num() <= Stack.Depth)
+					Stack.Buffers.AddDefaulted(Stack.Depth + 1 - Stack.Buffers.Num());
+				auto& Buffer = Stack.Buffers[Stack.Depth++];
+				if (Buffer.Num() < Size)
+					Buffer.SetNumUninitialized(Size);
+				Data = Buffer.GetData();
+			}
+			~FScope()
+			{
+				if (Fallback)
+				{
+					FMemory::Free(Fallback);
+				}
+				else if (auto Stack = GetStacks().Find(Owner))
+				{
+					--Stack->Depth;
+				}
+			}
+			uint8* GetData() const { return Data; }
+
+		private:
+			FScope(const FScope&) = delete;
+			FScope& operator=(const FScope&) = delete;
+			const void* Owner;
+			uint8* Data = nullptr;
+			uint8* Fallback = nullptr;
+		};
+
+		static void Release(const void* Owner) { GetStacks().Remove(Owner); }
+	};
+}  // namespace Script
+}  // namespace GMP
@@ -84,5 +84,26 @@ namespace Serializer
 	GMP_API bool StripUserDefinedStructName(FString& InOutName);
 
 	GMP_API FString AsFString(const ANSICHAR* Str, int64 Len);
+
+	// opt-in chunked serialization of large containers on task graph workers
+	namespace Parallel
+	{
+		// gmp.serializer.parallel.minelements, 0 disables
+		GMP_API int32 GetMinElements();
+		GMP_API int32 GetChunkSize();
+
+		// false inside a chunk and for elements that resolve object references
+		GMP_API bool ShouldSplit(int32 Num, FProperty* ElementProp, FProperty* KeyProp = nullptr);
+
+		// marks the current thread as serializing a chunk, nested containers stay sequential
+		struct GMP_API FChunkScope
+		{
+			FChunkScope();
+			~FChunkScope();
+
+		protected:
+			bool bPrevInChunk;
+		};
+	}  // namespace Parallel
 }  // namespace Serializer
 }  // namespace GMP
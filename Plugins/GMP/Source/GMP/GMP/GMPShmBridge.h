@@ -0,0 +1,167 @@
+//  Copyright GenericMessagePlugin, Inc. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+
+#include "GMPArchive.h"
+#include "GMPClass2Prop.h"
+#include "GMPUtils.h"
+#include "HAL/PlatformMemory.h"
+#include "Templates/SharedPointer.h"
+
+namespace GMP
+{
+namespace Bridge
+{
+	enum class EShmRole : uint8
+	{
+		Publisher,
+		Subscriber,
+	};
+
+	// what the publisher does when the ring has no room for a record
+	enum class EShmFullPolicy : uint8
+	{
+		// the record is lost and counted in the ring header, the subscriber sees it in its stats
+		Drop,
+		// the record waits locally up to MaxBacklogBytes and is retried on each pump, order is kept
+		Backlog,
+	};
+
+	enum class EShmPublishResult : uint8
+	{
+		Written,
+		Backlogged,
+		Dropped,
+		// not a publisher, key not registered or record larger than half the ring
+		Rejected,
+	};
+
+	struct FShmBridgeSettings
+	{
+		// ring payload bytes, rounded up to a power of two, only used by the publisher
+		int32 CapacityBytes = 1 << 20;
+		EShmFullPolicy FullPolicy = EShmFullPolicy::Drop;
+		int32 MaxBacklogBytes = 4 << 20;
+		// records delivered per pump by the subscriber, 0 for all available
+		int32 MaxRecordsPerPump = 0;
+		// pump at the end of each frame, otherwise Pump has to be called by the owner
+		bool bAutoPump = true;
+	};
+
+	struct FShmBridgeStats
+	{
+		int64 Written = 0;
+		int64 Received = 0;
+		// publisher side total, read from the ring header on the subscriber
+		int64 Dropped = 0;
+		// records whose schema is not registered on the subscriber
+		int64 Unknown = 0;
+		int32 BacklogBytes = 0;
+		int32 FreeBytes = 0;
+	};
+
+	// one way message channel between processes of the same host over a named shared memory ring
+	// the publisher serializes registered keys sent on the local hub with the net encoding of GMPArchive
+	// the subscriber re-injects them into its hub as script notifies, both sides register the same key schemas
+	class GMP_API FShmMessageBridge : public TSharedFromThis<FShmMessageBridge>
+	{
+	public:
+		static TSharedRef<FShmMessageBridge> Create(const FString& ChannelName, EShmRole Role, const FShmBridgeSettings& InSettings = {});
+
+		FShmMessageBridge(const FString& ChannelName, EShmRole Role, const FShmBridgeSettings& InSettings);
+		~FShmMessageBridge();
+
+		template<typename... TArgs>
+		FORCEINLINE bool RegisterKey(const MSGKEY_TYPE& K)
+		{
+			using MyTraits = Class2Prop::TPropertiesTraits<std::decay_t<TArgs>...>;
+			return RegisterKey(K, MyTraits::GetProperties());
+		}
+		// parameters may not reference objects, the schema id covers the key and every parameter type
+		bool RegisterKey(const FName& MessageKey, const TArray<FProperty*>& Props);
+		// type names as in message tag definitions
+		bool RegisterKey(const FName& MessageKey, const FArrayTypeNames& TypeNames);
+		void UnregisterKey(const FName& MessageKey);
+
+		// typed publish without a hub round trip, same record as a hub send of the key
+		template<typename... TArgs>
+		EShmPublishResult Publish(const MSGKEY_TYPE& K, const TArgs&... Args)
+		{
+			using MyTraits = Class2Prop::TPropertiesTraits<std::decay_t<TArgs>...>;
+			static auto Properties = MyTraits::GetProperties();
+			const uint32 SchemaId = FindSchemaId(K, Properties);
+			if (!SchemaId)
+				return EShmPublishResult::Rejected;
+
+			FGMPNetBitWriter Writer(static_cast<UPackageMap*>(nullptr), 0);
+			Serializer::NetSerializeWithProps(nullptr, Writer, Properties, const_cast<TArgs&>(Args)...);
+			return PublishRecord(SchemaId, Writer);
+		}
+		EShmPublishResult Publish(const FName& MessageKey, const FTypedAddresses& Params);
+
+		// subscriber delivers pending records, publisher retries its backlog, returns records moved
+		int32 Pump();
+
+		bool IsAttached() const { return !!Region; }
+		EShmRole GetRole() const { return Role; }
+		const FString& GetChannelName() const { return ChannelName; }
+		FShmBridgeStats GetStats() const;
+
+	protected:
+		struct FSchema
+		{
+			FName MessageKey;
+			TArray<FProperty*> Props;
+			TArray<int32> Offsets;
+			int32 Size = 0;
+			int32 Align = 1;
+			uint32 Id = 0;
+			FGMPKey ListenKey;
+		};
+
+		struct FPendingRecord
+		{
+			uint32 SchemaId = 0;
+			uint32 NumBits = 0;
+			TArray<uint8> Bytes;
+		};
+
+		uint32 FindSchemaId(const FName& MessageKey, const TArray<FProperty*>& Props) const;
+		EShmPublishResult PublishRecord(uint32 SchemaId, FGMPNetBitWriter& Writer);
+		bool TryWrite(uint32 SchemaId, const uint8* Bytes, uint32 NumBytes, uint32 NumBits);
+		int32 FlushBacklog();
+		int32 Drain();
+		void Deliver(const FSchema& Schema, uint8* Bytes, uint32 NumBits);
+		void OnHubMessage(FMessageBody& Body);
+
+		bool Attach();
+		void Detach();
+		void OnEndFrame();
+
+		struct FRingHeader* GetHeader() const;
+		uint8* GetRingData() const;
+
+		FString ChannelName;
+		EShmRole Role;
+		FShmBridgeSettings Settings;
+
+		FPlatformMemory::FSharedMemoryRegion* Region = nullptr;
+		uint32 Capacity = 0;
+
+		TMap<FName, FSchema> Schemas;
+		TMap<uint32, FName> SchemaIds;
+
+		TArray<FPendingRecord> Backlog;
+		int32 BacklogBytes = 0;
+		TArray<uint8> Scratch;
+		bool bDraining = false;
+
+		int64 Written = 0;
+		int64 Received = 0;
+		int64 Dropped = 0;
+		int64 Unknown = 0;
+		FDelegateHandle EndFrameHandle;
+	};
+}  // namespace Bridge
+}  // namespace GMP
@@ -152,6 +152,14 @@ struct FSigSource
 	FString GetNameSafe() const { return IsUObject() ? ::GetNameSafe(TryGetUObject()) : FString::Printf(TEXT("[%p]"), GetObjectAddr()); }
 
 	GMP_API static void RemoveSource(FSigSource InSigSrc);
+	// sources removed inside the scope are muted and swept in one batch, like objects purged by gc
+	struct GMP_API FBatchRemovalScope
+	{
+		FBatchRemovalScope();
+		~FBatchRemovalScope();
+	};
+	// sweeps the stores of batched removals, returns how many are left for the next flush because they are firing
+	GMP_API static int32 FlushRemovedSources();
 	GMP_API static FSigSource NullSigSrc;
 	GMP_API static FSigSource AnySigSrc;
 
@@ -20,6 +20,7 @@
 namespace GMP
 {
 class FMessageHub;
+struct FGMPMemoryReport;
 // clang-format off
 namespace Details
 {
@@ -93,6 +94,20 @@ public:
 }  // namespace Details
 // clang-format on
 
+namespace ListenerAudit
+{
+	GMP_API void OnSigElmDestroyed(FGMPKey Key);
+}
+
+namespace SigElmAllocator
+{
+	struct FArena;
+	// slots up to 512 bytes come from size class pages, bigger ones from FMemory
+	GMP_API void* Malloc(SIZE_T Size);
+	GMP_API void Free(void* Ptr);
+	GMP_API SIZE_T GetAllocSize(const void* Ptr);
+}  // namespace SigElmAllocator
+
 struct FSigElmData
 {
 	const auto& GetHandler() const { return Handler; }
@@ -105,7 +120,12 @@ struct FSigElmData
 	auto GetGMPKey() const { return GMPKey; }
 
 	void SetLeftTimes(int32 InTimes) { Times = (InTimes < 0 ? -1 : InTimes); }
+	bool HasLeftTimes() const { return Times != 0; }
 	void SetListenOrder(int32 InOrder) { Order = InOrder; }
+	void SetObserveConsumed(bool bInObserve) { bObserveConsumed = bInObserve; }
+	FORCEINLINE bool ShouldSkipConsumed(const bool* ConsumedFlag) const { return ConsumedFlag && *ConsumedFlag && !bObserveConsumed; }
+	// the listener audit holds a record of this slot until it is destroyed
+	void SetAudited() { bAudited = true; }
 
 protected:
 	FSigSource Source = FSigSource::NullSigSrc;
@@ -113,25 +133,27 @@ protected:
 	FGMPKey GMPKey = {};
 	int32 Times = -1;
 	int32 Order = 0;
+	bool bObserveConsumed = false;
+	bool bAudited = false;
 };
 
-#define SLOT_STORAGE_INLINE_SIZE GMP_FUNCTION_PREDEFINED_ALIGN_SIZE
-#ifndef SLOT_STORAGE_INLINE_SIZE
-#define SLOT_STORAGE_INLINE_SIZE GMP_FUNCTION_PREDEFINED_INLINE_SIZE
-#endif  // SLOT_STORAGE_INLINE_SIZE
+// minimum inline callable bytes of a slot, set per build from GMP.Build.cs
+#ifndef GMP_SIGELM_INLINE_SIZE
+#define GMP_SIGELM_INLINE_SIZE GMP_FUNCTION_PREDEFINED_ALIGN_SIZE
+#endif
+#define SLOT_STORAGE_INLINE_SIZE GMP_SIGELM_INLINE_SIZE
+// slots grow to fit their functor instead of spilling it into a second allocation
 #define GMP_ALWAYS_USE_INLINE_SIGNAL (SLOT_STORAGE_INLINE_SIZE < GMP_FUNCTION_PREDEFINED_INLINE_SIZE)
 
 class FSigElm final : public TAttachedCallableStore<FSigElmData, SLOT_STORAGE_INLINE_SIZE>
 {
-#if GMP_ALWAYS_USE_INLINE_SIGNAL
 public:
 	void* operator new(size_t Size, uint32 AdditionalSize)
 	{
 		auto AllocSize = FMath::Max(sizeof(FSigElm), offsetofINLINE() + FMath::Max((uint32)FStorageEraseBase::kAlignSize, AdditionalSize));
-		return FMemory::Malloc(AllocSize, alignof(FSigElm));
+		return SigElmAllocator::Malloc(AllocSize);
 	}
-	void operator delete(void* Ptr) { return FMemory::Free(Ptr); }
-#endif
+	void operator delete(void* Ptr) { SigElmAllocator::Free(Ptr); }
 
 	struct FKeyFuncs : BaseKeyFuncs<TUniquePtr<FSigElm>, FGMPKey, false>
 	{
@@ -146,16 +168,17 @@ private:
 #if GMP_ALWAYS_USE_INLINE_SIGNAL
 		return new (AdditionalSize) FSigElm(InKey);
 #else
-		return new FSigElm(InKey);
+		return new (0u) FSigElm(InKey);
 #endif
 	}
 	using Super = TAttachedCallableStore<FSigElmData, SLOT_STORAGE_INLINE_SIZE>;
 
 	template<typename Functor, uint32 INLINE_SIZE = sizeof(TTypedObject<std::decay_t<Functor>>)>
-	static FSigElm* Construct(FGMPKey InKey, Functor&& InFunc, int32 InTimes = -1)
+	static FSigElm* Construct(FGMPKey InKey, Functor&& InFunc, FGMPListenOptions Options = {})
 	{
 		FSigElm* Impl = Alloc(InKey, INLINE_SIZE);
-		Impl->SetLeftTimes(InTimes);
+		Impl->SetLeftTimes(Options.Times);
+		Impl->SetObserveConsumed(Options.bObserveConsumed);
 		Impl->BindOrMove(std::forward<Functor>(InFunc));
 		return Impl;
 	}
@@ -163,7 +186,13 @@ private:
 	template<typename Functor, uint32 INLINE_SIZE = sizeof(TTypedObject<std::decay_t<Functor>>), std::enable_if_t<!Internal::TIsGMPCallable<std::decay_t<Functor>>::value, int> = 0>
 	auto BindOrMove(Functor&& InFunc)
 	{
+#if GMP_ALWAYS_USE_INLINE_SIGNAL
+		// operator new already reserved INLINE_SIZE bytes past the inline buffer
+		constexpr uint32 ACTUAL_INLINE_SIZE = SLOT_STORAGE_INLINE_SIZE > INLINE_SIZE ? SLOT_STORAGE_INLINE_SIZE : INLINE_SIZE;
+		return Super::BindInline(std::forward<Functor>(InFunc), ACTUAL_INLINE_SIZE);
+#else
 		return Super::Bind(std::forward<Functor>(InFunc));
+#endif
 	}
 
 	template<typename Functor, uint32 INLINE_SIZE = sizeof(TTypedObject<std::decay_t<Functor>>), std::enable_if_t<Internal::TIsGMPCallable<std::decay_t<Functor>>::value, int> = 0>
@@ -178,6 +207,14 @@ private:
 	FSigElm(const FSigElm&) = delete;
 	FSigElm& operator=(const FSigElm&) = delete;
 
+public:
+	~FSigElm()
+	{
+		if (bAudited)
+			ListenerAudit::OnSigElmDestroyed(GMPKey);
+	}
+
+private:
 	friend class FSignalStore;
 	template<bool, typename...>
 	friend class TSignal;
@@ -229,6 +266,9 @@ public:
 
 	bool IsFiring() const { return ScopeCnt != 0; }
 
+	void CollectMemory(FGMPMemoryReport& Report) const;
+	static void CollectSharedMemory(FGMPMemoryReport& Report);
+
 private:
 #if !GMP_SIGNAL_WITH_GLOBAL_SIGELMSET
 	mutable TSet<TUniquePtr<FSigElm>, FSigElm::FKeyFuncs> SigElmSet;
@@ -239,6 +279,14 @@ private:
 	mutable TMap<FWeakObjectPtr, FSigElmKeySet> HandlerObjs;
 	std::atomic<int32> ScopeCnt{0};
 
+	// slab pages of this store once it outgrew the shared ones, keeps the slots of one message key together
+	SigElmAllocator::FArena* Arena = nullptr;
+
+	// slots of sources destroyed during a gc pass, swept at once by the source deleter
+	TArray<FGMPKey> PendingRemovals;
+	TArray<FSigSource, TInlineAllocator<1>> PendingWorlds;
+	bool bSweepPending = false;
+
 	FSigElm* AddSigElmImpl(FGMPKey Key, const UObject* InHandler, FSigSource InSigSrc, const TGMPFunctionRef<FSigElm*()>& Ctor);
 
 	void Reset();
@@ -349,19 +397,20 @@ protected:
 	using FOnFireResults = void;
 #endif
 
+	// ConsumedFlag is polled between slots, once set only slots observing consumed messages are invoked
 	template<bool bAllowDuplicate>
-	void OnFire(const TGMPFunctionRef<void(FSigElm*)>& Invoker) const;
+	void OnFire(const TGMPFunctionRef<void(FSigElm*)>& Invoker, const bool* ConsumedFlag = nullptr) const;
 	template<bool bAllowDuplicate>
-	FOnFireResults OnFireWithSigSource(FSigSource InSigSrc, const TGMPFunctionRef<void(FSigElm*)>& Invoker) const;
+	FOnFireResults OnFireWithSigSource(FSigSource InSigSrc, const TGMPFunctionRef<void(FSigElm*)>& Invoker, const bool* ConsumedFlag = nullptr) const;
 };
 extern template GMP_API void FSignalImpl::Disconnect<true>(const UObject* Listener);
 extern template GMP_API void FSignalImpl::Disconnect<false>(const UObject* Listener);
 extern template GMP_API void FSignalImpl::DisconnectExactly<true>(const UObject* Listener, FSigSource InSigSrc);
 extern template GMP_API void FSignalImpl::DisconnectExactly<false>(const UObject* Listener, FSigSource InSigSrc);
-extern template GMP_API void FSignalImpl::OnFire<true>(const TGMPFunctionRef<void(FSigElm*)>& Invoker) const;
-extern template GMP_API void FSignalImpl::OnFire<false>(const TGMPFunctionRef<void(FSigElm*)>& Invoker) const;
-extern template GMP_API FSignalImpl::FOnFireResults FSignalImpl::OnFireWithSigSource<true>(FSigSource InSigSrc, const TGMPFunctionRef<void(FSigElm*)>& Invoker) const;
-extern template GMP_API FSignalImpl::FOnFireResults FSignalImpl::OnFireWithSigSource<false>(FSigSource InSigSrc, const TGMPFunctionRef<void(FSigElm*)>& Invoker) const;
+extern template GMP_API void FSignalImpl::OnFire<true>(const TGMPFunctionRef<void(FSigElm*)>& Invoker, const bool* ConsumedFlag) const;
+extern template GMP_API void FSignalImpl::OnFire<false>(const TGMPFunctionRef<void(FSigElm*)>& Invoker, const bool* ConsumedFlag) const;
+extern template GMP_API FSignalImpl::FOnFireResults FSignalImpl::OnFireWithSigSource<true>(FSigSource InSigSrc, const TGMPFunctionRef<void(FSigElm*)>& Invoker, const bool* ConsumedFlag) const;
+extern template GMP_API FSignalImpl::FOnFireResults FSignalImpl::OnFireWithSigSource<false>(FSigSource InSigSrc, const TGMPFunctionRef<void(FSigElm*)>& Invoker, const bool* ConsumedFlag) const;
 
 template<bool bAllowDuplicate, typename... TArgs>
 class TSignal final : public FSignalImpl
@@ -461,6 +510,12 @@ public:
 		return OnFireWithSigSource<bAllowDuplicate>(InSigSrc, [&](FSigElm* Elem) { InvokeSlot(Elem, ForwardParam<TArgs>(Args)...); });
 	}
 
+	// stops at the first slot that sets bConsumed, except for slots listening with bObserveConsumed
+	auto FireConsumable(FSigSource InSigSrc, const bool& bConsumed, TArgs... Args) const
+	{
+		return OnFireWithSigSource<bAllowDuplicate>(InSigSrc, [&](FSigElm* Elem) { InvokeSlot(Elem, ForwardParam<TArgs>(Args)...); }, &bConsumed);
+	}
+
 	using FSignalImpl::Disconnect;
 	FORCEINLINE void Disconnect(const UObject* Listener, FSigSource InSigSrc) { FSignalImpl::DisconnectExactly<bAllowDuplicate>(Listener, InSigSrc); }
 	FORCEINLINE void Disconnect(const UObject* Listener) { FSignalImpl::Disconnect<bAllowDuplicate>(Listener); }
@@ -505,7 +560,7 @@ private:
 	auto ConnectImpl(std::false_type, T* const Obj, Lambda&& Callable, FSigSource InSigSrc, FGMPListenOptions Options, FGMPKey Seq = {})
 	{
 		auto Key = Seq ? Seq : GetGMPKey(Callable, Options);
-		auto Item = Store->AddSigElm<bAllowDuplicate>(Key, ToUObject(Obj), InSigSrc, [&] { return FSigElm::Construct(Key, std::forward<Lambda>(Callable), Options.Times); });
+		auto Item = Store->AddSigElm<bAllowDuplicate>(Key, ToUObject(Obj), InSigSrc, [&] { return FSigElm::Construct(Key, std::forward<Lambda>(Callable), Options); });
 		return Item;
 	}
 };
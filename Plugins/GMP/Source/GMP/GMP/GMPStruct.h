@@ -542,6 +542,10 @@ struct GMP_API FMessageBody
 
 	bool IsSignatureCompatible(bool bCall, const FArrayTypeNames*& OldTypes);
 
+	// remaining lower order listeners are skipped unless they listen with bObserveConsumed
+	void Consume() { bConsumed = true; }
+	bool IsConsumed() const { return bConsumed; }
+
 	TArray<FGMPTypedAddr> MakeFullParameters(uint8 BodyDataMask, int32& ReserveCnt, TArray<FGMPTypedAddr>& InOutAddrs) const
 	{
 		TArray<FGMPTypedAddr> Ret;
@@ -621,6 +625,7 @@ protected:
 	FSigSource CurSigSrc;
 
 	FGMPKey SequenceId;
+	bool bConsumed = false;
 	friend class FMessageHub;
 #if WITH_EDITOR
 	float GetTimeSeconds();
@@ -0,0 +1,26 @@
+//  Copyright GenericMessagePlugin, Inc. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+
+namespace GMP
+{
+// container type names hash-consed by (kind, inner names)
+// each tuple is formatted only the first time it is seen, later compositions are a lookup
+namespace TypeId
+{
+	enum class EKind : uint8
+	{
+		Name,  // leaf identified by its FName
+		Array,
+		Set,
+		Map,
+		Optional,
+		SubclassOf,
+		ObjectPtr,
+	};
+
+	// the FName of Kind<Inner> or TMap<Inner,Inner2>, Inner2 is only used by EKind::Map
+	GMP_API FName ComposeName(EKind Kind, FName Inner, FName Inner2 = NAME_None);
+}  // namespace TypeId
+}  // namespace GMP
@@ -65,14 +65,14 @@ public:
 	FORCEINLINE static FGMPKey ListenObjectMessage(FSigSource InSigSrc, const MSGKEY_TYPE& K, T* Listener, F&& f, GMP::FGMPListenOptions Options = {})
 	{
 		GMP_CHECK_SLOW(InSigSrc);
-		return GetMessageHub()->ListenObjectMessage(K, InSigSrc, Listener, Forward<F>(f), Options);
+		return GetSourceHub(InSigSrc)->ListenObjectMessage(K, InSigSrc, Listener, Forward<F>(f), Options);
 	}
 
 	template<typename T, typename F>
 	FORCEINLINE static FGMPKey ListenWorldMessage(const UWorld* InWorld, const MSGKEY_TYPE& K, T* Listener, F&& f, GMP::FGMPListenOptions Options = {})
 	{
 		GMP_CHECK_SLOW(!!InWorld);
-		return GetMessageHub()->ListenObjectMessage(K, InWorld, Listener, Forward<F>(f), Options);
+		return GetWorldHub(InWorld)->ListenObjectMessage(K, InWorld, Listener, Forward<F>(f), Options);
 	}
 	template<typename T, typename F>
 	FORCEINLINE static FGMPKey ListenWorldMessage(const UObject* WorldContext, const MSGKEY_TYPE& K, T* Listener, F&& f, GMP::FGMPListenOptions Options = {})
@@ -84,21 +84,21 @@ public:
 	FORCEINLINE static auto SendObjectMessage(FSigSource InSigSrc, const FMSGKEYFind& K, TArgs&&... Args)
 	{
 		GMP_CHECK_SLOW(InSigSrc);
-		return GetMessageHub()->SendObjectMessage(K, InSigSrc, Forward<TArgs>(Args)...);
+		return GetSourceHub(InSigSrc)->SendObjectMessage(K, InSigSrc, Forward<TArgs>(Args)...);
 	}
 
 	template<typename... TArgs>
 	FORCEINLINE static auto NotifyObjectMessage(FSigSource InSigSrc, const FMSGKEYFind& K, TArgs&&... Args)
 	{
 		GMP_CHECK_SLOW(InSigSrc);
-		return GetMessageHub()->SendObjectMessage(K, InSigSrc, NoRef(Args)...);
+		return GetSourceHub(InSigSrc)->SendObjectMessage(K, InSigSrc, NoRef(Args)...);
 	}
 
 	template<typename... TArgs>
 	FORCEINLINE static auto SendWorldMessage(const UWorld* InWorld, const FMSGKEYFind& K, TArgs&&... Args)
 	{
 		GMP_CHECK_SLOW(!!InWorld);
-		return GetMessageHub()->SendObjectMessage(K, InWorld, Forward<TArgs>(Args)...);
+		return GetWorldHub(InWorld)->SendObjectMessage(K, InWorld, Forward<TArgs>(Args)...);
 	}
 	template<typename... TArgs>
 	FORCEINLINE static auto SendWorldMessage(const UObject* WorldContext, const FMSGKEYFind& K, TArgs&&... Args)
@@ -110,7 +110,7 @@ public:
 	FORCEINLINE static auto NotifyWorldMessage(const UWorld* InWorld, const FMSGKEYFind& K, TArgs&&... Args)
 	{
 		GMP_CHECK_SLOW(!!InWorld);
-		return GetMessageHub()->SendObjectMessage(K, InWorld, NoRef(Args)...);
+		return GetWorldHub(InWorld)->SendObjectMessage(K, InWorld, NoRef(Args)...);
 	}
 	template<typename... TArgs>
 	FORCEINLINE static auto NotifyWorldMessage(const UObject* WorldContext, const FMSGKEYFind& K, TArgs&&... Args)
@@ -162,7 +162,7 @@ public:
 		return Hub::ApplyMessageBoy(Body, Lambda);
 	}
 
-	FORCEINLINE static bool ScriptNotifyMessage(const FMSGKEYAny& K, FTypedAddresses& Param, FSigSource SigSource = FSigSource::NullSigSrc) { return GetMessageHub()->ScriptNotifyMessage(K, Param, SigSource); }
+	FORCEINLINE static bool ScriptNotifyMessage(const FMSGKEYAny& K, FTypedAddresses& Param, FSigSource SigSource = FSigSource::NullSigSrc) { return GetSourceHub(SigSource)->ScriptNotifyMessage(K, Param, SigSource); }
 
 	template<typename T, typename F>
 	FORCEINLINE static FGMPKey ScriptListenMessage(const FName& K, T* Listener, F&& f, GMP::FGMPListenOptions Options = {})
@@ -174,7 +174,7 @@ public:
 	FORCEINLINE static FGMPKey ScriptListenMessage(FSigSource WatchedObj, const FName& K, T* Listener, F&& f, GMP::FGMPListenOptions Options = {})
 	{
 		GMP_CHECK_SLOW(Listener);
-		return GetMessageHub()->ScriptListenMessage(WatchedObj, K, Listener, Forward<F>(f), Options);
+		return GetSourceHub(WatchedObj)->ScriptListenMessage(WatchedObj, K, Listener, Forward<F>(f), Options);
 	}
 
 	static void ScriptUnbindMessage(const FMSGKEYAny& K, const UObject* Listener);
@@ -186,7 +186,22 @@ public:
 
 	static FMessageBody* GetCurrentMessageBody();
 	static UGMPManager* GetManager();
+	// the global hub, carries everything not bound to a game world and all cross-world traffic
 	static FMessageHub* GetMessageHub();
+
+	// with gmp.hub.perworld each game world owns a hub for the listeners bound to its objects
+	// listeners without a source stay on the global hub and still hear the sends of every world
+	// they run after all world listeners of the send, FGMPListenOrder only sorts slots within one hub
+	static bool bPerWorldHub;
+	FORCEINLINE static bool IsPerWorldHub() { return bPerWorldHub; }
+	FORCEINLINE static FMessageHub* GetWorldHub(const UWorld* InWorld) { return bPerWorldHub ? GetWorldHubImpl(InWorld) : GetMessageHub(); }
+	// the hub of the world InSigSrc lives in
+	FORCEINLINE static FMessageHub* GetSourceHub(FSigSource InSigSrc) { return bPerWorldHub ? GetSourceHubImpl(InSigSrc) : GetMessageHub(); }
+	static void ForEachHub(TFunctionRef<void(FMessageHub&)> Func);
+
+private:
+	static FMessageHub* GetWorldHubImpl(const UWorld* InWorld);
+	static FMessageHub* GetSourceHubImpl(FSigSource InSigSrc);
 };
 
 class GMP_API FGMPModuleUtils
@@ -12,6 +12,46 @@
 #define WITH_GMPVALUE_ONEOF 1
 #endif
 
+USTRUCT()
+struct GMP_API FGMPValuePathStep
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	FString Key;
+	// array element when not INDEX_NONE
+	UPROPERTY()
+	int32 Index = INDEX_NONE;
+	// case insensitive hash of Key, int32 to stay a blueprint literal
+	UPROPERTY()
+	int32 Hash = 0;
+	UPROPERTY()
+	bool bAscii = true;
+};
+
+// a path like a.b[3].c parsed once into hashed member keys and element indices
+USTRUCT(BlueprintType)
+struct GMP_API FGMPValuePath
+{
+	GENERATED_BODY()
+public:
+	FGMPValuePath() = default;
+	explicit FGMPValuePath(const FString& InPath) { Compile(InPath); }
+
+	bool Compile(const FString& InPath, FString* OutError = nullptr);
+	bool IsCompiled() const { return PathHash != 0 || Path.IsEmpty(); }
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GMP")
+	FString Path;
+
+	UPROPERTY()
+	TArray<FGMPValuePathStep> Steps;
+
+	// identifies the path in per document caches
+	UPROPERTY()
+	int64 PathHash = 0;
+};
+
 USTRUCT(BlueprintType, BlueprintInternalUseOnly)
 struct GMP_API FGMPValueOneOf
 {
@@ -40,6 +80,17 @@ public:
 #endif
 	}
 
+	// json only, resolved nodes are cached by the underlying document
+	template<typename T>
+	bool AsValue(T& Out, const FGMPValuePath& Path) const
+	{
+#if WITH_GMPVALUE_ONEOF
+		return AsValueImpl(GMP::TClass2Prop<T>::GetProperty(), &Out, Path);
+#else
+		return false;
+#endif
+	}
+
 	template<typename T>
 	bool AsStruct(T& Out, FName SubKey = {}, UScriptStruct* StructType = GMP::TypeTraits::StaticStruct<T>()) const
 	{
@@ -60,7 +111,9 @@ public:
 	int32 IterateKeyValue(int32 Idx, FString& OutKey, FGMPValueOneOf& OutValue) const { return IterateKeyValueImpl(Idx, OutKey, OutValue); }
 
 	bool LoadFromFile(const FString& FilePath, bool bBinary = false);
+	// the text is kept and indexed on first access, members are decoded when read
 	bool FromJsonStr(const FStringView& Content);
+	bool FromJsonBuf(TArray<uint8> Utf8Content);
 	bool ToJsonStr(FString& Out) const;
 	FGMPValueOneOf SubValueOf(FName SubKey) const
 	{
@@ -80,6 +133,7 @@ protected:
 	bool AsStructImpl(UScriptStruct* Struct, void* Out, FName SubKey, bool bBinary = false) const { return AsValueImpl(GMP::Class2Prop::TTraitsStructBase::GetProperty(Struct), Out, SubKey, bBinary); }
 	bool AsValueImpl(FProperty* Prop, void* Out, TConstArrayView<FName> SubKeys, bool bBinary = false) const;
 	bool AsStructImpl(UScriptStruct* Struct, void* Out, TConstArrayView<FName> SubKeys, bool bBinary = false) const { return AsValueImpl(GMP::Class2Prop::TTraitsStructBase::GetProperty(Struct), Out, SubKeys, bBinary); }
+	bool AsValueImpl(FProperty* Prop, void* Out, const FGMPValuePath& Path) const;
 	// zero if err or next index otherwise INDEX_NONE
 	int32 IterateKeyValueImpl(int32 Idx, FString& OutKey, FGMPValueOneOf& OutValue, bool bBinary = false) const;
 
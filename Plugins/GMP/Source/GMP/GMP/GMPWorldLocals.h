@@ -231,7 +231,6 @@ namespace WorldLocals
 							if (Container[i].WeakCtx == InWorld)
 							{
 								Container.RemoveAt(i);
-								--i;
 							}
 						}
 						// Container.Shrink();
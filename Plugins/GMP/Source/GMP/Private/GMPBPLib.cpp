@@ -24,6 +24,9 @@
 #include "UnrealEd.h"
 #endif
 #include "HAL/IConsoleManager.h"
+#include "Misc/DelayedAutoRegister.h"
+
+#include <atomic>
 
 //////////////////////////////////////////////////////////////////////////
 DEFINE_LOG_CATEGORY(LogGMP);
@@ -34,8 +37,18 @@ void GMPTraceEnterBP(const FString& MsgStr, FString&& Loc);
 void GMPTraceLeaveBP(const FString& MsgStr);
 struct FGMPTraceBPGuard
 {
+	FGMPTraceBPGuard(FName MsgKey)
+		: KeyStr(MsgKey.ToString())
+		, KeyRef(KeyStr)
+	{
+		Enter();
+	}
 	FGMPTraceBPGuard(const FString& MsgStr)
 		: KeyRef(MsgStr)
+	{
+		Enter();
+	}
+	void Enter()
 	{
 		TStringBuilder<1024> Loc;
 #if DO_BLUEPRINT_GUARD
@@ -51,11 +64,13 @@ struct FGMPTraceBPGuard
 		GMPTraceEnterBP(KeyRef, Loc.ToString());
 	}
 	~FGMPTraceBPGuard() { GMPTraceLeaveBP(KeyRef); }
+	FString KeyStr;
 	const FString& KeyRef;
 };
 #else
 struct FGMPTraceBPGuard
 {
+	FGMPTraceBPGuard(FName MsgKey) {}
 	FGMPTraceBPGuard(const FString& MsgStr) {}
 	~FGMPTraceBPGuard() {}
 };
@@ -159,7 +174,15 @@ int32 GetPropertyCustomIndex(FProperty* Property)
 	return -1;
 }
 
-FORCEINLINE bool BPLibNotifyMessage(const FString& MessageId, const FGMPObjNamePair& SigPair, FTypedAddresses& Params, uint8 Type, UGMPManager* Mgr)
+// an explicit manager keeps its own hub, otherwise the world of the source picks one
+static GMP::FMessageHub& BPLibGetHub(UGMPManager* Mgr, const UObject* SigObj)
+{
+	return Mgr ? Mgr->GetHub() : *GMP::FMessageUtils::GetSourceHub(SigObj);
+}
+
+// KeyType is the FString of dynamic keys or the FName baked by K2 nodes
+template<typename KeyType>
+FORCEINLINE bool BPLibNotifyMessage(const KeyType& MessageId, const FGMPObjNamePair& SigPair, FTypedAddresses& Params, uint8 Type, UGMPManager* Mgr)
 {
 	do
 	{
@@ -183,10 +206,9 @@ FORCEINLINE bool BPLibNotifyMessage(const FString& MessageId, const FGMPObjNameP
 		}
 
 		auto SigSource = GMP::FSigSource::FindObjNameFilter(SigPair.Obj, SigPair.TagName);
-		Mgr = Mgr ? Mgr : FMessageUtils::GetManager();
 
 		GMP::FMessageHub::FTagTypeSetter SetMsgTagType(GMP::FMessageHub::GetBlueprintTagType());
-		return Mgr->GetHub().ScriptNotifyMessage(MessageId, Params, SigSource);
+		return BPLibGetHub(Mgr, SigPair.Obj).ScriptNotifyMessage(MessageId, Params, SigSource);
 	} while (0);
 	return false;
 }
@@ -294,6 +316,85 @@ static bool bLogGMPBPExecution = false;
 static FAutoConsoleVariableRef CVar_DrawAbilityVisualizer(TEXT("GMP.LogGMPBPExecution"), bLogGMPBPExecution, TEXT("log each blueprint gmp exectuion"), ECVF_Default);
 #endif
 extern bool IsGMPModuleInited();
+
+// the stepped property of a compiled node is the same on every call, so its type name is resolved once
+// properties die with their classes, a gc bumps the epoch and drops every entry
+// so do the reflection cache invalidations, a recompiled struct keeps its property but may change its name
+namespace BPTypeCheck
+{
+#if GMP_WITH_TYPENAME
+	static std::atomic<uint32> CacheEpoch{1};
+	static FDelayedAutoRegisterHelper DelayOnObjectSystemReady(EDelayedRegisterRunPhase::ObjectSystemReady, [] {
+		FCoreUObjectDelegates::GetPostGarbageCollect().AddLambda([] { CacheEpoch.fetch_add(1, std::memory_order_relaxed); });
+		GMP::Reflection::OnReflectionCachesInvalidated().AddLambda([] { CacheEpoch.fetch_add(1, std::memory_order_relaxed); });
+	});
+
+	struct FEntry
+	{
+		const FProperty* Prop = nullptr;
+		uint32 Enums = 0;
+		uint32 Epoch = 0;
+		FName TypeName;
+	};
+	// enums of GetPropertyName(Prop) without a class triple
+	static const uint32 ExactTypeEnums = 1u << 24;
+
+	static FORCEINLINE FEntry& FindEntry(const FProperty* Prop, uint32 Enums, bool& bHit)
+	{
+		static thread_local FEntry Entries[256];
+		const uint32 Epoch = CacheEpoch.load(std::memory_order_relaxed);
+		FEntry& Entry = Entries[(PointerHash(Prop) ^ Enums) & 255];
+		bHit = Entry.Prop == Prop && Entry.Enums == Enums && Entry.Epoch == Epoch;
+		if (!bHit)
+		{
+			Entry.Prop = Prop;
+			Entry.Enums = Enums;
+			Entry.Epoch = Epoch;
+		}
+		return Entry;
+	}
+
+	static FName ExactTypeName(const FProperty* Prop)
+	{
+		bool bHit = false;
+		FEntry& Entry = FindEntry(Prop, ExactTypeEnums, bHit);
+		if (!bHit)
+			Entry.TypeName = Reflection::GetPropertyName(Prop);
+		return Entry.TypeName;
+	}
+#endif
+
+#if GMP_WITH_DYNAMIC_TYPE_CHECK
+	static bool Matches(FName TypeName, const FProperty* Prop, uint8 PropertyEnum, uint8 ElementEnum, uint8 KeyEnum)
+	{
+		bool bHit = false;
+		FEntry& Entry = FindEntry(Prop, PropertyEnum | (ElementEnum << 8) | (KeyEnum << 16), bHit);
+		if (bHit && Entry.TypeName == TypeName)
+			return true;
+
+		// miss or mismatch, a mismatch is always confirmed with a fresh name
+		Entry.TypeName = Reflection::GetPropertyName(Prop, EGMPPropertyClass(PropertyEnum), EGMPPropertyClass(ElementEnum), EGMPPropertyClass(KeyEnum));
+		return Entry.TypeName == TypeName;
+	}
+#endif
+
+	// evaluates the next argument expression of a variadic call
+	static FORCEINLINE FGMPTypedAddr StepTypedAddr(FFrame& Stack)
+	{
+		Stack.MostRecentPropertyAddress = nullptr;
+		Stack.MostRecentProperty = nullptr;
+		Stack.StepCompiledIn<FProperty>(nullptr);
+
+#if GMP_DEBUGGAME
+		ensureAlways(Stack.MostRecentProperty && Stack.MostRecentPropertyAddress);
+#endif
+		FGMPTypedAddr Addr = FGMPTypedAddr::FromAddr(Stack.MostRecentPropertyAddress);
+#if GMP_WITH_TYPENAME
+		Addr.TypeName = ExactTypeName(Stack.MostRecentProperty);
+#endif
+		return Addr;
+	}
+}  // namespace BPTypeCheck
 }  // namespace GMP
 
 bool UGMPBPLib::UnlistenMessage(const FString& MessageId, UObject* Listener, UGMPManager* Mgr, UObject* Obj)
@@ -303,8 +404,10 @@ bool UGMPBPLib::UnlistenMessage(const FString& MessageId, UObject* Listener, UGM
 	if (ensure(IsGMPModuleInited()))
 #endif
 	{
-		Mgr = Mgr ? Mgr : FMessageUtils::GetManager();
-		Mgr->GetHub().ScriptUnbindMessage(MessageId, Listener ? Listener : Obj);
+		if (Mgr)
+			Mgr->GetHub().ScriptUnbindMessage(MessageId, Listener ? Listener : Obj);
+		else
+			FMessageUtils::ScriptUnbindMessage(MessageId, Listener ? Listener : Obj);
 	}
 	return true;
 }
@@ -314,19 +417,52 @@ bool UGMPBPLib::UnlistenMessageByKey(const FString& MessageId, UObject* Listener
 	return UnlistenMessage(MessageId, Listener, Mgr);
 }
 
+bool UGMPBPLib::UnlistenMessageByName(FName MessageId, UObject* Listener, UGMPManager* Mgr)
+{
+	using namespace GMP;
+#if !UE_BUILD_SHIPPING && !UE_BUILD_TEST
+	if (ensure(IsGMPModuleInited()))
+#endif
+	{
+		if (Mgr)
+			Mgr->GetHub().ScriptUnbindMessage(FMSGKEYFind(FMSGKEY(MessageId)), Listener);
+		else
+			FMessageUtils::ScriptUnbindMessage(FMSGKEY(MessageId), Listener);
+	}
+	return true;
+}
+
 UPackageMap* UGMPBPLib::GetPackageMap(APlayerController* PC)
 {
 	return PC && PC->GetNetConnection() ? PC->GetNetConnection()->PackageMap : nullptr;
 }
 
+bool UGMPBPLib::ConsumeMessage(UGMPManager* Mgr)
+{
+	using namespace GMP;
+	if (!IsGMPModuleInited())
+		return false;
+
+	auto Body = Mgr ? Mgr->GetHub().GetCurrentMessageBody() : FMessageUtils::GetCurrentMessageBody();
+	if (!ensureMsgf(Body, TEXT("ConsumeMessage called outside of a message listener")))
+		return false;
+
+	Body->Consume();
+	return true;
+}
+
 bool UGMPBPLib::HasAnyListeners(FName InMsgKey, UGMPManager* Mgr)
 {
 	using namespace GMP;
 	if (!IsGMPModuleInited())
 		return false;
 
-	Mgr = Mgr ? Mgr : FMessageUtils::GetManager();
-	return Mgr->GetHub().IsAlive(InMsgKey);
+	if (Mgr)
+		return Mgr->GetHub().IsAlive(InMsgKey);
+
+	bool bAlive = false;
+	FMessageUtils::ForEachHub([&](FMessageHub& Hub) { bAlive = bAlive || Hub.IsAlive(InMsgKey); });
+	return bAlive;
 }
 
 bool UGMPBPLib::NotifyMessageByKeyRet(const FString& MessageId, const FGMPObjNamePair& SigSource, TArray<FGMPTypedAddr>& Params, uint8 Type, UGMPManager* Mgr)
@@ -352,8 +488,7 @@ void UGMPBPLib::ResponseMessage(FGMPKey RspKey, TArray<FGMPTypedAddr>& Params, U
 #endif
 	{
 		FTypedAddresses Arr(Params);
-		Mgr = Mgr ? Mgr : FMessageUtils::GetManager();
-		Mgr->GetHub().ScriptResponseMessage(RspKey, Arr, SigSource);
+		BPLibGetHub(Mgr, SigSource).ScriptResponseMessage(RspKey, Arr, SigSource);
 	}
 }
 
@@ -374,15 +509,7 @@ DEFINE_FUNCTION(UGMPBPLib::execResponseMessageVariadic)
 	FTypedAddresses Params;
 	while (Stack.PeekCode() != EX_EndFunctionParms)
 	{
-		Stack.MostRecentPropertyAddress = nullptr;
-		Stack.MostRecentProperty = nullptr;
-		Stack.StepCompiledIn<FProperty>(nullptr);
-
-#if GMP_DEBUGGAME
-		ensureAlways(Stack.MostRecentProperty && Stack.MostRecentPropertyAddress);
-#endif
-
-		Params.Add(FGMPTypedAddr::FromAddr(Stack.MostRecentPropertyAddress, Stack.MostRecentProperty));
+		Params.Add(BPTypeCheck::StepTypedAddr(Stack));
 	}
 	P_FINISH
 
@@ -391,15 +518,14 @@ DEFINE_FUNCTION(UGMPBPLib::execResponseMessageVariadic)
 	if (ensureWorld(Stack.Object, IsGMPModuleInited()))
 #endif
 	{
-		Mgr = Mgr ? Mgr : FMessageUtils::GetManager();
 		GMP::FMessageHub::FTagTypeSetter SetMsgTagType(GMP::FMessageHub::GetBlueprintTagType());
-		Mgr->GetHub().ScriptResponseMessage(RspKey, Params, SigSource);
+		BPLibGetHub(Mgr, SigSource).ScriptResponseMessage(RspKey, Params, SigSource);
 	}
 	P_NATIVE_END
 #endif
 }
 
-FGMPTypedAddr UGMPBPLib::ListenMessageByKey(FName MessageKey, const FGMPScriptDelegate& Delegate, int32 Times, int32 Order, uint8 Type, UGMPManager* Mgr, const FGMPObjNamePair& SigPair)
+FGMPTypedAddr UGMPBPLib::ListenMessageByKey(FName MessageKey, const FGMPScriptDelegate& Delegate, int32 Times, int32 Order, bool bObserveConsumed, uint8 Type, UGMPManager* Mgr, const FGMPObjNamePair& SigPair)
 {
 #if GMP_TRACE_MSG_STACK
 	FString MsgStr = MessageKey.ToString();
@@ -434,10 +560,10 @@ FGMPTypedAddr UGMPBPLib::ListenMessageByKey(FName MessageKey, const FGMPScriptDe
 				break;
 		}
 
-		Mgr = Mgr ? Mgr : FMessageUtils::GetManager();
+		auto& Hub = BPLibGetHub(Mgr, SigPair.Obj);
 		auto SigSource = GMP::FSigSource::MakeObjNameFilter(SigPair.Obj, SigPair.TagName);
 #if GMP_WITH_DYNAMIC_CALL_CHECK
-		if (Mgr->GetHub().IsAlive(MessageKey, Listener, SigSource))
+		if (Hub.IsAlive(MessageKey, Listener, SigSource))
 		{
 			auto DebugStr = FString::Printf(TEXT("%s<-%s"), *MessageKey.ToString(), *Delegate.ToString<UObject>());
 			const bool AssetFlag = false;
@@ -445,7 +571,7 @@ FGMPTypedAddr UGMPBPLib::ListenMessageByKey(FName MessageKey, const FGMPScriptDe
 		}
 #endif
 		GMP::FMessageHub::FTagTypeSetter SetMsgTagType(GMP::FMessageHub::GetBlueprintTagType());
-		auto Id = Mgr->GetHub().ScriptListenMessage(SigSource,
+		auto Id = Hub.ScriptListenMessage(SigSource,
 													MessageKey,
 													Listener,
 													[Delegate](FMessageBody& Msg) {
@@ -456,7 +582,7 @@ FGMPTypedAddr UGMPBPLib::ListenMessageByKey(FName MessageKey, const FGMPScriptDe
 														auto Arr = Msg.Parameters();
 														Delegate.ExecuteIfBound(Msg.GetSigSource(), Msg.MessageKey(), Msg.Sequence(), Arr);
 													},
-													{Times, Order});
+													GMP::FGMPListenOptions(Times, Order).ObserveConsumed(bObserveConsumed));
 		if (!Id)
 			break;
 		ret.Value = Id;
@@ -464,25 +590,24 @@ FGMPTypedAddr UGMPBPLib::ListenMessageByKey(FName MessageKey, const FGMPScriptDe
 	return ret;
 }
 
-FGMPTypedAddr UGMPBPLib::ListenMessageByKeyValidate(const TArray<FName>& ArgNames, FName MessageKey, const FGMPScriptDelegate& Delegate, int32 Times, int32 Order, uint8 Type, UGMPManager* Mgr, const FGMPObjNamePair& SigPair)
+FGMPTypedAddr UGMPBPLib::ListenMessageByKeyValidate(const TArray<FName>& ArgNames, FName MessageKey, const FGMPScriptDelegate& Delegate, int32 Times, int32 Order, bool bObserveConsumed, uint8 Type, UGMPManager* Mgr, const FGMPObjNamePair& SigPair)
 {
 #if GMP_WITH_DYNAMIC_CALL_CHECK
 	using namespace GMP;
-	Mgr = Mgr ? Mgr : FMessageUtils::GetManager();
 	const FArrayTypeNames* OldParams = nullptr;
 	{
 		GMP::FMessageHub::FTagTypeSetter SetMsgTagType(GMP::FMessageHub::GetBlueprintTagType());
-		if (!Mgr->GetHub().IsSignatureCompatible(false, MessageKey, FArrayTypeNames(ArgNames), OldParams))
+		if (!FMessageHub::IsSignatureCompatible(false, MessageKey, FArrayTypeNames(ArgNames), OldParams))
 		{
 			ensureAlwaysMsgf(false, TEXT("SignatureMismatch On Listen %s"), *MessageKey.ToString());
 			return FGMPTypedAddr{0};
 		}
 	}
 #endif
-	return ListenMessageByKey(MessageKey, Delegate, Times, Order, Type, Mgr, SigPair);
+	return ListenMessageByKey(MessageKey, Delegate, Times, Order, bObserveConsumed, Type, Mgr, SigPair);
 }
 
-FGMPTypedAddr UGMPBPLib::ListenMessageViaKey(UObject* Listener, FName MessageKey, FName EventName, int32 Times, int32 Order, uint8 Type, uint8 BodyDataMask, UGMPManager* Mgr, const FGMPObjNamePair& SigPair)
+FGMPTypedAddr UGMPBPLib::ListenMessageViaKey(UObject* Listener, FName MessageKey, FName EventName, int32 Times, int32 Order, bool bObserveConsumed, uint8 Type, uint8 BodyDataMask, UGMPManager* Mgr, const FGMPObjNamePair& SigPair)
 {
 #if GMP_TRACE_MSG_STACK
 	FString MsgStr = MessageKey.ToString();
@@ -516,10 +641,10 @@ FGMPTypedAddr UGMPBPLib::ListenMessageViaKey(UObject* Listener, FName MessageKey
 				break;
 		}
 
-		Mgr = Mgr ? Mgr : FMessageUtils::GetManager();
+		auto& Hub = BPLibGetHub(Mgr, SigPair.Obj ? SigPair.Obj : (UObject*)World);
 		auto SigSource = GMP::FSigSource::MakeObjNameFilter(SigPair.Obj ? SigPair.Obj : (UObject*)World, SigPair.TagName);
 #if GMP_WITH_DYNAMIC_CALL_CHECK
-		if (Mgr->GetHub().IsAlive(MessageKey, Listener, SigSource))
+		if (Hub.IsAlive(MessageKey, Listener, SigSource))
 		{
 			auto DebugStr = FString::Printf(TEXT("existed %s<-%s.%s"), *MessageKey.ToString(), *GetNameSafe(Listener), *EventName.ToString());
 			static bool AssetFlag = false;
@@ -528,7 +653,7 @@ FGMPTypedAddr UGMPBPLib::ListenMessageViaKey(UObject* Listener, FName MessageKey
 		}
 #endif
 		//GMP::FMessageHub::FTagTypeSetter SetMsgTagType(GMP::FMessageHub::GetBlueprintTagType());
-		auto Id = Mgr->GetHub().ScriptListenMessage(
+		auto Id = Hub.ScriptListenMessage(
 			SigSource,
 			MessageKey,
 			Listener,
@@ -575,7 +700,7 @@ FGMPTypedAddr UGMPBPLib::ListenMessageViaKey(UObject* Listener, FName MessageKey
 #endif
 				CallMessageFunction(Listener, Function, Params);
 			},
-			{Times, Order});
+			GMP::FGMPListenOptions(Times, Order).ObserveConsumed(bObserveConsumed));
 		if (!Id)
 			break;
 		ret.Value = Id;
@@ -584,25 +709,34 @@ FGMPTypedAddr UGMPBPLib::ListenMessageViaKey(UObject* Listener, FName MessageKey
 }
 
 FGMPTypedAddr
-	UGMPBPLib::ListenMessageViaKeyValidate(const TArray<FName>& ArgNames, UObject* Listener, FName MessageKey, FName EventName, int32 Times, int32 Order, uint8 Type, uint8 BodyDataMask, UGMPManager* Mgr, const FGMPObjNamePair& SigPair)
+	UGMPBPLib::ListenMessageViaKeyValidate(const TArray<FName>& ArgNames, UObject* Listener, FName MessageKey, FName EventName, int32 Times, int32 Order, bool bObserveConsumed, uint8 Type, uint8 BodyDataMask, UGMPManager* Mgr, const FGMPObjNamePair& SigPair)
 {
 #if GMP_WITH_DYNAMIC_CALL_CHECK
 	using namespace GMP;
-	Mgr = Mgr ? Mgr : FMessageUtils::GetManager();
 	{
 		const FArrayTypeNames* OldParams = nullptr;
 		GMP::FMessageHub::FTagTypeSetter SetMsgTagType(GMP::FMessageHub::GetBlueprintTagType());
-		if (!Mgr->GetHub().IsSignatureCompatible(false, MessageKey, FArrayTypeNames(ArgNames), OldParams))
+		if (!FMessageHub::IsSignatureCompatible(false, MessageKey, FArrayTypeNames(ArgNames), OldParams))
 		{
 			ensureAlwaysMsgf(false, TEXT("SignatureMismatch On Listen %s"), *MessageKey.ToString());
 			return FGMPTypedAddr{0};
 		}
 	}
 #endif
-	return ListenMessageViaKey(Listener, MessageKey, EventName, Times, Order, Type, BodyDataMask, Mgr, SigPair);
+	return ListenMessageViaKey(Listener, MessageKey, EventName, Times, Order, bObserveConsumed, Type, BodyDataMask, Mgr, SigPair);
+}
+
+static FString BPLibKeyToString(const FString& MessageKey)
+{
+	return MessageKey;
+}
+static FString BPLibKeyToString(FName MessageKey)
+{
+	return MessageKey.ToString();
 }
 
-static FGMPKey RequestMessageImpl(FGMPKey& RspKey, FName EventName, const FString& MessageKey, const FGMPObjNamePair& SigPair, GMP::FTypedAddresses& Params, uint8 Type, UGMPManager* Mgr)
+template<typename KeyType>
+static FGMPKey RequestMessageImpl(FGMPKey& RspKey, FName EventName, const KeyType& MessageKey, const FGMPObjNamePair& SigPair, GMP::FTypedAddresses& Params, uint8 Type, UGMPManager* Mgr)
 {
 	GMP::FGMPTraceBPGuard Guard(MessageKey);
 
@@ -639,11 +773,11 @@ static FGMPKey RequestMessageImpl(FGMPKey& RspKey, FName EventName, const FStrin
 				break;
 		}
 
-		Mgr = Mgr ? Mgr : FMessageUtils::GetManager();
+		auto& Hub = BPLibGetHub(Mgr, Sender);
 #if GMP_WITH_DYNAMIC_CALL_CHECK
-		if (Mgr->GetHub().IsResponseOn(RspKey))
+		if (Hub.IsResponseOn(RspKey))
 		{
-			auto DebugStr = FString::Printf(TEXT("%s<-%s.%s"), *MessageKey, *GetNameSafe(Sender), *EventName.ToString());
+			auto DebugStr = FString::Printf(TEXT("%s<-%s.%s"), *BPLibKeyToString(MessageKey), *GetNameSafe(Sender), *EventName.ToString());
 			static bool AssetFlag = false;
 			ensureWorldMsgf(World, AssetFlag, TEXT("%s"), *DebugStr);
 			break;
@@ -691,7 +825,7 @@ static FGMPKey RequestMessageImpl(FGMPKey& RspKey, FName EventName, const FStrin
 #endif
 
 		GMP::FMessageHub::FTagTypeSetter SetMsgTagType(GMP::FMessageHub::GetBlueprintTagType());
-		RspKey = Mgr->GetHub().ScriptRequestMessage(MessageKey, Params, MoveTemp(RspLambda), Sender);
+		RspKey = Hub.ScriptRequestMessage(MessageKey, Params, MoveTemp(RspLambda), Sender);
 	} while (0);
 	return RspKey;
 }
@@ -702,12 +836,13 @@ bool UGMPBPLib::RequestMessageRet(FGMPKey& RspKey, FName EventName, const FStrin
 	return RequestMessageImpl(RspKey, EventName, MessageKey, SigPair, RspParams, Type, Mgr).IsValid();
 }
 
+template<typename KeyPropType>
 bool execRequestMessageVariadicRetGet(FFrame& Stack, RESULT_DECL)
 {
 	using namespace GMP;
 	P_GET_STRUCT_REF(FGMPKey, RspKey);
 	PARAM_PASSED_BY_VAL(EventName, FNameProperty, FName);
-	P_GET_PROPERTY(FStrProperty, MessageKey);
+	P_GET_PROPERTY(KeyPropType, MessageKey);
 	P_GET_STRUCT_REF(FGMPObjNamePair, SigSource);
 	P_GET_PROPERTY(FByteProperty, Type);
 	P_GET_OBJECT(UGMPManager, Mgr);
@@ -721,15 +856,7 @@ bool execRequestMessageVariadicRetGet(FFrame& Stack, RESULT_DECL)
 	FTypedAddresses Params;
 	while (Stack.PeekCode() != EX_EndFunctionParms)
 	{
-		Stack.MostRecentPropertyAddress = nullptr;
-		Stack.MostRecentProperty = nullptr;
-		Stack.StepCompiledIn<FProperty>(nullptr);
-
-#if GMP_DEBUGGAME
-		ensureAlways(Stack.MostRecentProperty && Stack.MostRecentPropertyAddress);
-#endif
-
-		Params.Add(FGMPTypedAddr::FromAddr(Stack.MostRecentPropertyAddress, Stack.MostRecentProperty));
+		Params.Add(BPTypeCheck::StepTypedAddr(Stack));
 	}
 	P_FINISH
 	P_NATIVE_BEGIN
@@ -740,11 +867,19 @@ bool execRequestMessageVariadicRetGet(FFrame& Stack, RESULT_DECL)
 
 DEFINE_FUNCTION(UGMPBPLib::execRequestMessageVariadicRet)
 {
-	*(bool*)RESULT_PARAM = execRequestMessageVariadicRetGet(Stack, RESULT_PARAM);
+	*(bool*)RESULT_PARAM = execRequestMessageVariadicRetGet<FStrProperty>(Stack, RESULT_PARAM);
 }
 DEFINE_FUNCTION(UGMPBPLib::execRequestMessageVariadic)
 {
-	execRequestMessageVariadicRetGet(Stack, RESULT_PARAM);
+	execRequestMessageVariadicRetGet<FStrProperty>(Stack, RESULT_PARAM);
+}
+DEFINE_FUNCTION(UGMPBPLib::execRequestMessageByNameVariadicRet)
+{
+	*(bool*)RESULT_PARAM = execRequestMessageVariadicRetGet<FNameProperty>(Stack, RESULT_PARAM);
+}
+DEFINE_FUNCTION(UGMPBPLib::execRequestMessageByNameVariadic)
+{
+	execRequestMessageVariadicRetGet<FNameProperty>(Stack, RESULT_PARAM);
 }
 
 void UGMPBPLib::InnerSet(FFrame& Stack, uint8 PropertyEnum /*= -1*/, uint8 ElementEnum /*= -1*/, uint8 KeyEnum /*= -1*/)
@@ -773,7 +908,7 @@ void UGMPBPLib::InnerSet(FFrame& Stack, uint8 PropertyEnum /*= -1*/, uint8 Eleme
 	void* ItemPtr = Stack.MostRecentPropertyAddress;
 
 #if GMP_WITH_DYNAMIC_TYPE_CHECK
-	if (!ensureWorld(Stack.Object, ArrayAddr->IsValidIndex(Index) && (*ArrayAddr)[Index].TypeName == Reflection::GetPropertyName(InProperty, EGMPPropertyClass(PropertyEnum), EGMPPropertyClass(ElementEnum), EGMPPropertyClass(KeyEnum))))
+	if (!ensureWorld(Stack.Object, ArrayAddr->IsValidIndex(Index) && BPTypeCheck::Matches((*ArrayAddr)[Index].TypeName, InProperty, PropertyEnum, ElementEnum, KeyEnum)))
 	{
 		FFrame::KismetExecutionMessage(TEXT("Invalid Param"), ELogVerbosity::Warning, TEXT("TypeError"));
 		return;
@@ -821,7 +956,7 @@ void UGMPBPLib::InnerGet(FFrame& Stack, uint8 PropertyEnum, uint8 ElementEnum, u
 	void* ItemPtr = Stack.MostRecentPropertyAddress;
 
 #if GMP_WITH_DYNAMIC_TYPE_CHECK
-	if (!ensureWorld(Stack.Object, ArrayAddr->IsValidIndex(Index) && (*ArrayAddr)[Index].TypeName == Reflection::GetPropertyName(OutProperty, EGMPPropertyClass(PropertyEnum), EGMPPropertyClass(ElementEnum), EGMPPropertyClass(KeyEnum))))
+	if (!ensureWorld(Stack.Object, ArrayAddr->IsValidIndex(Index) && BPTypeCheck::Matches((*ArrayAddr)[Index].TypeName, OutProperty, PropertyEnum, ElementEnum, KeyEnum)))
 	{
 		FFrame::KismetExecutionMessage(TEXT("Invalid Param"), ELogVerbosity::Warning, TEXT("TypeError"));
 		return;
@@ -843,10 +978,11 @@ void UGMPBPLib::InnerGet(FFrame& Stack, uint8 PropertyEnum, uint8 ElementEnum, u
 }
 
 //////////////////////////////////////////////////////////////////////////
+template<typename KeyPropType>
 bool execNotifyMessageByKeyVariadicGet(FFrame& Stack, RESULT_DECL)
 {
 	using namespace GMP;
-	P_GET_PROPERTY(FStrProperty, MessageId);
+	P_GET_PROPERTY(KeyPropType, MessageId);
 	P_GET_STRUCT_REF(FGMPObjNamePair, SigSource);
 	P_GET_PROPERTY(FByteProperty, Type);
 	P_GET_OBJECT(UGMPManager, Mgr);
@@ -860,15 +996,7 @@ bool execNotifyMessageByKeyVariadicGet(FFrame& Stack, RESULT_DECL)
 	FTypedAddresses Params;
 	while (Stack.PeekCode() != EX_EndFunctionParms)
 	{
-		Stack.MostRecentPropertyAddress = nullptr;
-		Stack.MostRecentProperty = nullptr;
-		Stack.StepCompiledIn<FProperty>(nullptr);
-
-#if GMP_DEBUGGAME
-		ensureAlways(Stack.MostRecentProperty && Stack.MostRecentPropertyAddress);
-#endif
-
-		Params.Add(FGMPTypedAddr::FromAddr(Stack.MostRecentPropertyAddress, Stack.MostRecentProperty));
+		Params.Add(BPTypeCheck::StepTypedAddr(Stack));
 	}
 	P_FINISH
 
@@ -880,13 +1008,69 @@ bool execNotifyMessageByKeyVariadicGet(FFrame& Stack, RESULT_DECL)
 
 DEFINE_FUNCTION(UGMPBPLib::execNotifyMessageByKeyVariadicRet)
 {
-	*(bool*)RESULT_PARAM = execNotifyMessageByKeyVariadicGet(Stack, RESULT_PARAM);
+	*(bool*)RESULT_PARAM = execNotifyMessageByKeyVariadicGet<FStrProperty>(Stack, RESULT_PARAM);
 }
 DEFINE_FUNCTION(UGMPBPLib::execNotifyMessageByKeyVariadic)
 {
-	execNotifyMessageByKeyVariadicGet(Stack, RESULT_PARAM);
+	execNotifyMessageByKeyVariadicGet<FStrProperty>(Stack, RESULT_PARAM);
+}
+DEFINE_FUNCTION(UGMPBPLib::execNotifyMessageByNameVariadicRet)
+{
+	*(bool*)RESULT_PARAM = execNotifyMessageByKeyVariadicGet<FNameProperty>(Stack, RESULT_PARAM);
+}
+DEFINE_FUNCTION(UGMPBPLib::execNotifyMessageByNameVariadic)
+{
+	execNotifyMessageByKeyVariadicGet<FNameProperty>(Stack, RESULT_PARAM);
+}
+
+template<int32 N>
+bool execNotifyMessageByNameFixed(FFrame& Stack, RESULT_DECL)
+{
+	using namespace GMP;
+	P_GET_PROPERTY(FNameProperty, MessageId);
+	P_GET_STRUCT_REF(FGMPObjNamePair, SigSource);
+	P_GET_PROPERTY(FByteProperty, Type);
+	P_GET_OBJECT(UGMPManager, Mgr);
+
+#if !GMP_WITH_VARIADIC_SUPPORT
+	FFrame::KismetExecutionMessage(TEXT("version not supported"), ELogVerbosity::Error, TEXT("version not supported"));
+	P_FINISH
+	return false;
+#else
+	static_assert(N <= 8, "arguments have to fit the inline storage of FTypedAddresses");
+	FTypedAddresses Params;
+	Params.SetNumUninitialized(N);
+	for (int32 i = 0; i < N; ++i)
+	{
+		Params[i] = BPTypeCheck::StepTypedAddr(Stack);
+	}
+#if GMP_DEBUGGAME
+	ensureAlways(Stack.PeekCode() == EX_EndFunctionParms);
+#endif
+	P_FINISH
+
+	P_NATIVE_BEGIN
+	return BPLibNotifyMessage(MessageId, SigSource, Params, Type, Mgr);
+	P_NATIVE_END
+#endif
 }
 
+#define GMP_DEFINE_NOTIFY_FIXED(N)                                                                    \
+	DEFINE_FUNCTION(UGMPBPLib::execNotifyMessageByName##N)                                            \
+	{                                                                                                 \
+		*(bool*)RESULT_PARAM = execNotifyMessageByNameFixed<N>(Stack, RESULT_PARAM);                 \
+	}
+GMP_DEFINE_NOTIFY_FIXED(0)
+GMP_DEFINE_NOTIFY_FIXED(1)
+GMP_DEFINE_NOTIFY_FIXED(2)
+GMP_DEFINE_NOTIFY_FIXED(3)
+GMP_DEFINE_NOTIFY_FIXED(4)
+GMP_DEFINE_NOTIFY_FIXED(5)
+GMP_DEFINE_NOTIFY_FIXED(6)
+GMP_DEFINE_NOTIFY_FIXED(7)
+GMP_DEFINE_NOTIFY_FIXED(8)
+#undef GMP_DEFINE_NOTIFY_FIXED
+
 DEFINE_FUNCTION(UGMPBPLib::execAddrFromVariadic)
 {
 	using namespace GMP;
@@ -944,10 +1128,11 @@ void GMPBPLib_SetVariadic(FGMPTypedAddr& Any, FFrame& Stack, uint8 PropertyEnum
 DEFINE_FUNCTION(UGMPBPLib::execSetVariadic)
 {
 	using namespace GMP;
-	UGMPManager* Mgr = FMessageUtils::GetManager();
+	UGMPManager* Mgr = nullptr;
 	Stack.StepCompiledIn<FObjectProperty>(&Mgr);
-	GMP_CHECK(Mgr);
-	auto& Params = Mgr->GetHub().GetCurrentMessageBody()->GetParams();
+	auto Body = Mgr ? Mgr->GetHub().GetCurrentMessageBody() : FMessageUtils::GetCurrentMessageBody();
+	GMP_CHECK(Body);
+	auto& Params = Body->GetParams();
 	Stack.MostRecentProperty = nullptr;
 	P_GET_PROPERTY(FIntProperty, Index);
 #if !GMP_WITH_VARIADIC_SUPPORT
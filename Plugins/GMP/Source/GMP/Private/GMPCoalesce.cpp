@@ -0,0 +1,244 @@
+//  Copyright GenericMessagePlugin, Inc. All Rights Reserved.
+
+#include "GMPCoalesce.h"
+
+#include "GMPCoalesceInternal.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/CoreDelegates.h"
+#include "UnrealCompatibility.h"
+
+namespace GMP
+{
+static bool bEnableCoalescing = true;
+FAutoConsoleVariableRef CVar_EnableCoalescing(TEXT("gmp.flag.coalescing"), bEnableCoalescing, TEXT("0 to dispatch coalesced messages immediately"));
+
+namespace Hub
+{
+	FCoalescedChannels::FCoalescedChannels(FMessageHub* InHub)
+		: TGMPFrameTickBase<FCoalescedChannels>(0.0)
+		, MsgHub(InHub)
+	{
+	}
+
+	FCoalescedChannels::~FCoalescedChannels()
+	{
+		BindFrameDelegates(false);
+		for (auto& Pair : Pending)
+			DestroySlot(Pair.Value);
+		for (int32 Idx = DrainIndex; Idx < Draining.Num(); ++Idx)
+			DestroySlot(Draining[Idx]);
+	}
+
+	bool FCoalescedChannels::Register(const FName& MessageKey, const TArray<FProperty*>& Props, ECoalescedFlushPoint FlushPoint)
+	{
+		if (!ensure(!MessageKey.IsNone()))
+			return false;
+
+		auto Channel = MakeShared<FChannel>();
+		Channel->FlushPoint = FlushPoint;
+		for (auto Prop : Props)
+		{
+			if (!ensureMsgf(Prop, TEXT("coalescing %s with null property"), *MessageKey.ToString()))
+				return false;
+
+			const int32 PropAlign = FMath::Max(Prop->GetMinAlignment(), 1);
+			Channel->Size = Align(Channel->Size, PropAlign);
+			Channel->Align = FMath::Max(Channel->Align, PropAlign);
+			Channel->Props.Add(Prop);
+			Channel->Offsets.Add(Channel->Size);
+#if UE_5_05_OR_LATER
+			Channel->Size += Prop->GetElementSize() * Prop->ArrayDim;
+#else
+			Channel->Size += Prop->ElementSize * Prop->ArrayDim;
+#endif
+		}
+
+		// pending payloads keep the old layout alive until delivered
+		if (Channels.Contains(MessageKey))
+			Flush(MessageKey);
+
+		Channels.Add(MessageKey, MoveTemp(Channel));
+		BindFrameDelegates(true);
+		return true;
+	}
+
+	void FCoalescedChannels::Unregister(const FName& MessageKey)
+	{
+		if (!Channels.Contains(MessageKey))
+			return;
+
+		// the latest value is still delivered
+		Flush(MessageKey);
+		Channels.Remove(MessageKey);
+		if (IsEmpty())
+			BindFrameDelegates(false);
+	}
+
+	void FCoalescedChannels::Inherit(const FCoalescedChannels& Other)
+	{
+		for (auto& Pair : Other.Channels)
+			Channels.Add(Pair.Key, Pair.Value);
+		if (!IsEmpty())
+			BindFrameDelegates(true);
+	}
+
+	bool FCoalescedChannels::TryPark(const FName& MessageKey, FSigSource InSigSrc, const FTypedAddresses& Params, FGMPKey& OutSequence)
+	{
+		if (!bEnableCoalescing)
+			return false;
+
+		auto ChannelPtr = Channels.Find(MessageKey);
+		if (!ChannelPtr)
+			return false;
+
+		auto& Channel = **ChannelPtr;
+		if (!ensureMsgf(Params.Num() == Channel.Props.Num(), TEXT("coalesced message %s expects %d params but got %d"), *MessageKey.ToString(), Channel.Props.Num(), Params.Num()))
+			return false;
+
+		auto& Slot = Pending.FindOrAdd(FSlotKey(MessageKey, InSigSrc));
+		if (!Slot.Data)
+		{
+			Slot.MessageKey = MessageKey;
+			Slot.SigSrc = InSigSrc;
+			if (auto Obj = InSigSrc.TryGetUObject())
+				Slot.WeakSrc = Obj;
+			Slot.Channel = *ChannelPtr;
+			Slot.Data = static_cast<uint8*>(FMemory::Malloc(FMath::Max(Channel.Size, 1), Channel.Align));
+			Slot.Sequence = FMessageBody::GetNextSequenceID();
+			for (int32 Idx = 0; Idx < Channel.Props.Num(); ++Idx)
+				Channel.Props[Idx]->InitializeValue_InContainer(Slot.Data + Channel.Offsets[Idx]);
+		}
+
+		// latest value wins
+		for (int32 Idx = 0; Idx < Channel.Props.Num(); ++Idx)
+			Channel.Props[Idx]->CopyCompleteValue(Slot.Data + Channel.Offsets[Idx], Params[Idx].ToAddr());
+
+		OutSequence = Slot.Sequence;
+		return true;
+	}
+
+	int32 FCoalescedChannels::Flush(const FName& MessageKey, TOptional<ECoalescedFlushPoint> FlushPoint)
+	{
+		for (auto It = Pending.CreateIterator(); It; ++It)
+		{
+			auto& Slot = It->Value;
+			if ((MessageKey.IsNone() || Slot.MessageKey == MessageKey) && (!FlushPoint || Slot.Channel->FlushPoint == FlushPoint.GetValue()))
+			{
+				Draining.Add(MoveTemp(Slot));
+				It.RemoveCurrent();
+			}
+		}
+
+		// nested flush from a listener, the outer loop picks up the appended slots
+		if (bDraining)
+			return 0;
+
+		bDraining = true;
+		DeliveredCnt = 0;
+		TickDelta(0.f);
+		bDraining = false;
+
+		OnFlushed.Broadcast();
+		return DeliveredCnt;
+	}
+
+	bool FCoalescedChannels::Step()
+	{
+		if (!Draining.IsValidIndex(DrainIndex))
+			return false;
+
+		// the array may grow while delivering
+		FSlot Slot = MoveTemp(Draining[DrainIndex++]);
+		Deliver(Slot);
+		DestroySlot(Slot);
+		return Draining.IsValidIndex(DrainIndex);
+	}
+
+	void FCoalescedChannels::Finish()
+	{
+		Draining.Reset();
+		DrainIndex = 0;
+	}
+
+	void FCoalescedChannels::Deliver(FSlot& Slot)
+	{
+		// source destroyed before the flush point
+		if (!Slot.WeakSrc.IsExplicitlyNull() && !Slot.WeakSrc.IsValid())
+			return;
+
+		auto& Channel = *Slot.Channel;
+		FTypedAddresses Params;
+		Params.Reserve(Channel.Props.Num());
+		for (int32 Idx = 0; Idx < Channel.Props.Num(); ++Idx)
+			Params.AddDefaulted_GetRef().SetAddr(Slot.Data + Channel.Offsets[Idx], Channel.Props[Idx]);
+
+		if (MsgHub->FireCoalescedMessage(Slot.MessageKey, Slot.SigSrc, Params))
+			++DeliveredCnt;
+	}
+
+	void FCoalescedChannels::DestroySlot(FSlot& Slot)
+	{
+		if (!Slot.Data)
+			return;
+
+		auto& Channel = *Slot.Channel;
+		for (int32 Idx = 0; Idx < Channel.Props.Num(); ++Idx)
+			Channel.Props[Idx]->DestroyValue_InContainer(Slot.Data + Channel.Offsets[Idx]);
+		FMemory::Free(Slot.Data);
+		Slot.Data = nullptr;
+	}
+
+	void FCoalescedChannels::OnFramePoint(ECoalescedFlushPoint FlushPoint)
+	{
+		Flush(NAME_None, FlushPoint);
+	}
+
+	void FCoalescedChannels::BindFrameDelegates(bool bBind)
+	{
+		if (bBind && !EndFrameHandle.IsValid())
+		{
+			BeginFrameHandle = FCoreDelegates::OnBeginFrame.AddRaw(this, &FCoalescedChannels::OnFramePoint, ECoalescedFlushPoint::BeginOfFrame);
+			EndFrameHandle = FCoreDelegates::OnEndFrame.AddRaw(this, &FCoalescedChannels::OnFramePoint, ECoalescedFlushPoint::EndOfFrame);
+		}
+		else if (!bBind && EndFrameHandle.IsValid())
+		{
+			FCoreDelegates::OnBeginFrame.Remove(BeginFrameHandle);
+			FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+			BeginFrameHandle.Reset();
+			EndFrameHandle.Reset();
+		}
+	}
+}  // namespace Hub
+
+bool FCoalescedMessageUtils::EnableCoalescing(const FName& MessageKey, const TArray<FProperty*>& Props, ECoalescedFlushPoint FlushPoint)
+{
+	GMP_CHECK_SLOW(IsInGameThread());
+	bool bRet = true;
+	FMessageUtils::ForEachHub([&](FMessageHub& Hub) { bRet &= Hub.GetCoalescedChannels().Register(MessageKey, Props, FlushPoint); });
+	return bRet;
+}
+
+void FCoalescedMessageUtils::DisableCoalescing(const FName& MessageKey)
+{
+	GMP_CHECK_SLOW(IsInGameThread());
+	FMessageUtils::ForEachHub([&](FMessageHub& Hub) { Hub.GetCoalescedChannels().Unregister(MessageKey); });
+}
+
+bool FCoalescedMessageUtils::IsCoalesced(const FName& MessageKey)
+{
+	return FMessageUtils::GetMessageHub()->IsCoalesced(MessageKey);
+}
+
+int32 FCoalescedMessageUtils::FlushCoalesced(const FName& MessageKey)
+{
+	GMP_CHECK_SLOW(IsInGameThread());
+	int32 Delivered = 0;
+	FMessageUtils::ForEachHub([&](FMessageHub& Hub) { Delivered += Hub.GetCoalescedChannels().Flush(MessageKey); });
+	return Delivered;
+}
+
+FSimpleMulticastDelegate& FCoalescedMessageUtils::OnCoalescedFlushed()
+{
+	return FMessageUtils::GetMessageHub()->GetCoalescedChannels().OnFlushed;
+}
+}  // namespace GMP
@@ -0,0 +1,78 @@
+//  Copyright GenericMessagePlugin, Inc. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+
+#include "GMPCoalesce.h"
+#include "GMPHub.h"
+#include "GMPTickBase.h"
+#include "UObject/WeakObjectPtr.h"
+
+namespace GMP
+{
+namespace Hub
+{
+	class FCoalescedChannels final : public TGMPFrameTickBase<FCoalescedChannels>
+	{
+	public:
+		FCoalescedChannels(FMessageHub* InHub);
+		~FCoalescedChannels();
+
+		bool Register(const FName& MessageKey, const TArray<FProperty*>& Props, ECoalescedFlushPoint FlushPoint);
+		void Unregister(const FName& MessageKey);
+		// a world hub starts out with the keys coalesced on the global hub
+		void Inherit(const FCoalescedChannels& Other);
+		bool IsCoalesced(const FName& MessageKey) const { return Channels.Contains(MessageKey); }
+		bool IsEmpty() const { return Channels.Num() == 0; }
+
+		// returns false when the payload should be dispatched immediately
+		bool TryPark(const FName& MessageKey, FSigSource InSigSrc, const FTypedAddresses& Params, FGMPKey& OutSequence);
+		int32 Flush(const FName& MessageKey, TOptional<ECoalescedFlushPoint> FlushPoint = {});
+
+		FSimpleMulticastDelegate OnFlushed;
+
+	protected:
+		friend struct TGMPFrameTickBase<FCoalescedChannels>;
+		bool Step();
+		void Finish();
+
+	private:
+		// payload layout shared by every pending slot of a key
+		struct FChannel
+		{
+			TArray<FProperty*> Props;
+			TArray<int32> Offsets;
+			int32 Size = 0;
+			int32 Align = 1;
+			ECoalescedFlushPoint FlushPoint = ECoalescedFlushPoint::EndOfFrame;
+		};
+
+		struct FSlot
+		{
+			FName MessageKey;
+			FSigSource SigSrc;
+			FWeakObjectPtr WeakSrc;
+			TSharedPtr<const FChannel> Channel;
+			uint8* Data = nullptr;
+			FGMPKey Sequence;
+		};
+
+		void Deliver(FSlot& Slot);
+		static void DestroySlot(FSlot& Slot);
+		void OnFramePoint(ECoalescedFlushPoint FlushPoint);
+		void BindFrameDelegates(bool bBind);
+
+		using FSlotKey = TPair<FName, FSigSource>;
+		TMap<FName, TSharedPtr<const FChannel>> Channels;
+		TMap<FSlotKey, FSlot> Pending;
+		TArray<FSlot> Draining;
+		int32 DrainIndex = 0;
+		int32 DeliveredCnt = 0;
+		bool bDraining = false;
+
+		FMessageHub* MsgHub = nullptr;
+		FDelegateHandle BeginFrameHandle;
+		FDelegateHandle EndFrameHandle;
+	};
+}  // namespace Hub
+}  // namespace GMP
@@ -7,6 +7,9 @@
 #include "Algo/BinarySearch.h"
 #include "Algo/ForEach.h"
 #include "Engine/UserDefinedStruct.h"
+#include "GMPCoalesceInternal.h"
+#include "GMPListenerAudit.h"
+#include "GMPMemoryReport.h"
 #include "GMPMeta.h"
 #include "GMPSignalsImpl.h"
 #include "GMPSignalsInc.h"
@@ -14,6 +17,7 @@
 #include "GMPWorldLocals.h"
 #include "HAL/ThreadSingleton.h"
 #include "Misc/ScopeExit.h"
+#include "Misc/ScopeRWLock.h"
 #include "UObject/ObjectKey.h"
 #include "UObject/TextProperty.h"
 #include "UObject/UObjectGlobals.h"
@@ -219,24 +223,25 @@ namespace GMP
 	}
 
 #if UE_5_00_OR_LATER
-	struct FMessageHubVerifier : public FScopeLock
+	// responders validate their hub from any thread, only hub creation and destruction write
+	struct FMessageHubVerifier : public FRWScopeLock
 	{
-		FMessageHubVerifier(FMessageHub* InHub)
-			: FScopeLock(&GetCriticalSection())
+		FMessageHubVerifier(const FMessageHub* InHub, FRWScopeLockType LockType = SLT_Write)
+			: FRWScopeLock(GetLock(), LockType)
 		{
 		}
 
 	private:
-		static FCriticalSection& GetCriticalSection()
+		static FRWLock& GetLock()
 		{
-			static FCriticalSection MessageHubsLock;
+			static FRWLock MessageHubsLock;
 			return MessageHubsLock;
 		}
 	};
 #else
 	struct FMessageHubVerifier
 	{
-		FMessageHubVerifier(FMessageHub* InHub) { GMP_CHECK(IsInGameThread()); }
+		FMessageHubVerifier(const FMessageHub* InHub, FRWScopeLockType LockType = SLT_Write) { GMP_CHECK(IsInGameThread()); }
 	};
 #endif
 
@@ -250,13 +255,14 @@ namespace GMP
 	FMessageHub::~FMessageHub()
 	{
 		FMessageHubVerifier Verifier{this};
+		CoalescedChannels.Reset();
 		MessageHubs.Remove(this);
 	}
 
 	bool FMessageHub::IsValidHub() const
 	{
-		FMessageHubVerifier Verifier{const_cast<FMessageHub*>(this)};
-		return MessageHubs.Contains(this);
+		FMessageHubVerifier Verifier{this, SLT_ReadOnly};
+		return MessageHubs.Contains(const_cast<FMessageHub*>(this));
 	}
 
 	bool FMessageHub::IsResponseOn(FGMPKey Key) const
@@ -264,22 +270,34 @@ namespace GMP
 		return Hub::GMPResponses().Contains(Key);
 	}
 
+	// hubs may nest when a world listener sends on the global hub
+	static TArray<FMessageHub*, TInlineAllocator<8>> DispatchingHubs;
+	FMessageHub* FMessageHub::GetDispatchingHub()
+	{
+		return DispatchingHubs.Num() ? DispatchingHubs.Last() : nullptr;
+	}
+
 	void FMessageHub::PushMsgBody(FMessageBody* Body)
 	{
 		MessageBodyStack.Push(Body);
+		DispatchingHubs.Push(this);
 	}
 
 	FMessageBody* FMessageHub::PopMsgBody()
 	{
+		DispatchingHubs.Pop();
 		return MessageBodyStack.Pop();
 	}
 
 	FGMPKey FMessageHub::RequestMessageImpl(FSignalBase* Ptr, const FName& MessageKey, FSigSource InSigSrc, FTypedAddresses& Param, FResponseSig&& OnRsp, const FArrayTypeNames* SingleshotTypes)
 	{
-		bool bExsitResponder = OnRsp && CallbackMarks.Contains(MessageKey);
+		bool bExsitResponder = OnRsp && HasCallbackMark(MessageKey);
 		if (bExsitResponder && ensureAlwaysMsgf(!Hub::GMPResponses().Contains(OnRsp.GetId()), TEXT("duplicate sequence %zu!"), OnRsp.GetId()))
 		{
-			Hub::GMPResponses().Emplace(OnRsp.GetId(), MoveTemp(OnRsp));
+			{
+				GMP_LLM_SCOPE();
+				Hub::GMPResponses().Emplace(OnRsp.GetId(), MoveTemp(OnRsp));
+			}
 
 			FMessageBody Msg(Param, MessageKey, InSigSrc, OnRsp.GetId());
 
@@ -297,14 +315,15 @@ namespace GMP
 					Hub::FRecursionDetection Detector(MessageKey, InSigSrc);
 					GMP_CNOTE_ONCE(Detector, TEXT("Recursion Detected! :%s"), *InSigSrc.GetNameSafe());
 
-					auto IDs = SignalPtr->FireWithSigSource(InSigSrc, Msg);
+					auto IDs = SignalPtr->FireConsumable(InSigSrc, Msg.bConsumed, Msg);
 					Hub::GetHistoryCalls().FindOrAdd(MessageKey).AppendCallInfo(InSigSrc, Msg, MoveTemp(IDs));
 				}
 				else
 #endif
 				{
-					SignalPtr->FireWithSigSource(InSigSrc, Msg);
+					SignalPtr->FireConsumable(InSigSrc, Msg.bConsumed, Msg);
 				}
+				FireAnySourceListeners(Ptr, MessageKey, InSigSrc, Msg);
 			}
 			return Msg.SequenceId;
 		}
@@ -316,6 +335,7 @@ namespace GMP
 
 	FGMPKey FMessageHub::ListenMessageImpl(const FName& MessageKey, FSigSource InSigSrc, FSigListener Listener, FGMPMessageSig&& Slot, FGMPListenOptions Options)
 	{
+		GMP_LLM_SCOPE();
 		if (!MessageSignals.Contains(MessageKey))
 			MessageSignals.Add(MessageKey).Store = FGMPMsgSignal::MakeSignals(MessageKey);
 
@@ -323,6 +343,8 @@ namespace GMP
 		{
 			if (auto Elem = Ptr->Connect(Listener.GetObj(), std::move(Slot), InSigSrc, Options))
 			{
+				if (ListenerAudit::IsCapturing())
+					ListenerAudit::OnListen(MessageKey, *Elem, InSigSrc, Listener.GetObj() ? ListenerAudit::EOwnerKind::Object : ListenerAudit::EOwnerKind::None);
 				auto Inc = Listener.GetInc();
 				if (Inc)
 				{
@@ -337,6 +359,7 @@ namespace GMP
 
 	FGMPKey FMessageHub::ListenMessageImpl(const FName& MessageKey, FSigSource InSigSrc, FSigCollection* Listener, FGMPMessageSig&& Slot, FGMPListenOptions Options)
 	{
+		GMP_LLM_SCOPE();
 		if (!MessageSignals.Contains(MessageKey))
 			MessageSignals.Add(MessageKey).Store = FGMPMsgSignal::MakeSignals(MessageKey);
 
@@ -344,6 +367,8 @@ namespace GMP
 		{
 			if (auto Elem = Ptr->Connect(Listener, std::move(Slot), InSigSrc, Options))
 			{
+				if (ListenerAudit::IsCapturing())
+					ListenerAudit::OnListen(MessageKey, *Elem, InSigSrc, ListenerAudit::EOwnerKind::Collection);
 				GMP_LOG(TEXT("FMessageHub::ListenMessage Key[%s] [SigCollection:%p] Watched[%s]"), *MessageKey.ToString(), Listener, *InSigSrc.GetNameSafe());
 				return Elem->GetGMPKey();
 			}
@@ -391,6 +416,17 @@ namespace GMP
 	}
 
 	FGMPKey FMessageHub::NotifyMessageImpl(FSignalBase* Ptr, const FName& MessageKey, FSigSource InSigSrc, FTypedAddresses& Params)
+	{
+		if (CoalescedChannels)
+		{
+			FGMPKey Seq;
+			if (CoalescedChannels->TryPark(MessageKey, InSigSrc, Params, Seq))
+				return Seq;
+		}
+		return FireMessageImpl(Ptr, MessageKey, InSigSrc, Params);
+	}
+
+	FGMPKey FMessageHub::FireMessageImpl(FSignalBase* Ptr, const FName& MessageKey, FSigSource InSigSrc, FTypedAddresses& Params)
 	{
 		FMessageBody Msg(Params, MessageKey, InSigSrc);
 		auto Seq = Msg.SequenceId;
@@ -406,18 +442,83 @@ namespace GMP
 			{
 				Hub::FRecursionDetection Detector(MessageKey, InSigSrc);
 
-				auto IDs = SignalPtr->FireWithSigSource(InSigSrc, Msg);
+				auto IDs = SignalPtr->FireConsumable(InSigSrc, Msg.bConsumed, Msg);
 				Hub::GetHistoryCalls().FindOrAdd(MessageKey).AppendCallInfo(InSigSrc, Msg, MoveTemp(IDs));
 			}
 			else
 #endif
 			{
-				SignalPtr->FireWithSigSource(InSigSrc, Msg);
+				SignalPtr->FireConsumable(InSigSrc, Msg.bConsumed, Msg);
 			}
+			FireAnySourceListeners(Ptr, MessageKey, InSigSrc, Msg);
 		}
 		return Seq;
 	}
 
+	void FMessageHub::FireAnySourceListeners(FSignalBase* Ptr, const FName& MessageKey, FSigSource InSigSrc, FMessageBody& Msg)
+	{
+		if (!AnySourceHub)
+			return;
+
+		// Ptr already is the global signal when this world hub had no listener for the key
+		auto AnyPtr = static_cast<FGMPMsgSignal*>(FindSig(AnySourceHub->MessageSignals, MessageKey));
+		if (!AnyPtr || AnyPtr == Ptr)
+			return;
+#if WITH_EDITOR
+		if (GIsEditor)
+		{
+			auto IDs = AnyPtr->FireConsumable(InSigSrc, Msg.bConsumed, Msg);
+			Hub::GetHistoryCalls().FindOrAdd(MessageKey).AppendCallInfo(InSigSrc, Msg, MoveTemp(IDs));
+		}
+		else
+#endif
+		{
+			AnyPtr->FireConsumable(InSigSrc, Msg.bConsumed, Msg);
+		}
+	}
+
+	Hub::FCoalescedChannels& FMessageHub::GetCoalescedChannels()
+	{
+		if (!CoalescedChannels)
+			CoalescedChannels = MakeUnique<Hub::FCoalescedChannels>(this);
+		return *CoalescedChannels;
+	}
+
+	FGMPKey FMessageHub::FireCoalescedMessage(const FName& MessageKey, FSigSource InSigSrc, FTypedAddresses& Params)
+	{
+		// listeners may be gone by the flush point
+		if (auto Ptr = FindSendSig(MessageKey))
+			return FireMessageImpl(Ptr, MessageKey, InSigSrc, Params);
+		return {};
+	}
+
+	bool FMessageHub::IsCoalesced(const FName& MessageKey) const
+	{
+		return CoalescedChannels && CoalescedChannels->IsCoalesced(MessageKey);
+	}
+
+	void FMessageHub::CollectMemory(FGMPMemoryReport& Report, bool bWithResponses) const
+	{
+		Report.SharedBytes += MessageSignals.GetAllocatedSize() + CallbackMarks.GetAllocatedSize() + MessageBodyStack.GetAllocatedSize();
+		for (auto& Pair : MessageSignals)
+		{
+			if (Pair.Value.Store)
+				Pair.Value.Store->CollectMemory(Report);
+		}
+		if (!bWithResponses)
+			return;
+
+		auto& Responses = Hub::GMPResponses();
+		Report.SharedBytes += Responses.GetAllocatedSize();
+		Report.Responses.Add(Responses.GetAllocatedSize(), 0);
+		for (auto& Pair : Responses)
+		{
+			const SIZE_T Bytes = Pair.Value.GetHeapAllocatedSize();
+			Report.Responses.Add(Bytes);
+			Report.MessageKeys.FindOrAdd(Pair.Value.GetRec()).Add(Bytes, 0);
+		}
+	}
+
 	bool FMessageHub::IsAlive(const FName& MessageKey, FGMPKey Key) const
 	{
 		if (auto Ptr = FindSig<FGMPMsgSignal>(MessageSignals, MessageKey))
@@ -976,6 +1077,22 @@ namespace GMP
 	}
 }  // namespace GMP
 
+void UGMPManager::Serialize(FArchive& Ar)
+{
+	Super::Serialize(Ar);
+	if (Ar.IsCountingMemory())
+	{
+		const SIZE_T Total = GMP::FGMPMemoryReport::Collect(&MessageHub).GetTotalBytes();
+		Ar.CountBytes(Total, Total);
+	}
+}
+
+void UGMPManager::GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize)
+{
+	Super::GetResourceSizeEx(CumulativeResourceSize);
+	CumulativeResourceSize.AddDedicatedSystemMemoryBytes(GMP::FGMPMemoryReport::Collect(&MessageHub).GetTotalBytes());
+}
+
 namespace
 {
 	static FDelayedAutoRegisterHelper DelayInnerInitUGMPManager(EDelayedRegisterRunPhase::EndOfEngineInit, [] {
@@ -1012,4 +1129,4 @@ namespace
 #if GMP_DISABLE_HUB_OPTIMIZATION
 UE_ENABLE_OPTIMIZATION
 #endif
-
+
@@ -0,0 +1,103 @@
+//  Copyright GenericMessagePlugin, Inc. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS_NEON
+#include <arm_neon.h>
+#define GMP_JSON_ESCAPE_NEON 1
+#elif PLATFORM_ENABLE_VECTORINTRINSICS && PLATFORM_CPU_X86_FAMILY
+#include <emmintrin.h>
+#define GMP_JSON_ESCAPE_SSE2 1
+#endif
+
+#ifndef GMP_JSON_ESCAPE_NEON
+#define GMP_JSON_ESCAPE_NEON 0
+#endif
+#ifndef GMP_JSON_ESCAPE_SSE2
+#define GMP_JSON_ESCAPE_SSE2 0
+#endif
+
+namespace GMP
+{
+namespace Json
+{
+	namespace Escape
+	{
+		static_assert(sizeof(TCHAR) == 2, "utf16 TCHAR only");
+
+		// printable ascii which is written to json as is
+		FORCEINLINE bool IsPlainChar(TCHAR C) { return C >= 0x20 && C < 0x80 && C != TCHAR('"') && C != TCHAR('\\'); }
+
+		// length of the leading run which needs neither escaping nor transcoding, 16 code units per step
+		inline int32 CountPlainChars(const TCHAR* Str, int32 Len)
+		{
+			int32 Idx = 0;
+#if GMP_JSON_ESCAPE_SSE2
+			const __m128i NonAsciiBits = _mm_set1_epi16((int16)0xFF80);
+			const __m128i Zero = _mm_setzero_si128();
+			const __m128i Quote = _mm_set1_epi8('"');
+			const __m128i Backslash = _mm_set1_epi8('\\');
+			const __m128i Space = _mm_set1_epi8(0x20);
+			for (; Idx + 16 <= Len; Idx += 16)
+			{
+				const __m128i Lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Str + Idx));
+				const __m128i Hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Str + Idx + 8));
+				// 0xFF per ascii code unit
+				const __m128i Ascii = _mm_packs_epi16(_mm_cmpeq_epi16(_mm_and_si128(Lo, NonAsciiBits), Zero), _mm_cmpeq_epi16(_mm_and_si128(Hi, NonAsciiBits), Zero));
+				// narrowed bytes are only meaningful on ascii lanes
+				const __m128i Bytes = _mm_packus_epi16(Lo, Hi);
+				const __m128i Special = _mm_or_si128(_mm_cmplt_epi8(Bytes, Space), _mm_or_si128(_mm_cmpeq_epi8(Bytes, Quote), _mm_cmpeq_epi8(Bytes, Backslash)));
+				const int32 Plain = _mm_movemask_epi8(_mm_andnot_si128(Special, Ascii));
+				if (Plain != 0xFFFF)
+					return Idx + (int32)FMath::CountTrailingZeros((uint32)(~Plain & 0xFFFF));
+			}
+#elif GMP_JSON_ESCAPE_NEON
+			const uint16x8_t MaxAscii = vdupq_n_u16(0x7F);
+			const uint8x16_t Quote = vdupq_n_u8('"');
+			const uint8x16_t Backslash = vdupq_n_u8('\\');
+			const uint8x16_t Space = vdupq_n_u8(0x20);
+			for (; Idx + 16 <= Len; Idx += 16)
+			{
+				const uint16x8_t Lo = vld1q_u16(reinterpret_cast<const uint16*>(Str + Idx));
+				const uint16x8_t Hi = vld1q_u16(reinterpret_cast<const uint16*>(Str + Idx + 8));
+				const uint8x16_t NonAscii = vcombine_u8(vmovn_u16(vcgtq_u16(Lo, MaxAscii)), vmovn_u16(vcgtq_u16(Hi, MaxAscii)));
+				const uint8x16_t Bytes = vcombine_u8(vmovn_u16(Lo), vmovn_u16(Hi));
+				const uint8x16_t Bad = vorrq_u8(vorrq_u8(NonAscii, vcltq_u8(Bytes, Space)), vorrq_u8(vceqq_u8(Bytes, Quote), vceqq_u8(Bytes, Backslash)));
+				// one nibble per lane
+				const uint64 Mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(Bad), 4)), 0);
+				if (Mask)
+					return Idx + (int32)(FMath::CountTrailingZeros64(Mask) >> 2);
+			}
+#endif
+			for (; Idx < Len && IsPlainChar(Str[Idx]); ++Idx)
+			{
+			}
+			return Idx;
+		}
+
+		// Src must be a run counted by CountPlainChars
+		inline void NarrowPlainChars(uint8* Dst, const TCHAR* Src, int32 Len)
+		{
+			int32 Idx = 0;
+#if GMP_JSON_ESCAPE_SSE2
+			for (; Idx + 16 <= Len; Idx += 16)
+			{
+				const __m128i Lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Src + Idx));
+				const __m128i Hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Src + Idx + 8));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Dst + Idx), _mm_packus_epi16(Lo, Hi));
+			}
+#elif GMP_JSON_ESCAPE_NEON
+			for (; Idx + 16 <= Len; Idx += 16)
+			{
+				const uint16x8_t Lo = vld1q_u16(reinterpret_cast<const uint16*>(Src + Idx));
+				const uint16x8_t Hi = vld1q_u16(reinterpret_cast<const uint16*>(Src + Idx + 8));
+				vst1q_u8(Dst + Idx, vcombine_u8(vmovn_u16(Lo), vmovn_u16(Hi)));
+			}
+#endif
+			for (; Idx < Len; ++Idx)
+				Dst[Idx] = static_cast<uint8>(Src[Idx]);
+		}
+	}  // namespace Escape
+}  // namespace Json
+}  // namespace GMP
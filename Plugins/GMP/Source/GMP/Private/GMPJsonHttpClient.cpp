@@ -0,0 +1,366 @@
+//  Copyright GenericMessagePlugin, Inc. All Rights Reserved.
+
+#include "GMPJsonHttpClient.h"
+
+#include "Async/Async.h"
+#include "GMPReflection.h"
+#include "GMPThreadUtils.h"
+#include "HAL/IConsoleManager.h"
+#include "HttpModule.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Interfaces/IHttpResponse.h"
+#include "Misc/DelayedAutoRegister.h"
+#include "Misc/ScopeLock.h"
+#include "UnrealCompatibility.h"
+
+#ifndef GMP_WITH_HTTP_PACKAGE
+#if defined(HTTP_API) && defined(HTTP_PACKAGE) && HTTP_PACKAGE
+#define GMP_WITH_HTTP_PACKAGE 1
+#else
+#define GMP_WITH_HTTP_PACKAGE 0
+#endif
+#endif
+
+namespace GMP
+{
+namespace Json
+{
+namespace Http
+{
+	static int32 MaxPerHost = 6;
+	FAutoConsoleVariableRef CVar_HttpMaxPerHost(TEXT("gmp.http.maxperhost"), MaxPerHost, TEXT("json http requests in flight per host, 0 for unlimited"));
+
+	namespace Internal
+	{
+		// scheme://host[:port]/path -> host[:port]
+		static FString GetHost(const FString& Url)
+		{
+			int32 Start = Url.Find(TEXT("://"), ESearchCase::CaseSensitive);
+			Start = Start == INDEX_NONE ? 0 : Start + 3;
+			int32 End = Url.Find(TEXT("/"), ESearchCase::CaseSensitive, ESearchDir::FromStart, Start);
+			return Url.Mid(Start, End == INDEX_NONE ? MAX_int32 : End - Start).ToLower();
+		}
+
+		static bool ContainsObjectReference(const FProperty* Prop)
+		{
+			// resolving object paths has to stay on the game thread
+			TArray<const FStructProperty*> EncounteredStructProps;
+			return Prop->ContainsObjectReference(EncounteredStructProps, EPropertyObjectReferenceType::Strong | EPropertyObjectReferenceType::Weak);
+		}
+
+		// a recompiled struct keeps its properties alive only until the next reflection cache invalidation
+		static std::atomic<uint32> LayoutEpoch{1};
+		static FDelayedAutoRegisterHelper DelayOnObjectSystemReady(EDelayedRegisterRunPhase::ObjectSystemReady, [] {
+			Reflection::OnReflectionCachesInvalidated().AddLambda([] { LayoutEpoch.fetch_add(1, std::memory_order_relaxed); });
+		});
+
+		static void CollectScriptStructs(const FProperty* Prop, TSet<const UStruct*>& Visited, TArray<TWeakObjectPtr<const UStruct>>& Out)
+		{
+			if (auto ArrProp = CastField<FArrayProperty>(Prop))
+			{
+				CollectScriptStructs(ArrProp->Inner, Visited, Out);
+			}
+			else if (auto SetProp = CastField<FSetProperty>(Prop))
+			{
+				CollectScriptStructs(SetProp->ElementProp, Visited, Out);
+			}
+			else if (auto MapProp = CastField<FMapProperty>(Prop))
+			{
+				CollectScriptStructs(MapProp->KeyProp, Visited, Out);
+				CollectScriptStructs(MapProp->ValueProp, Visited, Out);
+			}
+			else if (auto StructProp = CastField<FStructProperty>(Prop))
+			{
+				bool bAlreadyIn = false;
+				Visited.Add(StructProp->Struct, &bAlreadyIn);
+				if (bAlreadyIn)
+					return;
+				if (!(StructProp->Struct->StructFlags & STRUCT_Native))
+					Out.Add(StructProp->Struct);
+				for (TFieldIterator<FProperty> It(StructProp->Struct); It; ++It)
+					CollectScriptStructs(*It, Visited, Out);
+			}
+		}
+
+		class FHttpModuleTransport final : public ITransport
+		{
+		public:
+			virtual bool Send(FRequest&& Req, FOnTransportDone&& OnDone) override
+			{
+				TSharedPtr<IHttpRequest, ESPMode::ThreadSafe> HttpRequest;
+#if GMP_WITH_HTTP_PACKAGE
+				HttpRequest = FHttpModule::Get().CreateRequest();
+#else
+				if (auto HttpModule = FModuleManager::LoadModulePtr<FHttpModule>("HTTP"))
+				{
+					HttpRequest = HttpModule->CreateRequest();
+				}
+				if (!ensureMsgf(HttpRequest, TEXT("Unable to CreateRequest")))
+				{
+					OnDone(FResponse{EHttpResponseCodes::Unknown});
+					return false;
+				}
+#endif
+				HttpRequest->SetURL(Req.Url);
+				HttpRequest->SetVerb(Req.Verb);
+				if (Req.TimeoutSecs > 0.f)
+					HttpRequest->SetTimeout(Req.TimeoutSecs);
+				for (auto& Pair : Req.Headers)
+				{
+					HttpRequest->AppendToHeader(Pair.Key, Pair.Value);
+				}
+				if (Req.Content.Num() > 0)
+				{
+#if UE_4_26_OR_LATER
+					HttpRequest->SetContent(MoveTemp(Req.Content));
+#else
+					HttpRequest->SetContent(Req.Content);
+#endif
+				}
+
+				// delegates need copyable payloads, and a rejected request may or may not complete
+				struct FDone
+				{
+					FOnTransportDone OnDone;
+					std::atomic<bool> bCalled{false};
+					void operator()(FResponse&& Rsp)
+					{
+						if (!bCalled.exchange(true))
+							OnDone(MoveTemp(Rsp));
+					}
+				};
+				auto SharedDone = MakeShared<FDone, ESPMode::ThreadSafe>();
+				SharedDone->OnDone = MoveTemp(OnDone);
+				HttpRequest->OnProcessRequestComplete().BindLambda([SharedDone](FHttpRequestPtr RequestPtr, FHttpResponsePtr ResponsePtr, bool bConnectedSuccessfully) {
+					FResponse Rsp;
+					Rsp.bConnected = bConnectedSuccessfully;
+					Rsp.Code = ResponsePtr.IsValid() ? ResponsePtr->GetResponseCode() : EHttpResponseCodes::Unknown;
+					// the response owns its content and outlives the decode, no copy
+					Rsp.HttpResponse = ResponsePtr;
+					(*SharedDone)(MoveTemp(Rsp));
+				});
+				const bool bStarted = HttpRequest->ProcessRequest();
+				if (!bStarted)
+					(*SharedDone)(FResponse{EHttpResponseCodes::Unknown});
+				return bStarted;
+			}
+		};
+	}  // namespace Internal
+
+	FTransportRef MakeHttpModuleTransport()
+	{
+		return MakeShared<Internal::FHttpModuleTransport, ESPMode::ThreadSafe>();
+	}
+
+	FLoopbackTransport::FLoopbackTransport(FHandler InHandler, bool bInAsync)
+		: Handler(MakeShared<FHandler, ESPMode::ThreadSafe>(MoveTemp(InHandler)))
+		, bAsync(bInAsync)
+	{
+	}
+
+	bool FLoopbackTransport::Send(FRequest&& Req, FOnTransportDone&& OnDone)
+	{
+		++NumSent;
+		auto Serve = [Handler{Handler}, Req{MoveTemp(Req)}, OnDone{MoveTemp(OnDone)}]() mutable {
+			FResponse Rsp;
+			Rsp.bConnected = true;
+			Rsp.Code = EHttpResponseCodes::Ok;
+			(*Handler)(Req, Rsp);
+			OnDone(MoveTemp(Rsp));
+		};
+		if (bAsync)
+			Async(EAsyncExecution::TaskGraph, MoveTemp(Serve));
+		else
+			Serve();
+		return true;
+	}
+
+	TSharedRef<FJsonHttpClient, ESPMode::ThreadSafe> FJsonHttpClient::Create(FTransportRef InTransport, const FClientSettings& InSettings)
+	{
+		return MakeShared<FJsonHttpClient, ESPMode::ThreadSafe>(MoveTemp(InTransport), InSettings);
+	}
+
+	FJsonHttpClient& FJsonHttpClient::Default()
+	{
+		static TSharedRef<FJsonHttpClient, ESPMode::ThreadSafe> Client = Create(MakeHttpModuleTransport());
+		return *Client;
+	}
+
+	FJsonHttpClient::FJsonHttpClient(FTransportRef InTransport, const FClientSettings& InSettings)
+		: Transport(MoveTemp(InTransport))
+		, Settings(InSettings)
+	{
+	}
+
+	int32 FJsonHttpClient::GetMaxPerHost() const
+	{
+		const int32 Max = Settings.MaxConcurrentPerHost > 0 ? Settings.MaxConcurrentPerHost : MaxPerHost;
+		return Max > 0 ? Max : MAX_int32;
+	}
+
+	bool FJsonHttpClient::FLayoutGuard::IsValid() const
+	{
+		if (IsNative())
+			return true;
+		if (Epoch != Internal::LayoutEpoch.load(std::memory_order_relaxed))
+			return false;
+		for (auto& Struct : Structs)
+		{
+			if (!Struct.IsValid())
+				return false;
+		}
+		return true;
+	}
+
+	int32 FJsonHttpClient::GetNumInFlight(const FString& Host) const
+	{
+		FScopeLock ScopeLock(&Lock);
+		auto Find = Hosts.Find(Host.ToLower());
+		return Find ? Find->InFlight : 0;
+	}
+
+	int32 FJsonHttpClient::GetNumQueued(const FString& Host) const
+	{
+		FScopeLock ScopeLock(&Lock);
+		auto Find = Hosts.Find(Host.ToLower());
+		return Find ? Find->Queue.Num() : 0;
+	}
+
+	bool FJsonHttpClient::Request(const FString& Url, const TMap<FString, FString>& Headers, float TimeoutSecs, FProperty* BodyProp, const uint8* BodyData, FProperty* RspProp, FOnResponse OnRsp)
+	{
+		if (!ensure(RspProp))
+			return false;
+
+		auto Pending = MakeUnique<FPending>();
+		Pending->Req.Url = Url;
+		Pending->Req.Headers = Headers;
+		Pending->Req.TimeoutSecs = TimeoutSecs;
+		Pending->RspProp = RspProp;
+		Pending->OnRsp = MoveTemp(OnRsp);
+		{
+			TSet<const UStruct*> Visited;
+			Internal::CollectScriptStructs(RspProp, Visited, Pending->Layout.Structs);
+			Pending->Layout.Epoch = Internal::LayoutEpoch.load(std::memory_order_relaxed);
+		}
+		// only native layouts are known to stay put while a worker reads into them
+		Pending->bDecodeOnWorker = Settings.bDecodeOnWorker && Pending->Layout.IsNative() && !Internal::ContainsObjectReference(RspProp);
+
+		if (BodyData && ensure(BodyProp))
+		{
+			Pending->Req.Verb = TEXT("POST");
+			// written straight into the buffer handed to the transport
+			PropToJson(Pending->Req.Content, BodyProp, BodyData);
+		}
+		else
+		{
+			Pending->Req.Verb = TEXT("GET");
+		}
+
+		const FString Host = Internal::GetHost(Url);
+		{
+			FScopeLock ScopeLock(&Lock);
+			auto& Pool = Hosts.FindOrAdd(Host);
+			if (Pool.InFlight >= GetMaxPerHost())
+			{
+				Pool.Queue.Add(MoveTemp(Pending));
+				return true;
+			}
+			++Pool.InFlight;
+		}
+		return Dispatch(Host, MoveTemp(Pending));
+	}
+
+	bool FJsonHttpClient::Dispatch(const FString& Host, TUniquePtr<FPending> Pending)
+	{
+		UE_LOG(LogGMP, Verbose, TEXT("GMPJsonHttpClient : %s-url : %s"), *Pending->Req.Verb, *Pending->Req.Url);
+
+		FRequest Req = MoveTemp(Pending->Req);
+		return Transport->Send(MoveTemp(Req), [Self{AsShared()}, Host, Pending{MoveTemp(Pending)}](FResponse&& Rsp) mutable { Self->OnTransportDone(Host, MoveTemp(Pending), MoveTemp(Rsp)); });
+	}
+
+	void FJsonHttpClient::OnTransportDone(const FString& Host, TUniquePtr<FPending> Pending, FResponse&& Rsp)
+	{
+		// hand the slot to the next queued request of this host
+		TUniquePtr<FPending> Next;
+		{
+			FScopeLock ScopeLock(&Lock);
+			auto& Pool = Hosts.FindChecked(Host);
+			if (Pool.Queue.Num() > 0 && Pool.InFlight <= GetMaxPerHost())
+			{
+				Next = MoveTemp(Pool.Queue[0]);
+				Pool.Queue.RemoveAt(0, 1, EAllowShrinking::No);
+			}
+			else
+			{
+				--Pool.InFlight;
+			}
+		}
+		if (Next)
+			Dispatch(Host, MoveTemp(Next));
+
+		struct FDecoded
+		{
+			FProperty* Prop;
+			uint8* Data;
+			bool bSucc = false;
+
+			explicit FDecoded(FProperty* InProp)
+				: Prop(InProp)
+				, Data(static_cast<uint8*>(FMemory::Malloc(InProp->GetSize(), InProp->GetMinAlignment())))
+			{
+				Prop->InitializeValue(Data);
+			}
+			~FDecoded()
+			{
+				Prop->DestroyValue(Data);
+				FMemory::Free(Data);
+			}
+		};
+
+		const bool bDecodeOnWorker = Pending->bDecodeOnWorker;
+		auto Decode = [Self{AsShared()}, Pending{MoveTemp(Pending)}, Rsp{MoveTemp(Rsp)}]() mutable {
+			// script layouts are decoded on the game thread, where their structs can only change between frames
+			if (!Pending->Layout.IsValid())
+			{
+				GMP_WARNING(TEXT("GMPJsonHttpClient : response type changed while in flight : %s"), *Pending->Req.Url);
+				RunOnGameThread([OnRsp{MoveTemp(Pending->OnRsp)}, Code{Rsp.Code}] {
+					if (OnRsp)
+						OnRsp(false, Code, nullptr);
+				});
+				return;
+			}
+			if (!IsInGameThread())
+				++Self->NumDecodedOnWorker;
+
+			auto Decoded = MakeShared<FDecoded, ESPMode::ThreadSafe>(Pending->RspProp);
+			if (!EHttpResponseCodes::IsOk(Rsp.Code))
+			{
+				GMP_WARNING(TEXT("GMPJsonHttpClient : ResponseCode failed : %d"), Rsp.Code);
+			}
+			else if (!Rsp.bConnected)
+			{
+				GMP_WARNING(TEXT("GMPJsonHttpClient : Connect failed"));
+			}
+			else
+			{
+				Decoded->bSucc = Rsp.HttpResponse.IsValid() ? PropFromJson(TArrayView<const uint8>(Rsp.HttpResponse->GetContent()), Pending->RspProp, Decoded->Data)
+															: PropFromJson(MoveTemp(Rsp.Content), Pending->RspProp, Decoded->Data);
+				GMP_CWARNING(!Decoded->bSucc, TEXT("GMPJsonHttpClient : Deserialize failed"));
+			}
+
+			RunOnGameThread([Decoded, OnRsp{MoveTemp(Pending->OnRsp)}, Code{Rsp.Code}] {
+				if (OnRsp)
+					OnRsp(Decoded->bSucc, Code, Decoded->bSucc ? Decoded->Data : nullptr);
+			});
+		};
+
+		if (bDecodeOnWorker)
+			Async(EAsyncExecution::TaskGraph, MoveTemp(Decode));
+		else if (IsInGameThread())
+			Decode();
+		else
+			Async(EAsyncExecution::TaskGraphMainThread, MoveTemp(Decode));
+	}
+}  // namespace Http
+}  // namespace Json
+}  // namespace GMP
@@ -0,0 +1,453 @@
+//  Copyright GenericMessagePlugin, Inc. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+
+#include "Algo/BinarySearch.h"
+#include "Misc/ScopeLock.h"
+#include "Misc/ScopeRWLock.h"
+#include "UnrealCompatibility.h"
+
+#include <atomic>
+
+struct FGMPValueOneOf;
+
+namespace GMP
+{
+namespace Json
+{
+namespace Lazy
+{
+	// FGMPValueOneOf::Flags of a lazy view, combined with sizeof(CharType)
+	constexpr int32 FlagLazy = 0x10;
+
+	// one json value of the raw text, containers list their children contiguously in TDocument::Children
+	struct FTapeNode
+	{
+		int32 Begin = 0;
+		int32 End = 0;
+		// member name without quotes
+		int32 KeyBegin = INDEX_NONE;
+		int32 KeyEnd = INDEX_NONE;
+		uint32 KeyHash = 0;
+		int32 FirstChild = INDEX_NONE;
+		int32 NumChildren = 0;
+		// '{', '[' or 0 for scalars
+		uint8 Kind = 0;
+		bool bKeyEscaped = false;
+	};
+
+	template<typename CharType>
+	FORCEINLINE CharType ToLowerAscii(CharType C)
+	{
+		return (C >= 'A' && C <= 'Z') ? CharType(C + ('a' - 'A')) : C;
+	}
+
+	// member names compare like FName, ascii case insensitive
+	template<typename CharType>
+	uint32 HashKey(const CharType* Str, int32 Len)
+	{
+		uint32 Hash = 2166136261u;
+		for (int32 Idx = 0; Idx < Len; ++Idx)
+			Hash = (Hash ^ uint32(ToLowerAscii(Str[Idx]))) * 16777619u;
+		return Hash;
+	}
+
+	template<typename CharType, typename KeyCharType>
+	bool KeyEquals(const CharType* Lhs, const KeyCharType* Rhs, int32 Len)
+	{
+		for (int32 Idx = 0; Idx < Len; ++Idx)
+		{
+			if (uint32(ToLowerAscii(Lhs[Idx])) != uint32(ToLowerAscii(Rhs[Idx])))
+				return false;
+		}
+		return true;
+	}
+
+	// raw json text indexed on first access, values are located by the tape and decoded in place on demand
+	template<typename CharType>
+	class TDocument
+	{
+	public:
+		explicit TDocument(TArray<CharType>&& InChars)
+			: Chars(MoveTemp(InChars))
+		{
+		}
+
+		const CharType* GetData() const { return Chars.GetData(); }
+
+		bool EnsureIndexed() const
+		{
+			int32 Cur = State.load(std::memory_order_acquire);
+			if (Cur == 0)
+			{
+				FScopeLock ScopeLock(&BuildLock);
+				Cur = State.load(std::memory_order_relaxed);
+				if (Cur == 0)
+				{
+					Cur = BuildTape() ? 1 : -1;
+					State.store(Cur, std::memory_order_release);
+				}
+			}
+			return Cur > 0;
+		}
+
+		// valid after EnsureIndexed
+		const FTapeNode& GetNode(int32 Node) const { return Tape[Node]; }
+		int32 GetChild(int32 Node, int32 Idx) const { return Children[Tape[Node].FirstChild + Idx]; }
+
+		// O(log n) by key hash, escaped member names are matched by the callback
+		template<typename F>
+		int32 FindMember(int32 Node, const CharType* Key, int32 Len, const F& MatchEscaped) const
+		{
+			return FindMember(Node, HashKey(Key, Len), Key, Len, MatchEscaped);
+		}
+
+		// Hash is HashKey of the key, an ascii key may be given as TCHAR for any document
+		template<typename KeyCharType, typename F>
+		int32 FindMember(int32 Node, uint32 Hash, const KeyCharType* Key, int32 Len, const F& MatchEscaped) const
+		{
+			if (!EnsureIndexed() || Tape[Node].Kind != '{')
+				return INDEX_NONE;
+
+			const auto& Lookup = GetLookup(Node);
+			for (int32 Idx = Algo::LowerBoundBy(Lookup, Hash, [](const TPair<uint32, int32>& Pair) { return Pair.Key; }); Idx < Lookup.Num() && Lookup[Idx].Key == Hash; ++Idx)
+			{
+				auto& Child = Tape[Lookup[Idx].Value];
+				if (Child.KeyEnd - Child.KeyBegin == Len && KeyEquals(Chars.GetData() + Child.KeyBegin, Key, Len))
+					return Lookup[Idx].Value;
+			}
+
+			auto& Obj = Tape[Node];
+			for (int32 Idx = 0; Idx < Obj.NumChildren; ++Idx)
+			{
+				const int32 Child = GetChild(Node, Idx);
+				if (Tape[Child].bKeyEscaped && MatchEscaped(Tape[Child]))
+					return Child;
+			}
+			return INDEX_NONE;
+		}
+
+		int32 GetElement(int32 Node, int32 Idx) const
+		{
+			if (!EnsureIndexed() || Tape[Node].Kind != '[' || Idx < 0 || Idx >= Tape[Node].NumChildren)
+				return INDEX_NONE;
+			return GetChild(Node, Idx);
+		}
+
+		// resolved paths by (start node, path hash), misses are cached as INDEX_NONE
+		bool FindPath(int32 Start, uint64 PathHash, int32& OutNode) const
+		{
+			FReadScopeLock ReadLock(PathLock);
+			auto Find = Paths.Find(TPair<int32, uint64>(Start, PathHash));
+			if (Find)
+				OutNode = *Find;
+			return !!Find;
+		}
+		void AddPath(int32 Start, uint64 PathHash, int32 Node) const
+		{
+			FWriteScopeLock WriteLock(PathLock);
+			Paths.Add(TPair<int32, uint64>(Start, PathHash), Node);
+		}
+
+	private:
+		using FLookup = TArray<TPair<uint32, int32>>;
+		const FLookup& GetLookup(int32 Node) const
+		{
+			{
+				FReadScopeLock ReadLock(LookupLock);
+				if (auto Find = Lookups.Find(Node))
+					return **Find;
+			}
+			FWriteScopeLock WriteLock(LookupLock);
+			if (auto Find = Lookups.Find(Node))
+				return **Find;
+
+			auto Lookup = MakeUnique<FLookup>();
+			auto& Obj = Tape[Node];
+			Lookup->Reserve(Obj.NumChildren);
+			for (int32 Idx = 0; Idx < Obj.NumChildren; ++Idx)
+			{
+				const int32 Child = GetChild(Node, Idx);
+				if (!Tape[Child].bKeyEscaped)
+					Lookup->Emplace(Tape[Child].KeyHash, Child);
+			}
+			// first member wins on duplicated names
+			Lookup->StableSort([](const TPair<uint32, int32>& Lhs, const TPair<uint32, int32>& Rhs) { return Lhs.Key < Rhs.Key; });
+			return *Lookups.Add(Node, MoveTemp(Lookup));
+		}
+
+		static bool IsSpace(CharType C) { return C == ' ' || C == '\t' || C == '\n' || C == '\r'; }
+		static bool IsDigit(CharType C) { return C >= '0' && C <= '9'; }
+		static bool IsHex(CharType C) { return IsDigit(C) || (C >= 'a' && C <= 'f') || (C >= 'A' && C <= 'F'); }
+
+		// one pass over the text, accepts comments and trailing commas like the dom parser
+		bool BuildTape() const
+		{
+			const CharType* S = Chars.GetData();
+			const int32 Len = Chars.Num();
+			int32 Pos = 0;
+			// an unterminated block comment runs to the end of the text
+			auto SkipSpace = [&] {
+				while (Pos < Len)
+				{
+					if (IsSpace(S[Pos]))
+					{
+						++Pos;
+					}
+					else if (S[Pos] == '/' && Pos + 1 < Len && S[Pos + 1] == '/')
+					{
+						for (Pos += 2; Pos < Len && S[Pos] != '\n'; ++Pos)
+						{
+						}
+					}
+					else if (S[Pos] == '/' && Pos + 1 < Len && S[Pos + 1] == '*')
+					{
+						for (Pos += 2; Pos < Len && !(S[Pos] == '*' && Pos + 1 < Len && S[Pos + 1] == '/'); ++Pos)
+						{
+						}
+						Pos = Pos < Len ? Pos + 2 : Len;
+					}
+					else
+					{
+						break;
+					}
+				}
+			};
+			// Pos on the opening quote, ends after the closing one
+			auto ScanString = [&](bool& bEscaped) {
+				for (++Pos; Pos < Len; ++Pos)
+				{
+					const CharType C = S[Pos];
+					if (C == '\\')
+					{
+						bEscaped = true;
+						if (++Pos >= Len)
+							return false;
+						const CharType E = S[Pos];
+						if (E == 'u')
+						{
+							if (Pos + 4 >= Len || !IsHex(S[Pos + 1]) || !IsHex(S[Pos + 2]) || !IsHex(S[Pos + 3]) || !IsHex(S[Pos + 4]))
+								return false;
+							Pos += 4;
+						}
+						else if (E != '"' && E != '\\' && E != '/' && E != 'b' && E != 'f' && E != 'n' && E != 'r' && E != 't')
+						{
+							return false;
+						}
+					}
+					else if (C == '"')
+					{
+						++Pos;
+						return true;
+					}
+					else if (uint32(C) < 0x20)
+					{
+						return false;
+					}
+				}
+				return false;
+			};
+			auto ScanLiteral = [&](const char* Lit) {
+				for (; *Lit; ++Lit, ++Pos)
+				{
+					if (Pos >= Len || S[Pos] != CharType(*Lit))
+						return false;
+				}
+				return true;
+			};
+			// -?(0|[1-9][0-9]*)(.[0-9]+)?([eE][+-]?[0-9]+)?
+			auto ScanNumber = [&] {
+				auto ScanDigits = [&] {
+					const int32 Start = Pos;
+					while (Pos < Len && IsDigit(S[Pos]))
+						++Pos;
+					return Pos > Start;
+				};
+				if (Pos < Len && S[Pos] == '-')
+					++Pos;
+				if (Pos < Len && S[Pos] == '0')
+					++Pos;
+				else if (!ScanDigits())
+					return false;
+				if (Pos < Len && S[Pos] == '.')
+				{
+					++Pos;
+					if (!ScanDigits())
+						return false;
+				}
+				if (Pos < Len && (S[Pos] == 'e' || S[Pos] == 'E'))
+				{
+					++Pos;
+					if (Pos < Len && (S[Pos] == '+' || S[Pos] == '-'))
+						++Pos;
+					if (!ScanDigits())
+						return false;
+				}
+				return true;
+			};
+
+			TArray<int32> Stack;
+			TArray<int32> LastChild;
+			TArray<int32> NextSibling;
+			int32 KeyBegin = INDEX_NONE;
+			int32 KeyEnd = INDEX_NONE;
+			bool bKeyEscaped = false;
+			auto ScanKey = [&] {
+				SkipSpace();
+				if (Pos >= Len || S[Pos] != '"')
+					return false;
+				bKeyEscaped = false;
+				KeyBegin = Pos + 1;
+				if (!ScanString(bKeyEscaped))
+					return false;
+				KeyEnd = Pos - 1;
+				SkipSpace();
+				if (Pos >= Len || S[Pos] != ':')
+					return false;
+				++Pos;
+				return true;
+			};
+
+			Tape.Reset();
+			SkipSpace();
+			while (true)
+			{
+				// a value
+				SkipSpace();
+				if (Pos >= Len)
+					return false;
+
+				const int32 Node = Tape.AddDefaulted();
+				NextSibling.Add(INDEX_NONE);
+				Tape[Node].Begin = Pos;
+				if (Stack.Num() > 0)
+				{
+					const int32 Parent = Stack.Last();
+					if (Tape[Parent].Kind == '{')
+					{
+						Tape[Node].KeyBegin = KeyBegin;
+						Tape[Node].KeyEnd = KeyEnd;
+						Tape[Node].bKeyEscaped = bKeyEscaped;
+						Tape[Node].KeyHash = HashKey(S + KeyBegin, KeyEnd - KeyBegin);
+					}
+					++Tape[Parent].NumChildren;
+					if (LastChild.Last() != INDEX_NONE)
+						NextSibling[LastChild.Last()] = Node;
+					else
+						Tape[Parent].FirstChild = Node;
+					LastChild.Last() = Node;
+				}
+
+				const CharType C = S[Pos];
+				bool bValueDone = true;
+				if (C == '{' || C == '[')
+				{
+					Tape[Node].Kind = uint8(C);
+					++Pos;
+					Stack.Add(Node);
+					LastChild.Add(INDEX_NONE);
+					SkipSpace();
+					if (Pos < Len && S[Pos] != (C == '{' ? '}' : ']'))
+					{
+						if (C == '{' && !ScanKey())
+							return false;
+						bValueDone = false;
+					}
+				}
+				else if (C == '"')
+				{
+					bool bEscaped = false;
+					if (!ScanString(bEscaped))
+						return false;
+					Tape[Node].End = Pos;
+				}
+				else
+				{
+					const bool bScalar = C == 't' ? ScanLiteral("true") : C == 'f' ? ScanLiteral("false") : C == 'n' ? ScanLiteral("null") : ScanNumber();
+					if (!bScalar)
+						return false;
+					Tape[Node].End = Pos;
+				}
+
+				// close finished containers until the next value
+				while (bValueDone)
+				{
+					SkipSpace();
+					if (Stack.Num() == 0)
+					{
+						// trailing text is ignored like kParseStopWhenDoneFlag
+						FlattenChildren(NextSibling);
+						return true;
+					}
+					if (Pos >= Len)
+						return false;
+
+					const int32 Top = Stack.Last();
+					const CharType Close = Tape[Top].Kind == '{' ? '}' : ']';
+					if (S[Pos] == Close)
+					{
+						Tape[Top].End = ++Pos;
+						Stack.Pop(EAllowShrinking::No);
+						LastChild.Pop(EAllowShrinking::No);
+					}
+					else if (S[Pos] == ',')
+					{
+						++Pos;
+						SkipSpace();
+						// a trailing comma, the container is closed by the next round
+						if (Pos < Len && S[Pos] == Close)
+							continue;
+						if (Tape[Top].Kind == '{' && !ScanKey())
+							return false;
+						bValueDone = false;
+					}
+					else
+					{
+						return false;
+					}
+				}
+			}
+		}
+
+		void FlattenChildren(const TArray<int32>& NextSibling) const
+		{
+			Children.Reset(Tape.Num());
+			for (auto& Node : Tape)
+			{
+				int32 Child = Node.FirstChild;
+				Node.FirstChild = Children.Num();
+				for (; Child != INDEX_NONE; Child = NextSibling[Child])
+					Children.Add(Child);
+			}
+		}
+
+		TArray<CharType> Chars;
+		mutable TArray<FTapeNode> Tape;
+		mutable TArray<int32> Children;
+		mutable FCriticalSection BuildLock;
+		mutable std::atomic<int32> State{0};
+
+		// per object, (key hash, child) sorted by hash, built on first lookup
+		mutable FRWLock LookupLock;
+		mutable TMap<int32, TUniquePtr<FLookup>> Lookups;
+
+		mutable FRWLock PathLock;
+		mutable TMap<TPair<int32, uint64>, int32> Paths;
+	};
+
+	// what FGMPValueOneOf holds for a lazy value, sub values share the document
+	template<typename CharType>
+	struct TView
+	{
+		TSharedRef<const TDocument<CharType>, ESPMode::ThreadSafe> Doc;
+		int32 Node = 0;
+	};
+
+	bool FromJson(FGMPValueOneOf& Out, FStringView Content);
+	bool FromJson(FGMPValueOneOf& Out, TArray<uint8>&& Utf8Content);
+	// the raw text of a lazy view, false if In is not one
+	bool ToJson(const FGMPValueOneOf& In, FString& Out);
+}  // namespace Lazy
+}  // namespace Json
+}  // namespace GMP
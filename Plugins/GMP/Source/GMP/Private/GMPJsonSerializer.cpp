@@ -2,6 +2,10 @@
 
 #include "GMPJsonSerializer.h"
 
+#include "Async/ParallelFor.h"
+#include "GMPJsonEscape.h"
+#include "GMPJsonHttpClient.h"
+#include "GMPJsonLazyDocument.h"
 #include "GMPJsonSerializer.inl"
 #include "HttpModule.h"
 #include "Interfaces/IHttpRequest.h"
@@ -462,6 +466,12 @@ namespace Json
 			GMP_CHECK(!GIsEditor || Ar.IsSaving());
 			Ar.Serialize(&C, sizeof(C));
 		}
+		bool PutN(const Ch* Str, size_t Len)
+		{
+			GMP_CHECK(!GIsEditor || Ar.IsSaving());
+			Ar.Serialize(const_cast<Ch*>(Str), Len * sizeof(Ch));
+			return true;
+		}
 		friend void PutUnsafe(TArchiveStream& AS, Ch C) { AS.Put(C); }
 
 		Ch Take()
@@ -497,6 +507,136 @@ namespace Json
 		mutable Ch DetectBuf[4];
 	};
 
+	namespace Detail
+	{
+		template<typename OutputStream>
+		std::enable_if_t<sizeof(typename OutputStream::Ch) == sizeof(TCHAR)> WritePlainRun(OutputStream& Os, const TCHAR* Str, int32 Cnt)
+		{
+			Os.PutN(reinterpret_cast<const typename OutputStream::Ch*>(Str), Cnt);
+		}
+
+		template<typename OutputStream>
+		std::enable_if_t<sizeof(typename OutputStream::Ch) == 1> WritePlainRun(OutputStream& Os, const TCHAR* Str, int32 Cnt)
+		{
+			uint8 Buf[256];
+			for (int32 Idx = 0; Idx < Cnt; Idx += UE_ARRAY_COUNT(Buf))
+			{
+				const int32 Num = FMath::Min(Cnt - Idx, (int32)UE_ARRAY_COUNT(Buf));
+				Escape::NarrowPlainChars(Buf, Str + Idx, Num);
+				Os.PutN(Buf, Num);
+			}
+		}
+
+		// writes the leading plain ascii run in bulk, rapidjson handles the char it stops at
+		template<typename OutputStream>
+		bool ScanWritePlainRun(OutputStream& Os, rapidjson::GenericStringStream<rapidjson::UTF16LE<TCHAR>>& Is, size_t Length)
+		{
+			const int32 Remain = static_cast<int32>(Length - Is.Tell());
+			const int32 Cnt = Escape::CountPlainChars(Is.src_, Remain);
+			if (Cnt > 0)
+			{
+				WritePlainRun(Os, Is.src_, Cnt);
+				Is.src_ += Cnt;
+			}
+			return Cnt < Remain;
+		}
+	}  // namespace Detail
+}  // namespace Json
+}  // namespace GMP
+
+// hook rapidjson's string scan the same way it does for StringBuffer with sse2/neon
+#define GMP_JSON_PLAIN_RUN_WRITER(...)                                                                                   \
+	template<>                                                                                                           \
+	inline bool Writer<__VA_ARGS__>::ScanWriteUnescapedString(GenericStringStream<UTF16LE<TCHAR>>& is, size_t length) \
+	{                                                                                                                    \
+		return GMP::Json::Detail::ScanWritePlainRun(*os_, is, length);                                                   \
+	}
+namespace rapidjson
+{
+GMP_JSON_PLAIN_RUN_WRITER(GMP::Json::Serializer::TOutputWrapper<FString>, rapidjson::UTF16LE<TCHAR>, rapidjson::UTF16LE<TCHAR>)
+GMP_JSON_PLAIN_RUN_WRITER(GMP::Json::Serializer::TOutputWrapper<TArray<uint8>>, rapidjson::UTF16LE<TCHAR>, rapidjson::UTF8<uint8>)
+GMP_JSON_PLAIN_RUN_WRITER(GMP::Json::TArchiveStream<TCHAR>, rapidjson::UTF16LE<TCHAR>, rapidjson::UTF16LE<TCHAR>)
+GMP_JSON_PLAIN_RUN_WRITER(GMP::Json::TArchiveStream<uint8>, rapidjson::UTF16LE<TCHAR>, rapidjson::UTF8<uint8>)
+#if GMP_RAPIDJSON_ALLOCATOR_UNREAL
+GMP_JSON_PLAIN_RUN_WRITER(GMP::Json::Serializer::TOutputWrapper<TArray<uint8>>, rapidjson::UTF16LE<TCHAR>, rapidjson::UTF8<uint8>, GMP::Json::Detail::FStackAllocator)
+#endif
+}  // namespace rapidjson
+#undef GMP_JSON_PLAIN_RUN_WRITER
+
+namespace GMP
+{
+namespace Json
+{
+	namespace Detail
+	{
+		template<typename WriterType>
+		struct TWriterAccess : public WriterType
+		{
+			using WriterType::os_;
+			size_t& ValueCount() { return this->level_stack_.template Top<typename WriterType::Level>()->valueCount; }
+		};
+
+		template<typename OutputStream, typename SourceEncoding, typename TargetEncoding, typename StackAllocator, unsigned WriteFlags>
+		struct TParallelWriter<rapidjson::Writer<OutputStream, SourceEncoding, TargetEncoding, StackAllocator, WriteFlags>>
+		{
+			using WriterType = rapidjson::Writer<OutputStream, SourceEncoding, TargetEncoding, StackAllocator, WriteFlags>;
+			using Ch = typename OutputStream::Ch;
+			using FBuffer = std::conditional_t<sizeof(Ch) == 1, TArray<uint8>, FString>;
+			using ChunkWriterType = rapidjson::Writer<Serializer::TOutputWrapper<FBuffer>, SourceEncoding, TargetEncoding, StackAllocator, WriteFlags>;
+
+			static const Ch* GetData(const TArray<uint8>& Buf) { return reinterpret_cast<const Ch*>(Buf.GetData()); }
+			static const Ch* GetData(const FString& Buf) { return reinterpret_cast<const Ch*>(*Buf); }
+			static int32 GetNum(const TArray<uint8>& Buf) { return Buf.Num(); }
+			static int32 GetNum(const FString& Buf) { return Buf.Len(); }
+
+			template<typename F>
+			static bool Write(WriterType& Writer, int32 Num, bool bObject, const F& WriteOne)
+			{
+				const int32 ChunkSize = GMP::Serializer::Parallel::GetChunkSize();
+				const int32 NumChunks = FMath::DivideAndRoundUp(Num, ChunkSize);
+				TArray<FBuffer> Buffers;
+				Buffers.SetNum(NumChunks);
+				TArray<size_t> Counts;
+				Counts.SetNumZeroed(NumChunks);
+
+				// flags are per thread, workers format exactly like the caller
+				const FDefaultJsonFlags CallerFlags = FJsonFlags::Get().Flags;
+				ParallelFor(NumChunks, [&](int32 ChunkIdx) {
+					TGuardValue<FDefaultJsonFlags> FlagsGuard(FJsonFlags::Get().Flags, CallerFlags);
+					GMP::Serializer::Parallel::FChunkScope ChunkScope;
+
+					Serializer::TOutputWrapper<FBuffer> Output{Buffers[ChunkIdx]};
+					ChunkWriterType ChunkWriter{Output};
+					// the opening token is dropped, it only gives the elements a level to count in
+					if (bObject)
+						ChunkWriter.StartObject();
+					else
+						ChunkWriter.StartArray();
+
+					const int32 End = FMath::Min(Num, (ChunkIdx + 1) * ChunkSize);
+					for (int32 i = ChunkIdx * ChunkSize; i < End; ++i)
+					{
+						WriteOne(ChunkWriter, i);
+					}
+					Counts[ChunkIdx] = static_cast<TWriterAccess<ChunkWriterType>&>(ChunkWriter).ValueCount();
+				});
+
+				// same separators as the sequential prefix, key/value parity is kept by the counts
+				auto& Access = static_cast<TWriterAccess<WriterType>&>(Writer);
+				for (int32 ChunkIdx = 0; ChunkIdx < NumChunks; ++ChunkIdx)
+				{
+					if (Counts[ChunkIdx] == 0)
+						continue;
+					if (Access.ValueCount() > 0)
+						Access.os_->Put(',');
+					Access.os_->PutN(GetData(Buffers[ChunkIdx]) + 1, GetNum(Buffers[ChunkIdx]) - 1);
+					Access.ValueCount() += Counts[ChunkIdx];
+				}
+				return true;
+			}
+		};
+	}  // namespace Detail
+
 	bool PropToJsonImpl(FString& Out, FProperty* Prop, const void* ContainerAddr)
 	{
 		using namespace rapidjson;
@@ -546,6 +686,480 @@ namespace Json
 			: GuardVal(Detail::FJsonFlags::Get().Flags.bTryInsituParse, bInInsituParse)
 		{
 		}
+
+		//////////////////////////////////////////////////////////////////////////
+		TSharedRef<FJsonSchemaProgram, ESPMode::ThreadSafe> FJsonSchemaProgram::Compile(UStruct* Struct, const FJsonSchemaOptions& InOptions)
+		{
+			auto Program = MakeShared<FJsonSchemaProgram, ESPMode::ThreadSafe>();
+			Program->Root = Struct;
+			Program->Options = InOptions;
+			Program->NumericFmt = Serializer::FNumericFormatter::GetType();
+			Program->bConvertCase = Serializer::FCaseFormatter::GetType();
+			if (ensure(Struct))
+				Program->CompileStruct(Struct);
+			return Program;
+		}
+
+		static bool IsOpaqueStruct(const UStruct* Struct)
+		{
+			// read by dedicated overloads, fields are not visited
+			if (Struct->IsChildOf(GMP::Reflection::DynamicStruct<FGMPStructUnion>()))
+				return true;
+#if WITH_GMPVALUE_ONEOF
+			if (Struct->IsChildOf(GMP::Reflection::DynamicStruct<FGMPValueOneOf>()))
+				return true;
+#endif
+#if defined(STRUCTUTILS_API)
+			if (Struct->IsChildOf(GMP::Reflection::DynamicStruct<FInstancedStruct>()))
+				return true;
+#endif
+			return Struct->GetFName() == GMP::Serializer::NAME_DateTime || Struct->GetFName() == GMP::Serializer::NAME_Text;
+		}
+
+		void FJsonSchemaProgram::CompileStruct(const UStruct* Struct)
+		{
+			if (StructIndices.Contains(Struct) || IsOpaqueStruct(Struct))
+				return;
+
+			// indexed before the fields so recursive structs terminate
+			const int32 Index = Structs.AddDefaulted();
+			StructIndices.Add(Struct, Index);
+
+			FJsonStructRules StructRules;
+			StructRules.Struct = Struct;
+			const bool bUserDefined = Struct->IsA(UUserDefinedStruct::StaticClass());
+			for (TFieldIterator<FProperty> It(Struct); It; ++It)
+			{
+				if (It->HasAnyPropertyFlags(CPF_Deprecated | CPF_Transient | CPF_SkipSerialization | CPF_EditorOnly))
+					continue;
+				CompileProp(*It, &StructRules, bUserDefined);
+			}
+			Structs[Index] = MoveTemp(StructRules);
+		}
+
+		void FJsonSchemaProgram::CompileProp(FProperty* Prop, FJsonStructRules* Owner, bool bUserDefined)
+		{
+			using ENumericFmt = Serializer::FNumericFormatter::ENumericFmt;
+			FJsonFieldRule Rule;
+
+			if (Owner)
+			{
+				FString Name = (bUserDefined ? GMP::Serializer::GetAuthoredFNameForField(Prop->GetFName()) : Prop->GetFName()).ToString();
+				if (bConvertCase)
+					Serializer::FCaseFormatter::StandardizeCase(GetData(Name), Name.Len());
+				Rule.JsonName = *Name;
+
+				bool bRequired = Options.bRequireAll;
+#if WITH_METADATA
+				bRequired |= Prop->HasMetaData(TEXT("JsonRequired"));
+#endif
+				if (bRequired)
+				{
+					Rule.RequiredSlot = Owner->NumRequired++;
+					Owner->Required.Add(Prop);
+				}
+			}
+
+			auto SetIntRange = [&](int64 Min, uint64 Max) {
+				Rule.bIntegral = true;
+				Rule.IntMin = Min;
+				Rule.IntMax = Max;
+			};
+
+			if (CastField<FBoolProperty>(Prop))
+			{
+				Rule.Accepts = EJsonKind::Bool;
+				if (!EnumHasAnyFlags(NumericFmt, ENumericFmt::BoolAsBoolean))
+				{
+					Rule.Accepts |= EJsonKind::Number;
+					SetIntRange(0, 1);
+				}
+			}
+			else if (auto EnumProp = CastField<FEnumProperty>(Prop))
+			{
+				Rule.Enum = EnumProp->GetEnum();
+				Rule.Accepts = EJsonKind::Number | EJsonKind::String;
+				Rule.bIntegral = true;
+			}
+			else if (auto NumericProp = CastField<FNumericProperty>(Prop))
+			{
+				Rule.Accepts = EJsonKind::Number;
+				if (UEnum* EnumDef = NumericProp->GetIntPropertyEnum())
+				{
+					Rule.Enum = EnumDef;
+					Rule.Accepts |= EJsonKind::String;
+					Rule.bIntegral = true;
+				}
+				else if (Prop->IsA<FInt8Property>())
+					SetIntRange(MIN_int8, MAX_int8);
+				else if (Prop->IsA<FByteProperty>())
+					SetIntRange(0, MAX_uint8);
+				else if (Prop->IsA<FInt16Property>())
+					SetIntRange(MIN_int16, MAX_int16);
+				else if (Prop->IsA<FUInt16Property>())
+					SetIntRange(0, MAX_uint16);
+				else if (Prop->IsA<FIntProperty>())
+					SetIntRange(MIN_int32, MAX_int32);
+				else if (Prop->IsA<FUInt32Property>())
+					SetIntRange(0, MAX_uint32);
+				else if (Prop->IsA<FInt64Property>() || Prop->IsA<FUInt64Property>())
+				{
+					const bool bUnsigned = Prop->IsA<FUInt64Property>();
+					SetIntRange(bUnsigned ? 0 : MIN_int64, bUnsigned ? MAX_uint64 : (uint64)MAX_int64);
+					if (EnumHasAnyFlags(NumericFmt, ENumericFmt((bUnsigned ? ENumericFmt::UInt64AsStr : ENumericFmt::Int64AsStr) | ENumericFmt::OverflowAsStr)))
+						Rule.Accepts |= EJsonKind::String;
+				}
+			}
+			else if (Prop->IsA<FStrProperty>() || Prop->IsA<FNameProperty>() || Prop->IsA<FSoftObjectProperty>())
+			{
+				Rule.Accepts = EJsonKind::String;
+			}
+			else if (Prop->IsA<FTextProperty>())
+			{
+				Rule.Accepts = EJsonKind::String | EJsonKind::Object;
+			}
+			else if (auto StructProp = CastField<FStructProperty>(Prop))
+			{
+				// string payloads are imported as text by the reader
+				Rule.Accepts = EJsonKind::Object | EJsonKind::String;
+#if WITH_GMPVALUE_ONEOF
+				if (StructProp->Struct->IsChildOf(GMP::Reflection::DynamicStruct<FGMPValueOneOf>()))
+					Rule.Accepts = EJsonKind::Any;
+#endif
+				if (StructProp->Struct->GetFName() == GMP::Serializer::NAME_DateTime)
+					Rule.Accepts |= EJsonKind::Number;
+				CompileStruct(StructProp->Struct);
+			}
+			else if (auto ArrayProp = CastField<FArrayProperty>(Prop))
+			{
+				Rule.Accepts = EJsonKind::Array;
+				CompileProp(ArrayProp->Inner, nullptr, bUserDefined);
+			}
+			else if (auto SetProp = CastField<FSetProperty>(Prop))
+			{
+				Rule.Accepts = EJsonKind::Array;
+				CompileProp(SetProp->ElementProp, nullptr, bUserDefined);
+			}
+			else if (auto MapProp = CastField<FMapProperty>(Prop))
+			{
+				Rule.Accepts = EJsonKind::Object;
+				CompileProp(MapProp->ValueProp, nullptr, bUserDefined);
+			}
+			else
+			{
+				// everything else goes through ImportText
+				Rule.Accepts = EJsonKind::String;
+			}
+
+			if (Options.bAllowNull)
+				Rule.Accepts |= EJsonKind::Null;
+
+#if WITH_METADATA
+			if (Prop->HasMetaData(TEXT("ClampMin")))
+			{
+				const double ClampMin = Prop->GetFloatMetaData(TEXT("ClampMin"));
+				Rule.Min = Rule.bHasMin ? FMath::Max(Rule.Min, ClampMin) : ClampMin;
+				Rule.bHasMin = true;
+			}
+			if (Prop->HasMetaData(TEXT("ClampMax")))
+			{
+				const double ClampMax = Prop->GetFloatMetaData(TEXT("ClampMax"));
+				Rule.Max = Rule.bHasMax ? FMath::Min(Rule.Max, ClampMax) : ClampMax;
+				Rule.bHasMax = true;
+			}
+#endif
+			Rules.Add(Prop, Rule);
+		}
+
+		bool FJsonSchemaProgram::SetRequired(const UStruct* Owner, FName FieldName)
+		{
+			auto Idx = StructIndices.Find(Owner);
+			FProperty* Prop = Owner ? Owner->FindPropertyByName(FieldName) : nullptr;
+			FJsonFieldRule* Rule = Prop ? Rules.Find(Prop) : nullptr;
+			if (!Idx || !Rule)
+				return false;
+
+			if (Rule->RequiredSlot == INDEX_NONE)
+			{
+				auto& StructRules = Structs[*Idx];
+				Rule->RequiredSlot = StructRules.NumRequired++;
+				StructRules.Required.Add(Prop);
+			}
+			return true;
+		}
+
+		bool FJsonSchemaProgram::SetRange(const UStruct* Owner, FName FieldName, TOptional<double> Min, TOptional<double> Max)
+		{
+			FProperty* Prop = Owner ? Owner->FindPropertyByName(FieldName) : nullptr;
+			FJsonFieldRule* Rule = Prop ? Rules.Find(Prop) : nullptr;
+			if (!Rule || !EnumHasAnyFlags(Rule->Accepts, EJsonKind::Number))
+				return false;
+
+			if (Min.IsSet())
+			{
+				Rule->Min = Rule->bHasMin ? FMath::Max(Rule->Min, Min.GetValue()) : Min.GetValue();
+				Rule->bHasMin = true;
+			}
+			if (Max.IsSet())
+			{
+				Rule->Max = Rule->bHasMax ? FMath::Min(Rule->Max, Max.GetValue()) : Max.GetValue();
+				Rule->bHasMax = true;
+			}
+			return true;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		static thread_local FJsonValidateScope* CurrentValidateScope = nullptr;
+
+		FJsonValidateScope::FJsonValidateScope(const FJsonSchemaProgram& InProgram, TArray<FJsonValidationError>& InErrors)
+			: Program(InProgram)
+			, Errors(InErrors)
+			, ErrorsBase(InErrors.Num())
+			, Outer(CurrentValidateScope)
+		{
+			CurrentValidateScope = this;
+		}
+		FJsonValidateScope::~FJsonValidateScope()
+		{
+			check(CurrentValidateScope == this);
+			CurrentValidateScope = Outer;
+		}
+		FJsonValidateScope* FJsonValidateScope::Current()
+		{
+			return CurrentValidateScope;
+		}
+
+		static const TCHAR* KindToString(EJsonKind Kind)
+		{
+			if (EnumHasAnyFlags(Kind, EJsonKind::Object))
+				return TEXT("object");
+			if (EnumHasAnyFlags(Kind, EJsonKind::Array))
+				return TEXT("array");
+			if (EnumHasAnyFlags(Kind, EJsonKind::String))
+				return TEXT("string");
+			if (EnumHasAnyFlags(Kind, EJsonKind::Number))
+				return TEXT("number");
+			if (EnumHasAnyFlags(Kind, EJsonKind::Bool))
+				return TEXT("boolean");
+			return TEXT("null");
+		}
+
+		bool FJsonValidateScope::CheckKind(const FJsonFieldRule& Rule, EJsonKind Kind)
+		{
+			if (EnumHasAnyFlags(Rule.Accepts, Kind))
+				return true;
+			Report(FString::Printf(TEXT("expected %s, got %s"), KindToString(Rule.Accepts & ~EJsonKind::Null), KindToString(Kind)));
+			return false;
+		}
+
+		static FString NumberToString(double Val) { return FString::Printf(TEXT("%g"), Val); }
+		static FString NumberToString(int64 Val) { return FString::Printf(TEXT("%lld"), Val); }
+		static FString NumberToString(uint64 Val) { return FString::Printf(TEXT("%llu"), Val); }
+		static FString IntRangeError(const FJsonFieldRule& Rule, const FString& Val) { return FString::Printf(TEXT("%s is out of range [%lld, %llu]"), *Val, Rule.IntMin, Rule.IntMax); }
+
+		static int32 CompareToBound(double Val, double Bound) { return Val < Bound ? -1 : (Val > Bound ? 1 : 0); }
+		template<typename IntType>
+		static int32 CompareToBound(IntType Val, double Bound)
+		{
+			const double Rounded = (double)Val;
+			if (Rounded != Bound)
+				return Rounded < Bound ? -1 : 1;
+			// equal once rounded, only the max of the type rounds up past what it can hold
+			if (Bound >= (double)TNumericLimits<IntType>::Max())
+				return -1;
+			const IntType IntBound = (IntType)Bound;
+			return Val < IntBound ? -1 : (Val > IntBound ? 1 : 0);
+		}
+
+		template<typename T>
+		bool FJsonValidateScope::CheckBounds(const FJsonFieldRule& Rule, T Val)
+		{
+			if (Rule.Enum && !Rule.Enum->IsValidEnumValue((int64)Val))
+			{
+				Report(FString::Printf(TEXT("%s is not a member of %s"), *NumberToString(Val), *Rule.Enum->GetName()));
+				return false;
+			}
+			if ((Rule.bHasMin && CompareToBound(Val, Rule.Min) < 0) || (Rule.bHasMax && CompareToBound(Val, Rule.Max) > 0))
+			{
+				Report(FString::Printf(TEXT("%s is out of range [%g, %g]"), *NumberToString(Val), Rule.bHasMin ? Rule.Min : TNumericLimits<double>::Lowest(), Rule.bHasMax ? Rule.Max : TNumericLimits<double>::Max()));
+				return false;
+			}
+			return true;
+		}
+
+		bool FJsonValidateScope::CheckNumber(const FJsonFieldRule& Rule, double Val)
+		{
+			if (!CheckKind(Rule, EJsonKind::Number))
+				return false;
+			if (!Rule.bIntegral)
+				return CheckBounds(Rule, Val);
+
+			if (FMath::FloorToDouble(Val) != Val)
+			{
+				Report(FString::Printf(TEXT("%g is not an integer"), Val));
+				return false;
+			}
+			// integral doubles are checked as integers against the exact type range
+			if (Val < 0.0 && Val >= (double)MIN_int64)
+				return CheckNumber(Rule, (int64)Val);
+			if (Val >= 0.0 && Val < 18446744073709551616.0)
+				return CheckNumber(Rule, (uint64)Val);
+			Report(IntRangeError(Rule, NumberToString(Val)));
+			return false;
+		}
+
+		bool FJsonValidateScope::CheckNumber(const FJsonFieldRule& Rule, int64 Val)
+		{
+			if (Val >= 0)
+				return CheckNumber(Rule, (uint64)Val);
+			if (!CheckKind(Rule, EJsonKind::Number))
+				return false;
+			if (Rule.bIntegral && Val < Rule.IntMin)
+			{
+				Report(IntRangeError(Rule, NumberToString(Val)));
+				return false;
+			}
+			return CheckBounds(Rule, Val);
+		}
+
+		bool FJsonValidateScope::CheckNumber(const FJsonFieldRule& Rule, uint64 Val)
+		{
+			if (!CheckKind(Rule, EJsonKind::Number))
+				return false;
+			if (Rule.bIntegral && Val > Rule.IntMax)
+			{
+				Report(IntRangeError(Rule, NumberToString(Val)));
+				return false;
+			}
+			return CheckBounds(Rule, Val);
+		}
+
+		// plain decimal integers only, anything else is left to the double path
+		static bool ParseIntegral(const FString& Str, bool& bNegative, uint64& Magnitude)
+		{
+			const TCHAR* Ch = *Str;
+			bNegative = *Ch == TEXT('-');
+			if (bNegative || *Ch == TEXT('+'))
+				++Ch;
+			if (!*Ch)
+				return false;
+			Magnitude = 0;
+			for (; *Ch; ++Ch)
+			{
+				if (!FChar::IsDigit(*Ch))
+					return false;
+				const uint64 Digit = *Ch - TEXT('0');
+				if (Magnitude > (MAX_uint64 - Digit) / 10)
+					return false;
+				Magnitude = Magnitude * 10 + Digit;
+			}
+			return true;
+		}
+
+		bool FJsonValidateScope::CheckString(const FJsonFieldRule& Rule, const StringView& Val)
+		{
+			if (!CheckKind(Rule, EJsonKind::String))
+				return false;
+			if (Rule.Enum)
+			{
+				FString Str = Val;
+				if (Rule.Enum->GetValueByNameString(Str) == INDEX_NONE)
+				{
+					Report(FString::Printf(TEXT("%s is not a member of %s"), *Str, *Rule.Enum->GetName()));
+					return false;
+				}
+			}
+			else if (Rule.bIntegral || Rule.bHasMin || Rule.bHasMax)
+			{
+				// 64 bit integers written as strings
+				FString Str = Val;
+				if (!FCString::IsNumeric(*Str))
+				{
+					Report(FString::Printf(TEXT("%s is not a number"), *Str));
+					return false;
+				}
+				bool bNegative = false;
+				uint64 Magnitude = 0;
+				if (ParseIntegral(Str, bNegative, Magnitude) && (!bNegative || Magnitude <= (uint64)MAX_int64 + 1))
+					return bNegative ? CheckNumber(Rule, (int64)(0 - Magnitude)) : CheckNumber(Rule, Magnitude);
+				return CheckNumber(Rule, FCString::Atod(*Str));
+			}
+			return true;
+		}
+
+		void FJsonValidateScope::BeginStruct(const UStruct* Struct, FStructState& State)
+		{
+			State.Rules = Program.FindStruct(Struct);
+			if (State.Rules && State.Rules->NumRequired > 0)
+				State.Seen.Init(false, State.Rules->NumRequired);
+		}
+
+		void FJsonValidateScope::MarkField(FStructState& State, const FProperty* Prop)
+		{
+			if (!State.Seen.Num())
+				return;
+			auto Rule = Program.FindRule(Prop);
+			if (Rule && Rule->RequiredSlot != INDEX_NONE)
+				State.Seen[Rule->RequiredSlot] = true;
+		}
+
+		void FJsonValidateScope::EndStruct(FStructState& State)
+		{
+			for (int32 Slot = 0; Slot < State.Seen.Num(); ++Slot)
+			{
+				if (State.Seen[Slot])
+					continue;
+				auto Rule = Program.FindRule(State.Rules->Required[Slot]);
+				Report(TEXT("missing required field"), Rule ? Rule->JsonName : State.Rules->Required[Slot]->GetFName());
+			}
+		}
+
+		void FJsonValidateScope::UnknownField(const StringView& Key)
+		{
+			if (!Program.GetOptions().bRejectUnknown)
+				return;
+			PushKey(Key);
+			Report(TEXT("unknown field"));
+			Pop();
+		}
+
+		static void AppendPointerToken(FString& Out, FStringView Token)
+		{
+			Out.AppendChar(TEXT('/'));
+			for (TCHAR Ch : Token)
+			{
+				if (Ch == TEXT('~'))
+					Out += TEXT("~0");
+				else if (Ch == TEXT('/'))
+					Out += TEXT("~1");
+				else
+					Out.AppendChar(Ch);
+			}
+		}
+
+		FString FJsonValidateScope::BuildPointer(FName Leaf) const
+		{
+			FString Ret;
+			for (auto& Segment : Path)
+			{
+				if (Segment.Key.IsValid())
+					AppendPointerToken(Ret, Segment.Key.ToFString());
+				else if (Segment.Index != INDEX_NONE)
+					Ret += FString::Printf(TEXT("/%d"), Segment.Index);
+				else
+					AppendPointerToken(Ret, Segment.Name.ToString());
+			}
+			if (!Leaf.IsNone())
+				AppendPointerToken(Ret, Leaf.ToString());
+			return Ret;
+		}
+
+		void FJsonValidateScope::Report(const FString& Message, FName Leaf)
+		{
+			if (Errors.Num() - ErrorsBase >= Program.GetOptions().MaxErrors)
+				return;
+			Errors.Add({BuildPointer(Leaf), Message});
+		}
 	}  // namespace Deserializer
 
 	bool PropFromJsonImpl(FStringView In, FProperty* Prop, void* ContainerAddr)
@@ -618,7 +1232,8 @@ namespace Json
 
 	bool PropFromJsonImpl(TSharedPtr<IHttpResponse, ESPMode::ThreadSafe>& Rsp, FProperty* Prop, void* ContainerAddr)
 	{
-		return PropFromJsonImpl(MoveTemp(const_cast<TArray<uint8>&>(Rsp->GetContent())), Prop, ContainerAddr);
+		// the response keeps its content, parse it where it is instead of copying it for an in place parse
+		return PropFromJsonImpl(TArrayView<const uint8>(Rsp->GetContent()), Prop, ContainerAddr);
 	}
 
 	bool PropFromJsonImpl(FString& In, FProperty* Prop, void* ContainerAddr)
@@ -1001,6 +1616,239 @@ namespace Json
 }  // namespace Json
 }  // namespace GMP
 
+namespace GMP
+{
+namespace Json
+{
+	namespace Lazy
+	{
+		template<typename CharType>
+		using TEncoding = std::conditional_t<sizeof(CharType) == 1, rapidjson::UTF8<uint8>, rapidjson::UTF16LE<TCHAR>>;
+		template<typename CharType>
+		using TDocType = Detail::TGenericDocument<TEncoding<CharType>>;
+		template<typename CharType>
+		using TDocRef = TSharedRef<const TDocument<CharType>, ESPMode::ThreadSafe>;
+
+		template<typename CharType>
+		void SetView(FGMPValueOneOf& Out, TDocRef<CharType> Doc, int32 Node)
+		{
+			auto& Holder = FriendGMPValueOneOf(Out);
+			Holder.Value = MakeShared<TView<CharType>, ESPMode::ThreadSafe>(TView<CharType>{MoveTemp(Doc), Node});
+			Holder.Flags = FlagLazy | sizeof(CharType);
+		}
+
+		template<typename CharType>
+		bool FromChars(FGMPValueOneOf& Out, TArray<CharType>&& Chars)
+		{
+			int32 Pos = 0;
+			while (Pos < Chars.Num() && FChar::IsWhitespace(TCHAR(Chars[Pos])))
+				++Pos;
+			if (Pos == Chars.Num())
+				return false;
+			// the structure pass runs here so malformed text is rejected, member lookups and scalars stay lazy
+			auto Doc = MakeShared<TDocument<CharType>, ESPMode::ThreadSafe>(MoveTemp(Chars));
+			if (!Doc->EnsureIndexed())
+				return false;
+			SetView<CharType>(Out, MoveTemp(Doc), 0);
+			return true;
+		}
+
+		bool FromJson(FGMPValueOneOf& Out, FStringView Content)
+		{
+			return FromChars(Out, TArray<TCHAR>(Content.GetData(), Content.Len()));
+		}
+		bool FromJson(FGMPValueOneOf& Out, TArray<uint8>&& Utf8Content)
+		{
+			// skip the utf8 bom
+			if (Utf8Content.Num() >= 3 && Utf8Content[0] == 0xEF && Utf8Content[1] == 0xBB && Utf8Content[2] == 0xBF)
+				Utf8Content.RemoveAt(0, 3, EAllowShrinking::No);
+			return FromChars(Out, MoveTemp(Utf8Content));
+		}
+
+		template<typename CharType>
+		FString ToFString(const CharType* Str, int32 Len)
+		{
+			return StringView(uint32(Len), Str).ToFString();
+		}
+
+		template<typename CharType>
+		FString DecodeKey(const TDocument<CharType>& Doc, const FTapeNode& Node)
+		{
+			if (!Node.bKeyEscaped)
+				return ToFString(Doc.GetData() + Node.KeyBegin, Node.KeyEnd - Node.KeyBegin);
+
+			// unescape through the parser, quotes included
+			using namespace rapidjson;
+			TDocType<CharType> Document;
+			Document.template Parse<kParseStopWhenDoneFlag | kParseCommentsFlag | kParseTrailingCommasFlag>(Doc.GetData() + Node.KeyBegin - 1, Node.KeyEnd - Node.KeyBegin + 2);
+			if (Document.HasParseError() || !Document.IsString())
+				return FString();
+			return ToFString(Document.GetString(), Document.GetStringLength());
+		}
+
+		template<typename CharType>
+		int32 FindMember(const TView<CharType>& View, FName SubKey)
+		{
+			if (!View.Doc->EnsureIndexed())
+				return INDEX_NONE;
+			if (SubKey.IsNone())
+				return View.Node;
+
+			const FString KeyStr = SubKey.ToString();
+			auto MatchEscaped = [&](const FTapeNode& Node) { return DecodeKey(*View.Doc, Node).Equals(KeyStr, ESearchCase::IgnoreCase); };
+			GMP_IF_CONSTEXPR(sizeof(CharType) == 1)
+			{
+				FTCHARToUTF8 Utf8(*KeyStr);
+				return View.Doc->FindMember(View.Node, reinterpret_cast<const CharType*>(Utf8.Get()), Utf8.Length(), MatchEscaped);
+			}
+			else
+			{
+				return View.Doc->FindMember(View.Node, reinterpret_cast<const CharType*>(*KeyStr), KeyStr.Len(), MatchEscaped);
+			}
+		}
+
+		template<typename CharType>
+		bool ReadNode(const TView<CharType>& View, int32 Node, FProperty* Prop, void* Out)
+		{
+			// sub values stay views over the same text
+			auto StructProp = CastField<FStructProperty>(Prop);
+			if (StructProp && StructProp->Struct->IsChildOf(GMP::Reflection::DynamicStruct<FGMPValueOneOf>()))
+			{
+				SetView<CharType>(*reinterpret_cast<FGMPValueOneOf*>(Out), View.Doc, Node);
+				return true;
+			}
+
+			// only the bytes of this value are parsed
+			using namespace rapidjson;
+			auto& TapeNode = View.Doc->GetNode(Node);
+			TDocType<CharType> Document;
+			Document.template Parse<kParseStopWhenDoneFlag | kParseCommentsFlag | kParseTrailingCommasFlag>(View.Doc->GetData() + TapeNode.Begin, TapeNode.End - TapeNode.Begin);
+			if (Document.HasParseError() || Document.IsNull())
+				return false;
+			return Detail::ReadFromJson(static_cast<typename TDocType<CharType>::ValueType&>(Document), Prop, Out);
+		}
+
+		template<typename CharType>
+		bool AsValue(const TView<CharType>& View, FProperty* Prop, void* Out, FName SubKey)
+		{
+			const int32 Node = FindMember(View, SubKey);
+			return Node != INDEX_NONE && ReadNode(View, Node, Prop, Out);
+		}
+
+		template<typename CharType>
+		int32 FindMember(const TDocument<CharType>& Doc, int32 Node, const FGMPValuePathStep& Step)
+		{
+			auto MatchEscaped = [&](const FTapeNode& Child) { return DecodeKey(Doc, Child).Equals(Step.Key, ESearchCase::IgnoreCase); };
+			// ascii keys hash the same in both encodings
+			if (sizeof(CharType) != sizeof(uint8) || Step.bAscii)
+				return Doc.FindMember(Node, uint32(Step.Hash), *Step.Key, Step.Key.Len(), MatchEscaped);
+
+			FTCHARToUTF8 Utf8(*Step.Key);
+			return Doc.FindMember(Node, reinterpret_cast<const CharType*>(Utf8.Get()), Utf8.Length(), MatchEscaped);
+		}
+
+		template<typename CharType>
+		int32 FindPath(const TView<CharType>& View, const FGMPValuePath& Path)
+		{
+			if (!View.Doc->EnsureIndexed())
+				return INDEX_NONE;
+
+			int32 Node = View.Node;
+			if (Path.Steps.Num() == 0 || View.Doc->FindPath(View.Node, uint64(Path.PathHash), Node))
+				return Node;
+
+			for (auto& Step : Path.Steps)
+			{
+				Node = Step.Index != INDEX_NONE ? View.Doc->GetElement(Node, Step.Index) : FindMember(*View.Doc, Node, Step);
+				if (Node == INDEX_NONE)
+					break;
+			}
+			View.Doc->AddPath(View.Node, uint64(Path.PathHash), Node);
+			return Node;
+		}
+
+		template<typename CharType>
+		bool AsValue(const TView<CharType>& View, FProperty* Prop, void* Out, const FGMPValuePath& Path)
+		{
+			const int32 Node = FindPath(View, Path);
+			return Node != INDEX_NONE && ReadNode(View, Node, Prop, Out);
+		}
+
+		// parsed documents step through the dom
+		template<typename ValueType>
+		const ValueType* FindPath(const ValueType& Root, const FGMPValuePath& Path)
+		{
+			namespace Helper = Detail::JsonUtils;
+			const ValueType* Val = &Root;
+			for (auto& Step : Path.Steps)
+			{
+				if (Step.Index != INDEX_NONE)
+				{
+					if (!Helper::IsArrayType(*Val) || Step.Index >= Helper::ArraySize(*Val))
+						return nullptr;
+					Val = &Helper::ArrayElm(*Val, Step.Index);
+				}
+				else
+				{
+					if (!Helper::IsObjectType(*Val))
+						return nullptr;
+					Val = Helper::FindMember(*Val, FName(*Step.Key));
+					if (!Val)
+						return nullptr;
+				}
+			}
+			return Val;
+		}
+
+		template<typename CharType>
+		int32 IterateKeyValue(const TView<CharType>& View, int32 Idx, FString& OutKey, FGMPValueOneOf& OutValue)
+		{
+			if (!View.Doc->EnsureIndexed())
+				return 0;
+			auto& Obj = View.Doc->GetNode(View.Node);
+			if (GMP_ENSURE_JSON(Idx < 0 || Obj.Kind != '{') || Idx >= Obj.NumChildren)
+				return 0;
+
+			const int32 Child = View.Doc->GetChild(View.Node, Idx);
+			OutKey = DecodeKey(*View.Doc, View.Doc->GetNode(Child));
+			SetView<CharType>(OutValue, View.Doc, Child);
+			return ++Idx < Obj.NumChildren ? Idx : INDEX_NONE;
+		}
+
+		template<typename CharType>
+		FString ToJsonStr(const TView<CharType>& View)
+		{
+			if (!View.Doc->EnsureIndexed())
+				return FString();
+			auto& TapeNode = View.Doc->GetNode(View.Node);
+			return ToFString(View.Doc->GetData() + TapeNode.Begin, TapeNode.End - TapeNode.Begin);
+		}
+
+		// calls Op with the typed view of a lazy holder
+		template<typename F>
+		void Visit(const FGMPValueOneOf& In, const F& Op)
+		{
+			auto& Holder = FriendGMPValueOneOf(In);
+			GMP_CHECK_SLOW(Holder.Flags & FlagLazy);
+			// keep the view alive if Op overwrites In
+			auto Value = Holder.Value;
+			if ((Holder.Flags & ~FlagLazy) == sizeof(uint8))
+				Op(*StaticCastSharedPtr<TView<uint8>>(Value));
+			else
+				Op(*StaticCastSharedPtr<TView<TCHAR>>(Value));
+		}
+
+		bool ToJson(const FGMPValueOneOf& In, FString& Out)
+		{
+			if (!In.IsValid() || !(FriendGMPValueOneOf(In).Flags & FlagLazy))
+				return false;
+			Visit(In, [&](const auto& View) { Out = ToJsonStr(View); });
+			return true;
+		}
+	}  // namespace Lazy
+}  // namespace Json
+}  // namespace GMP
+
 int32 UGMPJsonUtils::IterateKeyValueImpl(const FGMPValueOneOf& In, int32 Idx, FString& OutKey, FGMPValueOneOf& OutValue)
 {
 	int32 RetIdx = INDEX_NONE;
@@ -1012,7 +1860,11 @@ int32 UGMPJsonUtils::IterateKeyValueImpl(const FGMPValueOneOf& In, int32 Idx, FS
 			break;
 
 #if WITH_GMPVALUE_ONEOF
-		if (OneOfPtr->Flags == sizeof(uint8))
+		if (OneOfPtr->Flags & GMP::Json::Lazy::FlagLazy)
+		{
+			GMP::Json::Lazy::Visit(In, [&](const auto& View) { RetIdx = GMP::Json::Lazy::IterateKeyValue(View, Idx, OutKey, OutValue); });
+		}
+		else if (OneOfPtr->Flags == sizeof(uint8))
 		{
 			using DocType = GMP::Json::Detail::TGenericDocument<rapidjson::UTF8<uint8>>;
 			auto Ptr = StaticCastSharedPtr<DocType>(OneOfPtr->Value);
@@ -1053,7 +1905,11 @@ bool UGMPJsonUtils::AsValueImpl(const FGMPValueOneOf& In, FProperty* Prop, void*
 			break;
 
 #if WITH_GMPVALUE_ONEOF
-		if (OneOfPtr->Flags == sizeof(uint8))
+		if (OneOfPtr->Flags & GMP::Json::Lazy::FlagLazy)
+		{
+			GMP::Json::Lazy::Visit(In, [&](const auto& View) { bRet = GMP::Json::Lazy::AsValue(View, Prop, Out, SubKey); });
+		}
+		else if (OneOfPtr->Flags == sizeof(uint8))
 		{
 			using DocType = GMP::Json::Detail::TGenericDocument<rapidjson::UTF8<uint8>>;
 			auto Ptr = StaticCastSharedPtr<DocType>(OneOfPtr->Value);
@@ -1077,6 +1933,81 @@ bool UGMPJsonUtils::AsValueImpl(const FGMPValueOneOf& In, FProperty* Prop, void*
 	return bRet;
 }
 
+bool UGMPJsonUtils::AsValueImpl(const FGMPValueOneOf& In, FProperty* Prop, void* Out, const FGMPValuePath& Path)
+{
+	if (!Path.IsCompiled())
+	{
+		FGMPValuePath Compiled;
+		return Compiled.Compile(Path.Path) && AsValueImpl(In, Prop, Out, Compiled);
+	}
+
+	bool bRet = false;
+	do
+	{
+		auto OneOfPtr = &GMP::Json::FriendGMPValueOneOf(In);
+
+		if (!OneOfPtr->IsValid())
+			break;
+
+#if WITH_GMPVALUE_ONEOF
+		if (OneOfPtr->Flags & GMP::Json::Lazy::FlagLazy)
+		{
+			GMP::Json::Lazy::Visit(In, [&](const auto& View) { bRet = GMP::Json::Lazy::AsValue(View, Prop, Out, Path); });
+		}
+		else if (OneOfPtr->Flags == sizeof(uint8))
+		{
+			using DocType = GMP::Json::Detail::TGenericDocument<rapidjson::UTF8<uint8>>;
+			auto Ptr = StaticCastSharedPtr<DocType>(OneOfPtr->Value);
+			auto SubPtr = GMP::Json::Lazy::FindPath(static_cast<DocType::ValueType&>(*Ptr), Path);
+			bRet = SubPtr && !SubPtr->IsNull() && GMP::Json::Detail::ReadFromJson(*SubPtr, Prop, Out);
+		}
+		else if (OneOfPtr->Flags == sizeof(TCHAR))
+		{
+			using DocType = GMP::Json::Detail::TGenericDocument<rapidjson::UTF16LE<TCHAR>>;
+			auto Ptr = StaticCastSharedPtr<DocType>(OneOfPtr->Value);
+			auto SubPtr = GMP::Json::Lazy::FindPath(static_cast<DocType::ValueType&>(*Ptr), Path);
+			bRet = SubPtr && !SubPtr->IsNull() && GMP::Json::Detail::ReadFromJson(*SubPtr, Prop, Out);
+		}
+		else
+		{
+			bool bUnreachable = false;
+			(void)GMP_ENSURE_JSON(bUnreachable);
+		}
+#endif
+	} while (false);
+	return bRet;
+}
+
+FGMPValuePath UGMPJsonUtils::CompileValuePath(const FString& InPath)
+{
+	// a connected path pin calls this every time the node runs, usually with the same few strings
+	struct FRecent
+	{
+		FString Str;
+		FGMPValuePath Path;
+	};
+	static constexpr int32 NumRecent = 8;
+	static thread_local FRecent Recent[NumRecent];
+	static thread_local int32 NextRecent = 0;
+	for (const FRecent& Entry : Recent)
+	{
+		if (!Entry.Str.IsEmpty() && Entry.Str.Equals(InPath, ESearchCase::CaseSensitive))
+			return Entry.Path;
+	}
+
+	FGMPValuePath Path;
+	FString Error;
+	const bool bSucc = Path.Compile(InPath, &Error);
+	GMP_CWARNING(!bSucc, TEXT("CompileValuePath : %s"), *Error);
+	// failures are not kept so every bad call still warns
+	if (bSucc)
+	{
+		Recent[NextRecent] = FRecent{InPath, Path};
+		NextRecent = (NextRecent + 1) % NumRecent;
+	}
+	return Path;
+}
+
 void UGMPJsonUtils::ClearOneOf(FGMPValueOneOf& OneOf)
 {
 	OneOf.Clear();
@@ -1084,11 +2015,11 @@ void UGMPJsonUtils::ClearOneOf(FGMPValueOneOf& OneOf)
 
 bool UGMPJsonUtils::FromJsonStr(const FString& InStr, FGMPValueOneOf& OutValue)
 {
-	return GMP::Json::UStructFromJson(InStr, OutValue);
+	return OutValue.FromJsonStr(InStr);
 }
 bool UGMPJsonUtils::ToJsonStr(const FGMPValueOneOf& InValue, FString& OutStr)
 {
-	return GMP::Json::UStructToJson(OutStr, InValue);
+	return InValue.ToJsonStr(OutStr);
 }
 
 DEFINE_FUNCTION(UGMPJsonUtils::execAsStruct)
@@ -1111,6 +2042,21 @@ DEFINE_FUNCTION(UGMPJsonUtils::execAsStruct)
 	P_NATIVE_END
 }
 
+DEFINE_FUNCTION(UGMPJsonUtils::execAsValueByPath)
+{
+	P_GET_STRUCT_REF(FGMPValueOneOf, OneOf);
+	P_GET_STRUCT_REF(FGMPValuePath, Path);
+
+	Stack.StepCompiledIn<FProperty>(nullptr);
+	void* OutData = Stack.MostRecentPropertyAddress;
+	FProperty* OutProp = Stack.MostRecentProperty;
+	P_FINISH
+
+	P_NATIVE_BEGIN
+	*(bool*)RESULT_PARAM = AsValueImpl(OneOf, OutProp, OutData, Path);
+	P_NATIVE_END
+}
+
 DEFINE_FUNCTION(UGMPJsonUtils::execEncodeJsonStr)
 {
 	P_GET_STRUCT_REF(FGMPValueOneOf, OneOf);
@@ -1323,98 +2269,14 @@ bool UGMPJsonHttpUtils::GMPHttpRequestWildImpl(const UObject* InCtx,
 											   FProperty* RspProp,
 											   TDelegate<void(bool, int32, const uint8* RspData)> OnRsp)
 {
-	TSharedPtr<IHttpRequest, ESPMode::ThreadSafe> HttpRequest;
-#if GMP_WITH_HTTP_PACKAGE
-	HttpRequest = FHttpModule::Get().CreateRequest();
-#else
-	if (auto HttpModule = FModuleManager::LoadModulePtr<FHttpModule>("HTTP"))
-	{
-		HttpRequest = HttpModule->CreateRequest();
-	}
-	if (!ensureWorldMsgf(InCtx, !HttpRequest, TEXT("Unable to CreateRequest")))
-		return false;
-#endif
-
-	HttpRequest->SetURL(Url);
-
-	if (TimeoutSecs > 0.f)
-		HttpRequest->SetTimeout(TimeoutSecs);
-
-	// HttpRequest->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
-	// HttpRequest->SetHeader(TEXT("Accept"), TEXT("application/json"));
-
-	for (auto& Pair : Headers)
-	{
-		HttpRequest->AppendToHeader(Pair.Key, Pair.Value);
-	}
-
-	if (BodyData && ensureWorld(InCtx, BodyProp))
-	{
-		HttpRequest->SetVerb("POST");
-		JsonHttpUtils::FJsonEncodeScope Scope{ConvertFlags};
-		HttpRequest->SetContent(GMP::Json::PropToJsonBuf(BodyProp, BodyData));
-	}
-	else
-	{
-		HttpRequest->SetVerb("GET");
-	}
-
-	HttpRequest->OnProcessRequestComplete().BindLambda([OnRsp, RspProp](FHttpRequestPtr RequestPtr, FHttpResponsePtr ResponsePtr, bool bConnectedSuccessfully) {
-		bool bSucc = false;
-		uint8* RspData = nullptr;
-		int32 ResponseCode = ResponsePtr.IsValid() ? ResponsePtr->GetResponseCode() : EHttpResponseCodes::Unknown;
-		TStringBuilder<1024> ErrMsg;
-		do
-		{
-			if (!EHttpResponseCodes::IsOk(ResponseCode))
-			{
-				ErrMsg.Append(TEXT("ResponseCode failed : %d \n"), ResponseCode);
-				break;
-			}
-
-			if (!ensureAlways(RequestPtr.IsValid()))
-			{
-				ErrMsg.Append(TEXT("RequestPtr is invalid "));
-				break;
-			}
-
-#if !UE_BUILD_SHIPPING
-			UE_LOG(LogGMP, Verbose, TEXT("GMPHttpRequestWildImpl : %s-url : %s \n"), *RequestPtr->GetVerb(), *RequestPtr->GetURL());
-			if (RequestPtr->GetVerb().Equals(TEXT("POST")))
-			{
-				auto& Content = RequestPtr->GetContent();
-				UE_LOG(LogGMP, Verbose, TEXT("GMPHttpRequestWildImpl : Content : %s \n"), UTF8_TO_TCHAR((TCHAR*)FUTF8ToTCHAR((const ANSICHAR*)Content.GetData(), Content.Num()).Get()));
-			}
-#endif
-
-			if (!ensure(bConnectedSuccessfully))
-			{
-				ErrMsg.Append(TEXT("Connect failed \n"));
-				break;
-			}
+	if (BodyData && !ensureWorld(InCtx, BodyProp))
+		BodyData = nullptr;
 
-			if (!ResponsePtr.IsValid())
-			{
-				ErrMsg.Append(TEXT("ResponsePtr is invalid \n"));
-				break;
-			}
-			RspData = (uint8*)FMemory_Alloca_Aligned(RspProp->GetSize(), RspProp->GetMinAlignment());
-			FMemory::Memzero(RspData, RspProp->GetSize());
-			if (!GMP::Json::PropFromJson(ResponsePtr, RspProp, RspData))
-			{
-				ErrMsg.Append(TEXT("Deserialize failed"));
-				break;
-			}
-			bSucc = true;
-			OnRsp.ExecuteIfBound(bSucc, ResponseCode, RspData);
-		} while (false);
-		if (!bSucc)
-		{
-			UE_CLOG(!bSucc, LogGMP, Error, TEXT("GMPHttpRequestWildImpl Error : %s"), *ErrMsg);
-			OnRsp.ExecuteIfBound(bSucc, ResponseCode, RspData);
-		}
+	// pooled per host, the response is parsed off the game thread when it holds no object references
+	JsonHttpUtils::FJsonEncodeScope Scope{ConvertFlags};
+	return GMP::Json::Http::FJsonHttpClient::Default().Request(Url, Headers, TimeoutSecs, BodyProp, BodyData, RspProp, [OnRsp](bool bSucc, int32 ResponseCode, const uint8* RspData) {
+		OnRsp.ExecuteIfBound(bSucc, ResponseCode, RspData);
 	});
-	return ensure(HttpRequest->ProcessRequest());
 }
 
 DEFINE_FUNCTION(UGMPJsonHttpUtils::execHttpPostRequestWild)
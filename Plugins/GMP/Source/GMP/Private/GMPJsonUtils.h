@@ -33,16 +33,26 @@ public:
 	static bool AsStruct(const FGMPValueOneOf& InValue, UPARAM(ref) int32& InOut, FName SubKey, bool bConsume = false);
 	DECLARE_FUNCTION(execAsStruct);
 
-	UFUNCTION(BlueprintCallable, Category = "GMP|Json|OneOf", meta = (CallableWithoutWorldContext))
+	// Path is compiled when the blueprint compiles, see UK2Node_GMPValuePath
+	UFUNCTION(BlueprintCallable, CustomThunk, BlueprintInternalUseOnly, Category = "GMP|OneOf(Json)", meta = (CallableWithoutWorldContext, CustomStructureParam = "OutValue"))
+	static bool AsValueByPath(const FGMPValueOneOf& InValue, const FGMPValuePath& Path, int32& OutValue);
+	DECLARE_FUNCTION(execAsValueByPath);
+
+	// for paths only known at runtime, the last few paths compiled on a thread are reused
+	UFUNCTION(BlueprintPure, Category = "GMP|OneOf(Json)", meta = (CallableWithoutWorldContext))
+	static FGMPValuePath CompileValuePath(const FString& InPath);
+
+	UFUNCTION(BlueprintCallable, Category = "GMP|OneOf(Json)", meta = (CallableWithoutWorldContext))
 	static void ClearOneOf(UPARAM(ref) FGMPValueOneOf& InValue);
 
-	UFUNCTION(BlueprintCallable, Category = "GMP|Json|OneOf", meta = (CallableWithoutWorldContext))
+	UFUNCTION(BlueprintCallable, Category = "GMP|OneOf(Json)", meta = (CallableWithoutWorldContext))
 	static bool FromJsonStr(const FString& InStr, FGMPValueOneOf& OutValue);
-	UFUNCTION(BlueprintCallable, Category = "GMP|Json|OneOf", meta = (CallableWithoutWorldContext))
+	UFUNCTION(BlueprintCallable, Category = "GMP|OneOf(Json)", meta = (CallableWithoutWorldContext))
 	static bool ToJsonStr(const FGMPValueOneOf& InValue, FString& OutStr);
 
 protected:
 	static bool AsValueImpl(const FGMPValueOneOf& In, FProperty* Prop, void* Out, FName SubKey);
+	static bool AsValueImpl(const FGMPValueOneOf& In, FProperty* Prop, void* Out, const FGMPValuePath& Path);
 	static int32 IterateKeyValueImpl(const FGMPValueOneOf& In, int32 Idx, FString& OutKey, FGMPValueOneOf& OutValue);
 
 	friend struct FGMPValueOneOf;
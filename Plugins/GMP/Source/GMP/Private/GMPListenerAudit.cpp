@@ -0,0 +1,269 @@
+//  Copyright GenericMessagePlugin, Inc. All Rights Reserved.
+
+#include "GMPListenerAudit.h"
+
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformStackWalk.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/DelayedAutoRegister.h"
+#include "Misc/OutputDeviceRedirector.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+
+namespace GMP
+{
+namespace ListenerAudit
+{
+	static int32 bCapture = 0;
+	FAutoConsoleVariableRef CVar_Capture(TEXT("gmp.listeners.capture"), bCapture, TEXT("record message key, owner and allocation site of each new listener for gmp.listeners.audit"));
+	static int32 StackDepth = 12;
+	FAutoConsoleVariableRef CVar_StackDepth(TEXT("gmp.listeners.stackdepth"), StackDepth, TEXT("frames captured per listener allocation site, 0 records no callstack"));
+	static float MaxAge = 600.f;
+	FAutoConsoleVariableRef CVar_MaxAge(TEXT("gmp.listeners.maxage"), MaxAge, TEXT("seconds after which a captured listener is reported by the audit, 0 disables the age check"));
+	static float AuditInterval = 0.f;
+	FAutoConsoleVariableRef CVar_AuditInterval(TEXT("gmp.listeners.auditinterval"), AuditInterval, TEXT("seconds between automatic listener audits, 0 disables them"));
+
+	struct FSite
+	{
+		TArray<uint64, TInlineAllocator<16>> Frames;
+		FString Desc;
+		int32 Live = 0;
+	};
+
+	struct FRecord
+	{
+		FName MessageKey;
+		FWeakObjectPtr Handler;
+		FSigSource Source = FSigSource::NullSigSrc;
+		double Seconds = 0.0;
+		uint32 SiteHash = 0;
+		EOwnerKind Kind = EOwnerKind::None;
+	};
+
+	struct FState
+	{
+		FCriticalSection Lock;
+		TMap<FGMPKey, FRecord> Records;
+		TMap<uint32, FSite> Sites;
+		double LastAudit = 0.0;
+	};
+
+	static FState& GetState()
+	{
+		// never destroyed, audited slots may die during static teardown
+		static FState* State = new FState();
+		return *State;
+	}
+
+	static const FString& DescribeSite(FSite& Site)
+	{
+		if (!Site.Desc.IsEmpty())
+			return Site.Desc;
+
+		static const bool bStackWalkReady = FPlatformStackWalk::InitStackWalking();
+		(void)bStackWalkReady;
+		for (uint64 Frame : Site.Frames)
+		{
+			FProgramCounterSymbolInfo Info;
+			FPlatformStackWalk::ProgramCounterToSymbolInfo(Frame, Info);
+			FString Function = ANSI_TO_TCHAR(Info.FunctionName);
+			// the first frame outside of gmp is the code that bound the listener
+			if (Function.IsEmpty() || Function.Contains(TEXT("GMP::")) || Function.Contains(TEXT("StackWalk")) || Function.Contains(TEXT("StackBackTrace")))
+				continue;
+			Site.Desc = FString::Printf(TEXT("%s!%s [%s:%d]"), ANSI_TO_TCHAR(Info.ModuleName), *Function, *FPaths::GetCleanFilename(ANSI_TO_TCHAR(Info.Filename)), Info.LineNumber);
+			break;
+		}
+		if (Site.Desc.IsEmpty())
+			Site.Desc = Site.Frames.Num() ? FString::Printf(TEXT("0x%llx"), Site.Frames[0]) : FString(TEXT("<no callstack>"));
+		return Site.Desc;
+	}
+
+	static const TCHAR* GetOwnerProblem(const FRecord& Rec)
+	{
+		if (Rec.Kind != EOwnerKind::Object)
+			return nullptr;
+
+		UObject* Obj = Rec.Handler.Get(true);
+		if (!Obj)
+			return TEXT("owner destroyed");
+		if (!IsValid(Obj) || Obj->IsUnreachable())
+			return TEXT("owner pending kill");
+
+		UWorld* World = Obj->GetTypedOuter<UWorld>();
+		if (World && (World->bIsTearingDown || (World->IsGameWorld() && GEngine && !GEngine->GetWorldContextFromWorld(World))))
+			return TEXT("owner in unloaded world");
+		return nullptr;
+	}
+
+	bool IsCapturing()
+	{
+		return !!bCapture;
+	}
+
+	void OnListen(FName MessageKey, FSigElm& Elem, FSigSource InSigSrc, EOwnerKind Kind)
+	{
+		FRecord Rec;
+		Rec.MessageKey = MessageKey;
+		Rec.Handler = Elem.GetHandler();
+		Rec.Source = InSigSrc;
+		Rec.Seconds = FPlatformTime::Seconds();
+		Rec.Kind = Kind;
+
+		uint64 Frames[64];
+		uint32 Depth = 0;
+		if (StackDepth > 0)
+		{
+			Depth = FPlatformStackWalk::CaptureStackBackTrace(Frames, FMath::Min(StackDepth, 64));
+			Rec.SiteHash = Depth ? FCrc::MemCrc32(Frames, Depth * sizeof(uint64)) : 0;
+		}
+
+		auto& State = GetState();
+		FScopeLock Lock(&State.Lock);
+		if (Rec.SiteHash)
+		{
+			auto& Site = State.Sites.FindOrAdd(Rec.SiteHash);
+			if (Site.Frames.Num() == 0)
+				Site.Frames.Append(Frames, Depth);
+			++Site.Live;
+		}
+		State.Records.Add(Elem.GetGMPKey(), MoveTemp(Rec));
+		Elem.SetAudited();
+	}
+
+	void OnSigElmDestroyed(FGMPKey Key)
+	{
+		auto& State = GetState();
+		FScopeLock Lock(&State.Lock);
+		FRecord Rec;
+		if (!State.Records.RemoveAndCopyValue(Key, Rec) || !Rec.SiteHash)
+			return;
+
+		if (auto Site = State.Sites.Find(Rec.SiteHash))
+		{
+			if (--Site->Live <= 0)
+				State.Sites.Remove(Rec.SiteHash);
+		}
+	}
+
+	struct FFinding
+	{
+		FGMPKey Key;
+		const FRecord* Rec;
+		const TCHAR* Problem;
+	};
+
+	static TArray<FFinding> CollectFindings(FState& State, double Now, double AgeLimit)
+	{
+		TArray<FFinding> Findings;
+		for (auto& Pair : State.Records)
+		{
+			const TCHAR* Problem = GetOwnerProblem(Pair.Value);
+			if (!Problem && AgeLimit > 0.0 && Now - Pair.Value.Seconds >= AgeLimit)
+				Problem = Pair.Value.Kind == EOwnerKind::None ? TEXT("unowned, aged") : TEXT("aged");
+			if (Problem)
+				Findings.Add({Pair.Key, &Pair.Value, Problem});
+		}
+		return Findings;
+	}
+
+	int32 Audit(FOutputDevice& Ar, float MaxAgeSeconds, int32 MaxRows)
+	{
+		GMP_CHECK_SLOW(IsInGameThread());
+		const double Now = FPlatformTime::Seconds();
+
+		auto& State = GetState();
+		FScopeLock Lock(&State.Lock);
+		TArray<FFinding> Findings = CollectFindings(State, Now, MaxAgeSeconds >= 0.f ? MaxAgeSeconds : MaxAge);
+
+		Ar.Logf(TEXT("GMP listeners: %d captured, %d suspicious, %d allocation sites"), State.Records.Num(), Findings.Num(), State.Sites.Num());
+		Findings.Sort([](const FFinding& Lhs, const FFinding& Rhs) { return Lhs.Rec->Seconds < Rhs.Rec->Seconds; });
+
+		const int32 Rows = MaxRows > 0 ? FMath::Min(MaxRows, Findings.Num()) : Findings.Num();
+		for (int32 Idx = 0; Idx < Rows; ++Idx)
+		{
+			const FRecord& Rec = *Findings[Idx].Rec;
+			auto Site = Rec.SiteHash ? State.Sites.Find(Rec.SiteHash) : nullptr;
+			UObject* Owner = Rec.Handler.Get(true);
+			Ar.Logf(TEXT("%8.0fs %-24s key[%s] id[%s] owner[%s] site[%08x] %s"),
+					Now - Rec.Seconds,
+					Findings[Idx].Problem,
+					*Rec.MessageKey.ToString(),
+					*Findings[Idx].Key.ToString(),
+					Owner ? *Owner->GetPathName() : (Rec.Kind == EOwnerKind::Collection ? TEXT("<collection>") : TEXT("<none>")),
+					Rec.SiteHash,
+					Site ? *DescribeSite(*Site) : TEXT("<no callstack>"));
+		}
+		return Findings.Num();
+	}
+
+	void DumpSites(FOutputDevice& Ar, int32 MaxRows)
+	{
+		GMP_CHECK_SLOW(IsInGameThread());
+		auto& State = GetState();
+		FScopeLock Lock(&State.Lock);
+
+		struct FSiteRow
+		{
+			int32 Count = 0;
+			TSet<FName> Keys;
+		};
+		TMap<uint32, FSiteRow> Rows;
+		for (auto& Pair : State.Records)
+		{
+			auto& Row = Rows.FindOrAdd(Pair.Value.SiteHash);
+			++Row.Count;
+			Row.Keys.Add(Pair.Value.MessageKey);
+		}
+		Rows.ValueSort([](const FSiteRow& Lhs, const FSiteRow& Rhs) { return Lhs.Count > Rhs.Count; });
+
+		Ar.Logf(TEXT("GMP listeners: %d captured, %d allocation sites"), State.Records.Num(), State.Sites.Num());
+		int32 Printed = 0;
+		for (auto& Pair : Rows)
+		{
+			if (MaxRows > 0 && Printed++ >= MaxRows)
+				break;
+			auto Site = Pair.Key ? State.Sites.Find(Pair.Key) : nullptr;
+			FString Keys;
+			for (auto& Key : Pair.Value.Keys)
+				Keys += (Keys.IsEmpty() ? TEXT("") : TEXT(",")) + Key.ToString();
+			Ar.Logf(TEXT("%6d site[%08x] %s keys[%s]"), Pair.Value.Count, Pair.Key, Site ? *DescribeSite(*Site) : TEXT("<no callstack>"), *Keys);
+		}
+	}
+
+	static void OnEndFrame()
+	{
+		if (AuditInterval <= 0.f || !bCapture)
+			return;
+
+		auto& State = GetState();
+		const double Now = FPlatformTime::Seconds();
+		if (Now - State.LastAudit < AuditInterval)
+			return;
+		State.LastAudit = Now;
+
+		// only speaks up when something is found
+		FScopeLock Lock(&State.Lock);
+		if (CollectFindings(State, Now, MaxAge).Num() > 0)
+			Audit(*GLog);
+	}
+	static FDelayedAutoRegisterHelper DelayOnEngineInit(EDelayedRegisterRunPhase::EndOfEngineInit, [] { FCoreDelegates::OnEndFrame.AddStatic(&OnEndFrame); });
+
+	FAutoConsoleCommandWithWorldArgsAndOutputDevice XVar_ListenerAudit(TEXT("gmp.listeners.audit"),
+																	   TEXT("gmp.listeners.audit [MaxAgeSeconds] [MaxRows]"),
+																	   FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* InWorld, FOutputDevice& Ar) {
+																		   const float MaxAgeSeconds = Args.Num() > 0 ? FCString::Atof(*Args[0]) : -1.f;
+																		   const int32 MaxRows = Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 50;
+																		   if (!bCapture)
+																			   Ar.Logf(TEXT("gmp.listeners.capture is off, only listeners bound while it was on are audited"));
+																		   Audit(Ar, MaxAgeSeconds, MaxRows);
+																	   }));
+
+	FAutoConsoleCommandWithWorldArgsAndOutputDevice XVar_ListenerDump(TEXT("gmp.listeners.dump"),
+																	  TEXT("gmp.listeners.dump [MaxRows]"),
+																	  FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* InWorld, FOutputDevice& Ar) {
+																		  DumpSites(Ar, Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 50);
+																	  }));
+}  // namespace ListenerAudit
+}  // namespace GMP
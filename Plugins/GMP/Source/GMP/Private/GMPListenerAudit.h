@@ -0,0 +1,30 @@
+//  Copyright GenericMessagePlugin, Inc. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+
+#include "GMPSignalsImpl.h"
+
+namespace GMP
+{
+namespace ListenerAudit
+{
+	enum class EOwnerKind : uint8
+	{
+		// bound without owner, only an explicit unbind removes it
+		None,
+		Object,
+		Collection,
+	};
+
+	// gmp.listeners.capture, off by default as every listen pays for a callstack
+	bool IsCapturing();
+	void OnListen(FName MessageKey, FSigElm& Elem, FSigSource InSigSrc, EOwnerKind Kind);
+
+	// lists listeners owned by dead objects or unloaded worlds and the ones older than MaxAgeSeconds
+	// a negative MaxAgeSeconds uses gmp.listeners.maxage, returns the number of suspicious listeners
+	int32 Audit(FOutputDevice& Ar, float MaxAgeSeconds = -1.f, int32 MaxRows = 50);
+	// every captured listener grouped by allocation site
+	void DumpSites(FOutputDevice& Ar, int32 MaxRows = 50);
+}  // namespace ListenerAudit
+}  // namespace GMP
@@ -0,0 +1,106 @@
+//  Copyright GenericMessagePlugin, Inc. All Rights Reserved.
+
+#include "GMPMemoryReport.h"
+
+#include "GMPMeta.h"
+#include "GMPSignalsImpl.h"
+#include "GMPUtils.h"
+#include "HAL/IConsoleManager.h"
+
+#if UE_5_00_OR_LATER
+LLM_DEFINE_TAG(GMP);
+#endif
+
+namespace GMP
+{
+void FGMPMemoryReport::AddListener(FName MessageKey, const FWeakObjectPtr& Listener, FSigSource InSigSrc, SIZE_T InBytes)
+{
+	MessageKeys.FindOrAdd(MessageKey).Add(InBytes);
+
+	if (!Listener.IsExplicitlyNull())
+	{
+		Listeners.FindOrAdd(Listener).Add(InBytes);
+		if (Listener.IsStale())
+			StaleListeners.Add(InBytes);
+	}
+
+	if (InSigSrc.IsValid() && !(InSigSrc == FSigSource::AnySigSrc))
+		Sources.FindOrAdd(InSigSrc).Add(InBytes);
+}
+
+SIZE_T FGMPMemoryReport::GetTotalBytes() const
+{
+	SIZE_T Total = SharedBytes;
+	for (auto& Pair : MessageKeys)
+		Total += Pair.Value.Bytes;
+	return Total;
+}
+
+FGMPMemoryReport FGMPMemoryReport::Collect(const FMessageHub* Hub)
+{
+	GMP_CHECK_SLOW(IsInGameThread());
+	FGMPMemoryReport Report;
+	if (Hub)
+	{
+		Hub->CollectMemory(Report);
+	}
+	else
+	{
+		bool bWithResponses = true;
+		FMessageUtils::ForEachHub([&](FMessageHub& Each) {
+			Each.CollectMemory(Report, bWithResponses);
+			bWithResponses = false;
+		});
+	}
+	FSignalStore::CollectSharedMemory(Report);
+	UGMPMeta::CollectMemory(Report);
+	return Report;
+}
+
+namespace MemoryReport
+{
+	template<typename K, typename F>
+	void DumpTable(FOutputDevice& Ar, const TCHAR* Title, const TMap<K, FGMPMemoryStat>& Stats, int32 MaxRows, const F& GetName)
+	{
+		TArray<const TPair<K, FGMPMemoryStat>*> Sorted;
+		Sorted.Reserve(Stats.Num());
+		for (auto& Pair : Stats)
+			Sorted.Add(&Pair);
+		Sorted.Sort([](const auto& Lhs, const auto& Rhs) { return Lhs.Value.Bytes > Rhs.Value.Bytes; });
+
+		Ar.Logf(TEXT("-- %s (%d)"), Title, Sorted.Num());
+		const int32 Rows = MaxRows > 0 ? FMath::Min(MaxRows, Sorted.Num()) : Sorted.Num();
+		for (int32 Idx = 0; Idx < Rows; ++Idx)
+			Ar.Logf(TEXT("%12llu bytes %6d slots  %s"), (uint64)Sorted[Idx]->Value.Bytes, Sorted[Idx]->Value.Count, *GetName(Sorted[Idx]->Key));
+	}
+}  // namespace MemoryReport
+
+void FGMPMemoryReport::Dump(FOutputDevice& Ar, int32 MaxRows) const
+{
+	Ar.Logf(TEXT("GMP memory: total %llu bytes, shared %llu bytes"), (uint64)GetTotalBytes(), (uint64)SharedBytes);
+	Ar.Logf(TEXT("GMP memory: responses %llu bytes (%d), meta %llu bytes (%d)"), (uint64)Responses.Bytes, Responses.Count, (uint64)Meta.Bytes, Meta.Count);
+	Ar.Logf(TEXT("GMP memory: slot slab %llu/%llu bytes (%d slots in %d chunks), large slots %llu bytes (%d)"),
+			(uint64)SlabSlots.Bytes,
+			(uint64)Slab.Bytes,
+			SlabSlots.Count,
+			Slab.Count,
+			(uint64)LargeSlots.Bytes,
+			LargeSlots.Count);
+	if (StaleListeners.Count > 0)
+		Ar.Logf(TEXT("GMP memory: %d stale listener slots hold %llu bytes"), StaleListeners.Count, (uint64)StaleListeners.Bytes);
+
+	MemoryReport::DumpTable(Ar, TEXT("MessageKeys"), MessageKeys, MaxRows, [](const FName& Key) { return Key.ToString(); });
+	MemoryReport::DumpTable(Ar, TEXT("Listeners"), Listeners, MaxRows, [](const FWeakObjectPtr& Key) {
+		auto Obj = Key.Get();
+		return Obj ? Obj->GetPathName() : FString(TEXT("<stale>"));
+	});
+	MemoryReport::DumpTable(Ar, TEXT("Sources"), Sources, MaxRows, [](const FSigSource& Key) { return Key.GetNameSafe(); });
+}
+
+FAutoConsoleCommandWithWorldArgsAndOutputDevice XVar_GMPMemReport(TEXT("gmp.memreport"),
+																   TEXT("gmp.memreport [MaxRows]"),
+																   FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* InWorld, FOutputDevice& Ar) {
+																	   const int32 MaxRows = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 20;
+																	   FGMPMemoryReport::Collect().Dump(Ar, MaxRows);
+																   }));
+}  // namespace GMP
@@ -2,6 +2,7 @@
 
 #include "GMPMeta.h"
 
+#include "GMPMemoryReport.h"
 #include "GMPStruct.h"
 #include "GMPWorldLocals.h"
 #include "Misc/ConfigCacheIni.h"
@@ -113,6 +114,20 @@ const TArray<FName>* UGMPMeta::GetSvrMeta(const UObject* InObj, FName MsgTag)
 	return (Find && Find->ResponseTypes.Num() > 0) ? &Find->ResponseTypes : nullptr;
 }
 
+void UGMPMeta::CollectMemory(GMP::FGMPMemoryReport& Report)
+{
+	auto Meta = FGMPMetaUtils::GetGMPMeta();
+	const SIZE_T ContainerBytes = Meta->GMPTypes.GetAllocatedSize() + Meta->MessageTagsList.GetAllocatedSize();
+	Report.SharedBytes += ContainerBytes;
+	Report.Meta.Add(ContainerBytes, 0);
+	for (auto& Pair : Meta->GMPTypes)
+	{
+		const SIZE_T Bytes = Pair.Value.ParameterTypes.GetAllocatedSize() + Pair.Value.ResponseTypes.GetAllocatedSize();
+		Report.Meta.Add(Bytes);
+		Report.MessageKeys.FindOrAdd(Pair.Key).Add(Bytes, 0);
+	}
+}
+
 void UGMPMeta::PostInitProperties()
 {
 	Super::PostInitProperties();
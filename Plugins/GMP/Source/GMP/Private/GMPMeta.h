@@ -5,6 +5,11 @@
 
 #include "GMPMeta.generated.h"
 
+namespace GMP
+{
+struct FGMPMemoryReport;
+}
+
 USTRUCT()
 struct FGMPTagMetaType
 {
@@ -85,6 +90,7 @@ public:
 	GMP_API static const TArray<FName>* GetTagMeta(const UObject* InWorldContextObj, FName MsgTag);
 	GMP_API static const TArray<FName>* GetSvrMeta(const UObject* InWorldContextObj, FName MsgTag);
 	void CollectTags();
+	static void CollectMemory(GMP::FGMPMemoryReport& Report);
 
 protected:
 	virtual void PostInitProperties() override;
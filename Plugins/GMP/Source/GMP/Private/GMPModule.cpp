@@ -306,7 +306,7 @@ FName FNameSuccession::GetNativeClassPtrName(UClass* InClass)
 			InClass = InClass->GetSuperClass();
 		} while (InClass);
 	}
-	return *FString::Printf(NAME_GMP_TObjectPtr TEXT("<%s>"), *TypeName.ToString());
+	return GMP::TypeId::ComposeName(GMP::TypeId::EKind::ObjectPtr, TypeName);
 }
 
 namespace Reflection
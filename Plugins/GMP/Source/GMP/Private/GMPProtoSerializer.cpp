@@ -2,6 +2,7 @@
 
 #include "GMPProtoSerializer.h"
 
+#include "Async/ParallelFor.h"
 #include "GMPProtoUtils.h"
 #if defined(GMP_WITH_UPB)
 #include "HAL/PlatformFile.h"
@@ -1570,6 +1571,66 @@ namespace Proto
 			template<>
 			struct TValueVisitor<FArrayProperty> : public TValueVisitorDefault<FArrayProperty>
 			{
+				// each chunk fills a scratch message on its own arena, fused into the writer's one, and is copied into place
+				static bool WriteElementsParallel(FProtoWriter& Writer, FArrayProperty* Prop, FScriptArrayHelper& Helper)
+				{
+					const int32 Num = Helper.Num();
+					if (!GMP::Serializer::Parallel::ShouldSplit(Num, Prop->Inner))
+						return false;
+
+					const int32 ChunkSize = GMP::Serializer::Parallel::GetChunkSize();
+					const int32 NumChunks = FMath::DivideAndRoundUp(Num, ChunkSize);
+					TArray<FArena> Arenas;
+					Arenas.Reserve(NumChunks);
+					for (int32 ChunkIdx = 0; ChunkIdx < NumChunks; ++ChunkIdx)
+					{
+						// arenas with an initial block can not be fused
+						if (!upb_Arena_Fuse(Writer.GetArena(), *Arenas.Emplace_GetRef()))
+							return false;
+					}
+
+					upb_Array* Arr = Writer.EnsureArraySize(Num);
+					if (!Arr)
+						return false;
+
+					const size_t ElmSize = upb_Array_ElmSize(Arr);
+					TArray<int32> ChunkWritten;
+					ChunkWritten.SetNumZeroed(NumChunks);
+					ParallelFor(NumChunks, [&](int32 ChunkIdx) {
+						GMP::Serializer::Parallel::FChunkScope ChunkScope;
+						upb_Arena* TaskArena = *Arenas[ChunkIdx];
+						const int32 Begin = ChunkIdx * ChunkSize;
+						const int32 End = FMath::Min(Num, Begin + ChunkSize);
+
+						FProtoWriter ChunkWriter(Writer.FieldDef, upb_Message_New(Writer.MiniTable(), TaskArena), TaskArena);
+						for (int32 i = Begin; i < End; ++i)
+						{
+							auto ElmWriter = ChunkWriter.ArrayElm(i - Begin);
+							WriteToPB(ElmWriter, Prop->Inner, Helper.GetRawPtr(i));
+						}
+
+						const upb_Array* ChunkArr = ChunkWriter.GetSubArray();
+						const size_t Written = ChunkArr ? FMath::Min(upb_Array_Size(ChunkArr), size_t(End - Begin)) : 0;
+						if (Written > 0)
+							FMemory::Memcpy(upb_Array_DataPtr(Arr, Begin), upb_Array_DataPtr(ChunkArr, 0), Written * ElmSize);
+						ChunkWritten[ChunkIdx] = int32(Written);
+					});
+
+					// elements a chunk skipped leave no hole, message arrays must not hold null entries
+					size_t Dst = 0;
+					for (int32 ChunkIdx = 0; ChunkIdx < NumChunks; ++ChunkIdx)
+					{
+						const size_t Begin = size_t(ChunkIdx) * ChunkSize;
+						const size_t Written = ChunkWritten[ChunkIdx];
+						if (Written > 0 && Dst != Begin)
+							FMemory::Memmove(upb_Array_DataPtr(Arr, Dst), upb_Array_DataPtr(Arr, Begin), Written * ElmSize);
+						Dst += Written;
+					}
+					if (Dst < size_t(Num))
+						_upb_Array_ResizeUninitialized(Arr, Dst, Writer.GetArena());
+					return true;
+				}
+
 				template<typename WriterType>
 				static void WriteVisit(WriterType& Writer, FArrayProperty* Prop, const void* ArrAddr, int32 ArrIdx)
 				{
@@ -1585,7 +1646,7 @@ namespace Proto
 					{
 						GMP_CHECK(Writer.FieldDef.GetArrayIdx() < 0);
 						FScriptArrayHelper Helper(Prop, ArrAddr);
-						if (Helper.Num() > 0)
+						if (Helper.Num() > 0 && !WriteElementsParallel(Writer, Prop, Helper))
 						{
 							for (int32 i = 0; i < Helper.Num(); ++i)
 							{
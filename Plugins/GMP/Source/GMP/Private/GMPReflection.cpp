@@ -9,11 +9,17 @@
 #include "GMPClass2Prop.h"
 #include "GMPRpcProxy.h"
 #include "GMPStruct.h"
+#include "GMPThreadUtils.h"
+#include "HAL/IConsoleManager.h"
 #include "Internationalization/Regex.h"
+#include "Misc/DelayedAutoRegister.h"
 #include "Misc/PackageName.h"
 #include "Misc/ScopeExit.h"
+#include "Misc/ScopeRWLock.h"
+#include "Modules/ModuleManager.h"
 #include "UObject/Interface.h"
 #include "UObject/ObjectKey.h"
+#include "UObject/PackageReload.h"
 #include "UObject/TextProperty.h"
 #include "UObject/UObjectGlobals.h"
 #include "UObject/UnrealType.h"
@@ -23,6 +29,9 @@
 #else
 #include "Engine/UserDefinedStruct.h"
 #endif
+#if WITH_EDITOR
+#include "Editor.h"
+#endif
 
 namespace GMP
 {
@@ -310,35 +319,28 @@ namespace Class2Prop
 		return Ret;
 	}
 
-	FProperty*& FindOrAddProperty(FName PropTypeName)
+	// properties of structs and enums recompiled in the editor are built again
+	static bool IsStaleProperty(const FProperty* Prop)
 	{
-		FProperty*& Prop = Reflection::GetPropertyStorage().FindOrAdd(PropTypeName);
 #if WITH_EDITOR
 		if (GIsEditor && Prop)
 		{
 			if (auto StructProp = CastField<FStructProperty>(Prop))
-			{
-				if (!StructProp->Struct || StructProp->Struct->HasAnyFlags(RF_NewerVersionExists))
-				{
-					Prop = nullptr;
-				}
-			}
-			else if (auto EnumProp = CastField<FEnumProperty>(Prop))
-			{
-				if (!EnumProp->GetEnum() || EnumProp->GetEnum()->HasAnyCastFlags(RF_NewerVersionExists))
-				{
-					Prop = nullptr;
-				}
-			}
-			else if (auto ByteProp = CastField<FByteProperty>(Prop))
-			{
-				if (ByteProp->GetIntPropertyEnum() && ByteProp->GetIntPropertyEnum()->HasAnyCastFlags(RF_NewerVersionExists))
-				{
-					Prop = nullptr;
-				}
-			}
+				return !StructProp->Struct || StructProp->Struct->HasAnyFlags(RF_NewerVersionExists);
+			if (auto EnumProp = CastField<FEnumProperty>(Prop))
+				return !EnumProp->GetEnum() || EnumProp->GetEnum()->HasAnyCastFlags(RF_NewerVersionExists);
+			if (auto ByteProp = CastField<FByteProperty>(Prop))
+				return ByteProp->GetIntPropertyEnum() && ByteProp->GetIntPropertyEnum()->HasAnyCastFlags(RF_NewerVersionExists);
 		}
 #endif
+		return false;
+	}
+
+	FProperty*& FindOrAddProperty(FName PropTypeName)
+	{
+		FProperty*& Prop = Reflection::GetPropertyStorage().FindOrAdd(PropTypeName);
+		if (IsStaleProperty(Prop))
+			Prop = nullptr;
 		return Prop;
 	}
 	FProperty* FindOrAddProperty(FName PropTypeName, FProperty* InTypeProp)
@@ -410,7 +412,7 @@ namespace Reflection
 				*PropertyType = EGMPPropertyClass::Array;
 			auto Type = PinType;
 			Type.ContainerType = EPinContainerType::None;
-			return TTraitsTemplateBase::GetTArrayName(*GetPinPropertyName(bExactType, Type, ElemPropType).ToString());
+			return TTraitsTemplateBase::GetTArrayName(GetPinPropertyName(bExactType, Type, ElemPropType));
 		}
 		else if (PinType.IsSet())
 		{
@@ -418,7 +420,7 @@ namespace Reflection
 				*PropertyType = EGMPPropertyClass::Set;
 			auto Type = PinType;
 			Type.ContainerType = EPinContainerType::None;
-			return TTraitsTemplateBase::GetTSetName(*GetPinPropertyName(bExactType, Type, ElemPropType).ToString());
+			return TTraitsTemplateBase::GetTSetName(GetPinPropertyName(bExactType, Type, ElemPropType));
 		}
 		else if (PinType.IsMap())
 		{
@@ -432,7 +434,7 @@ namespace Reflection
 			ValuePinType.bIsWeakPointer = PinType.PinValueType.bTerminalIsWeakPointer;
 			auto Type = PinType;
 			Type.ContainerType = EPinContainerType::None;
-			return TTraitsTemplateBase::GetTMapName(*GetPinPropertyName(bExactType, Type, KeyPropType).ToString(), *GetPinPropertyName(bExactType, ValuePinType, ElemPropType).ToString());
+			return TTraitsTemplateBase::GetTMapName(GetPinPropertyName(bExactType, Type, KeyPropType), GetPinPropertyName(bExactType, ValuePinType, ElemPropType));
 		}
 		else if (PinType.PinCategory == PC_MCDelegate)
 		{
@@ -987,11 +989,11 @@ namespace Reflection
 			GMP_DEF_PAIR_CELL_CUSTOM(FWeakObjectProperty, TTraitsTemplate<FWeakObjectPtr, false>::GetFName(bExactType ? ToRawPtr(CastField<FWeakObjectProperty>(Property)->PropertyClass) : static_cast<UClass*>(nullptr)));
 			GMP_DEF_PAIR_CELL_CUSTOM(FLazyObjectProperty, TTraitsTemplate<FLazyObjectPtr, false>::GetFName(bExactType ? ToRawPtr(CastField<FLazyObjectProperty>(Property)->PropertyClass) : static_cast<UClass*>(nullptr)));
 
-			GMP_DEF_PAIR_CELL_CUSTOM(FArrayProperty, TTraitsTemplateBase::GetTArrayName(*GetPropertyName(CastField<FArrayProperty>(Property)->Inner, bExactType).ToString()));
+			GMP_DEF_PAIR_CELL_CUSTOM(FArrayProperty, TTraitsTemplateBase::GetTArrayName(GetPropertyName(CastField<FArrayProperty>(Property)->Inner, bExactType)));
 			GMP_DEF_PAIR_CELL_CUSTOM(
 				FMapProperty,
-				TTraitsTemplateBase::GetTMapName(*GetPropertyName(CastField<FMapProperty>(Property)->KeyProp, bExactType).ToString(), *GetPropertyName(CastField<FMapProperty>(Property)->ValueProp, bExactType).ToString()));
-			GMP_DEF_PAIR_CELL_CUSTOM(FSetProperty, TTraitsTemplateBase::GetTSetName(*GetPropertyName(CastField<FSetProperty>(Property)->ElementProp, bExactType).ToString()));
+				TTraitsTemplateBase::GetTMapName(GetPropertyName(CastField<FMapProperty>(Property)->KeyProp, bExactType), GetPropertyName(CastField<FMapProperty>(Property)->ValueProp, bExactType)));
+			GMP_DEF_PAIR_CELL_CUSTOM(FSetProperty, TTraitsTemplateBase::GetTSetName(GetPropertyName(CastField<FSetProperty>(Property)->ElementProp, bExactType)));
 
 			GMP_DEF_PAIR_CELL_CUSTOM(FStructProperty, GetScriptStructTypeName(CastField<FStructProperty>(Property)->Struct, Property));
 			// GMP_DEF_PAIR_CELL_CUSTOM(FEnumProperty, FName(*CastField<FEnumProperty>(Property)->GetEnum()->CppType));
@@ -1096,12 +1098,11 @@ namespace Reflection
 				else
 					return Class2Name::TTraitsScriptIncBase::GetFName(IncProp->InterfaceClass);
 			});
-			GMP_DEF_PAIR_CELL_CUSTOM(Array, { return TTraitsTemplateBase::GetTArrayName(*GetPropertyName(CastFieldChecked<FArrayProperty>(Property)->Inner, InValueEnum).ToString()); });
+			GMP_DEF_PAIR_CELL_CUSTOM(Array, { return TTraitsTemplateBase::GetTArrayName(GetPropertyName(CastFieldChecked<FArrayProperty>(Property)->Inner, InValueEnum)); });
 			GMP_DEF_PAIR_CELL_CUSTOM(Map, {
-				return TTraitsTemplateBase::GetTMapName(*GetPropertyName(CastFieldChecked<FMapProperty>(Property)->KeyProp, InKeyEnum).ToString(),
-														*GetPropertyName(CastFieldChecked<FMapProperty>(Property)->ValueProp, InValueEnum).ToString());
+				return TTraitsTemplateBase::GetTMapName(GetPropertyName(CastFieldChecked<FMapProperty>(Property)->KeyProp, InKeyEnum), GetPropertyName(CastFieldChecked<FMapProperty>(Property)->ValueProp, InValueEnum));
 			});
-			GMP_DEF_PAIR_CELL_CUSTOM(Set, { return TTraitsTemplateBase::GetTSetName(*GetPropertyName(CastFieldChecked<FSetProperty>(Property)->ElementProp, InValueEnum).ToString()); });
+			GMP_DEF_PAIR_CELL_CUSTOM(Set, { return TTraitsTemplateBase::GetTSetName(GetPropertyName(CastFieldChecked<FSetProperty>(Property)->ElementProp, InValueEnum)); });
 			GMP_DEF_PAIR_CELL(Delegate);
 			//GMP_DEF_PAIR_CELL(InlineMulticastDelegate);
 
@@ -1273,7 +1274,9 @@ bool PropertyFromStringImpl(FString TypeString, FProperty*& OutProp, bool bInTem
 	}
 	else
 	{
-		if (auto Find = Reflection::GetPropertyStorage().Find(*TypeString))
+		// base types and properties built by name, resolved type strings are cached by PropCache only
+		auto Find = Reflection::GetPropertyStorage().Find(*TypeString);
+		if (Find && *Find && !Class2Prop::IsStaleProperty(*Find))
 		{
 			OutProp = *Find;
 			return true;
@@ -1427,19 +1430,283 @@ bool PropertyFromStringImpl(FString TypeString, FProperty*& OutProp, bool bInTem
 	if (!bRet)
 		OutProp = nullptr;
 
-	GMP_IF_CONSTEXPR(!bNew)
-	{
-		if (OutProp)
-			Reflection::GetPropertyStorage().Add(*TypeString, OutProp);
-	}
-
 	return ensure(bRet);
 }
 	// clang-format on
 
+	namespace PropCache
+	{
+		static int32 MaxEntries = 4096;
+		FAutoConsoleVariableRef CVar_PropCacheSize(TEXT("gmp.reflection.propcache.size"), MaxEntries, TEXT("max cached PropertyFromString results, 0 to disable"));
+		static float NegativeSeconds = 5.f;
+		FAutoConsoleVariableRef CVar_PropCacheNegative(TEXT("gmp.reflection.propcache.negseconds"), NegativeSeconds, TEXT("seconds an unresolved type string stays cached"));
+
+		struct FEntry
+		{
+			// null for unresolved type strings
+			FProperty* Prop = nullptr;
+			double ExpireTime = 0.0;
+			// position in FCache::Keys
+			int32 Slot = INDEX_NONE;
+		};
+
+		// plain strings, unresolved ones must not end up in the name table
+		// spaces are skipped while hashing and comparing, so a lookup needs no normalized copy
+		struct FKey
+		{
+			FString TypeString;
+			uint8 Flags = 0;
+			uint32 Hash = 0;
+		};
+		struct FLookup
+		{
+			const FString& TypeString;
+			uint8 Flags;
+			uint32 Hash;
+		};
+
+		static uint32 HashTypeString(const FString& TypeString, uint8 Flags)
+		{
+			uint32 Hash = 2166136261u ^ Flags;
+			for (TCHAR Ch : TypeString)
+			{
+				if (Ch != TEXT(' '))
+					Hash = (Hash ^ uint32(FChar::ToLower(Ch))) * 16777619u;
+			}
+			return Hash;
+		}
+		static bool EqualsSkippingSpaces(const FString& Normalized, const FString& TypeString)
+		{
+			const TCHAR* Lhs = *Normalized;
+			for (const TCHAR* Rhs = *TypeString; *Rhs; ++Rhs)
+			{
+				if (*Rhs == TEXT(' '))
+					continue;
+				if (FChar::ToLower(*Lhs) != FChar::ToLower(*Rhs))
+					return false;
+				++Lhs;
+			}
+			return !*Lhs;
+		}
+
+		struct FKeyFuncs : BaseKeyFuncs<TPair<FKey, FEntry>, FKey, false>
+		{
+			static const FKey& GetSetKey(const TPair<FKey, FEntry>& Element) { return Element.Key; }
+			static uint32 GetKeyHash(const FKey& Key) { return Key.Hash; }
+			static bool Matches(const FKey& A, const FKey& B) { return A.Hash == B.Hash && A.Flags == B.Flags && A.TypeString == B.TypeString; }
+			static bool Matches(const FKey& A, const FLookup& B) { return A.Hash == B.Hash && A.Flags == B.Flags && EqualsSkippingSpaces(A.TypeString, B.TypeString); }
+		};
+
+		struct FCache
+		{
+			FRWLock Lock;
+			TMap<FKey, FEntry, FDefaultSetAllocator, FKeyFuncs> Entries;
+			// every cached key once, for eviction
+			TArray<FKey> Keys;
+		};
+		static FCache& GetCache()
+		{
+			static FCache Cache;
+			return Cache;
+		}
+
+		static FLookup MakeLookup(const FString& TypeString, bool bInTemplate, bool bInContainer)
+		{
+			const uint8 Flags = uint8(bInTemplate) | (uint8(bInContainer) << 1);
+			return FLookup{TypeString, Flags, HashTypeString(TypeString, Flags)};
+		}
+
+		static bool Find(const FLookup& Lookup, FProperty*& OutProp, bool& bOutResolved)
+		{
+			auto& Cache = GetCache();
+			FReadScopeLock ReadLock(Cache.Lock);
+			auto Find = Cache.Entries.FindByHash(Lookup.Hash, Lookup);
+			if (!Find || (!Find->Prop && FPlatformTime::Seconds() > Find->ExpireTime))
+				return false;
+			OutProp = Find->Prop;
+			bOutResolved = !!Find->Prop;
+			return true;
+		}
+
+		static void Add(const FLookup& Lookup, FProperty* Prop)
+		{
+			if (MaxEntries <= 0)
+				return;
+			const double ExpireTime = Prop ? 0.0 : FPlatformTime::Seconds() + NegativeSeconds;
+			auto& Cache = GetCache();
+			FWriteScopeLock WriteLock(Cache.Lock);
+			if (auto Find = Cache.Entries.FindByHash(Lookup.Hash, Lookup))
+			{
+				// an expired unresolved entry
+				Find->Prop = Prop;
+				Find->ExpireTime = ExpireTime;
+				return;
+			}
+
+			// evict random entries one at a time, a hot working set just over the limit keeps most of its hits
+			while (Cache.Keys.Num() >= MaxEntries)
+			{
+				const int32 Victim = FMath::RandHelper(Cache.Keys.Num());
+				Cache.Entries.Remove(Cache.Keys[Victim]);
+				Cache.Keys.RemoveAtSwap(Victim, 1, EAllowShrinking::No);
+				if (Cache.Keys.IsValidIndex(Victim))
+					Cache.Entries.FindChecked(Cache.Keys[Victim]).Slot = Victim;
+			}
+
+			FKey Key{Lookup.TypeString.Replace(TEXT(" "), TEXT(""), ESearchCase::CaseSensitive), Lookup.Flags, Lookup.Hash};
+			const int32 Slot = Cache.Keys.Add(Key);
+			Cache.Entries.Add(MoveTemp(Key), FEntry{Prop, ExpireTime, Slot});
+		}
+
+		static void Invalidate()
+		{
+			auto& Cache = GetCache();
+			FWriteScopeLock WriteLock(Cache.Lock);
+			Cache.Entries.Reset();
+			Cache.Keys.Reset();
+		}
+
+	}  // namespace PropCache
+
+	namespace StructBinding
+	{
+		// a span of struct fields copied together
+		struct FRun
+		{
+			int32 First = 0;
+			int32 Num = 1;
+			// trivially copyable fields, memcpy when the source addresses keep the struct layout
+			bool bPlain = false;
+		};
+
+		struct FBinding
+		{
+			TWeakObjectPtr<const UScriptStruct> Struct;
+			TArray<const FProperty*> Props;
+			TArray<int32> Offsets;
+			TArray<int32> Sizes;
+#if GMP_WITH_TYPENAME
+			TArray<FName> TypeNames;
+#endif
+			TArray<FRun> Runs;
+
+			explicit FBinding(const UScriptStruct* ScriptStruct)
+				: Struct(ScriptStruct)
+			{
+				for (TFieldIterator<FProperty> It(ScriptStruct); It; ++It)
+				{
+					const FProperty* Prop = *It;
+					const int32 Offset = Prop->GetOffset_ForInternal();
+					const int32 Size = Prop->GetSize();
+					auto BoolProp = CastField<FBoolProperty>(Prop);
+					const bool bPlain = Prop->HasAnyPropertyFlags(CPF_IsPlainOldData) && (!BoolProp || BoolProp->IsNativeBool());
+
+					// extend the current run while the fields stay in ascending memory order
+					const int32 Idx = Props.Add(Prop);
+					if (bPlain && Runs.Num() > 0 && Runs.Last().bPlain && Offset >= Offsets.Last() + Sizes.Last())
+						++Runs.Last().Num;
+					else
+						Runs.Add(FRun{Idx, 1, bPlain});
+
+					Offsets.Add(Offset);
+					Sizes.Add(Size);
+#if GMP_WITH_TYPENAME
+					TypeNames.Add(GetPropertyName(Prop));
+#endif
+				}
+			}
+		};
+
+		struct FCache
+		{
+			FRWLock Lock;
+			TMap<const UScriptStruct*, TSharedPtr<const FBinding, ESPMode::ThreadSafe>> Bindings;
+		};
+		static FCache& GetCache()
+		{
+			static FCache Cache;
+			return Cache;
+		}
+
+		static TSharedPtr<const FBinding, ESPMode::ThreadSafe> FindOrAdd(const UScriptStruct* ScriptStruct)
+		{
+			auto& Cache = GetCache();
+			{
+				FReadScopeLock ReadLock(Cache.Lock);
+				auto Find = Cache.Bindings.Find(ScriptStruct);
+				// a struct recreated at the same address gets a new binding
+				if (Find && (*Find)->Struct.Get() == ScriptStruct)
+					return *Find;
+			}
+			auto Binding = MakeShared<FBinding, ESPMode::ThreadSafe>(ScriptStruct);
+			FWriteScopeLock WriteLock(Cache.Lock);
+			Cache.Bindings.Add(ScriptStruct, Binding);
+			return Binding;
+		}
+
+		static void Invalidate()
+		{
+			auto& Cache = GetCache();
+			FWriteScopeLock WriteLock(Cache.Lock);
+			Cache.Bindings.Reset();
+		}
+	}  // namespace StructBinding
+
+	FSimpleMulticastDelegate& OnReflectionCachesInvalidated()
+	{
+		static FSimpleMulticastDelegate Delegate;
+		return Delegate;
+	}
+
+	static void InvalidateCaches()
+	{
+		PropCache::Invalidate();
+		StructBinding::Invalidate();
+		if (IsInGameThread())
+			OnReflectionCachesInvalidated().Broadcast();
+	}
+
+	static FDelayedAutoRegisterHelper DelayRegisterInvalidation(EDelayedRegisterRunPhase::EndOfEngineInit, [] {
+		FModuleManager::Get().OnModulesChanged().AddLambda([](FName, EModuleChangeReason) { InvalidateCaches(); });
+		FCoreUObjectDelegates::OnPackageReloaded.AddLambda([](EPackageReloadPhase Phase, FPackageReloadedEvent*) {
+			if (Phase == EPackageReloadPhase::PostBatchPostGC)
+				InvalidateCaches();
+		});
+#if WITH_EDITOR
+		if (GEditor)
+			GEditor->OnBlueprintCompiled().AddLambda([] { InvalidateCaches(); });
+#endif
+	});
+
+	void InvalidatePropertyFromStringCache()
+	{
+		InvalidateCaches();
+	}
+
 	bool PropertyFromString(FString TypeString, FProperty*& OutProp, bool bInTemplate, bool bInContainer, bool bNew)
 	{
-		return bNew ? PropertyFromStringImpl<true>(TypeString, OutProp, bInTemplate, bInContainer) : PropertyFromStringImpl<false>(TypeString, OutProp, bInTemplate, bInContainer);
+		if (bNew)
+			return PropertyFromStringImpl<true>(TypeString, OutProp, bInTemplate, bInContainer);
+
+		// cached results are readable from any thread
+		const auto Lookup = PropCache::MakeLookup(TypeString, bInTemplate, bInContainer);
+		bool bResolved = false;
+		if (PropCache::Find(Lookup, OutProp, bResolved))
+			return bResolved;
+
+		// a miss builds properties into the game thread owned storage and looks up objects
+		// other threads wait for the game thread to resolve it, so the game thread must not block on them meanwhile
+		if (!IsInGameThread())
+		{
+			FProperty* Prop = nullptr;
+			WaitOnGameThread([&] { bResolved = PropertyFromString(TypeString, Prop, bInTemplate, bInContainer, false); });
+			OutProp = Prop;
+			return bResolved;
+		}
+
+		bResolved = PropertyFromStringImpl<false>(TypeString, OutProp, bInTemplate, bInContainer);
+		PropCache::Add(Lookup, bResolved ? OutProp : nullptr);
+		return bResolved;
 	}
 
 #if GMP_USE_NEW_PROP_FROM_STRING
@@ -1652,39 +1919,64 @@ namespace GMP
 {
 bool MessageFromStructImpl(const UScriptStruct* ScriptStruct, const void* StructData, FTypedAddresses& Args)
 {
-	Args.Empty();
-	for (TFieldIterator<FProperty> It(ScriptStruct); It; ++It)
+	const auto Binding = Reflection::StructBinding::FindOrAdd(ScriptStruct);
+	const int32 Num = Binding->Props.Num();
+	Args.Reset(Num);
+	Args.SetNum(Num);
+	for (int32 Idx = 0; Idx < Num; ++Idx)
 	{
-		Args.AddDefaulted_GetRef().SetAddr(It->ContainerPtrToValuePtr<void>(StructData), *It);
+		auto& Arg = Args[Idx];
+		Arg.SetAddr(static_cast<const uint8*>(StructData) + Binding->Offsets[Idx]);
+#if GMP_WITH_TYPENAME
+		Arg.TypeName = Binding->TypeNames[Idx];
+#endif
 	}
 	return true;
 }
 
 bool MessageToStructImpl(const UScriptStruct* ScriptStruct, void* StructData, const FTypedAddresses& Args)
 {
-	do
+	const auto Binding = Reflection::StructBinding::FindOrAdd(ScriptStruct);
+	if (!ensure(Binding->Props.Num() <= Args.Num()))
+		return false;
+
+#if GMP_WITH_TYPENAME
+	for (int32 Idx = 0; Idx < Binding->Props.Num(); ++Idx)
 	{
-		TArray<const FProperty*> Props;
-		for (TFieldIterator<FProperty> It(ScriptStruct); It; ++It)
+		if (!ensure(Args[Idx].TypeName == Binding->TypeNames[Idx]))
+			return false;
+	}
+#endif
+
+	uint8* Dst = static_cast<uint8*>(StructData);
+	for (auto& Run : Binding->Runs)
+	{
+		if (!Run.bPlain)
 		{
-			Props.Add(*It);
+			auto Prop = Binding->Props[Run.First];
+			Prop->CopyCompleteValue(Dst + Binding->Offsets[Run.First], Args[Run.First].ToAddr());
+			continue;
 		}
 
-		if (!ensure(Props.Num() <= Args.Num()))
-			break;
+		// args taken from a struct of the same layout are copied as one block
+		const int32 Last = Run.First + Run.Num - 1;
+		const uint8* Base = static_cast<const uint8*>(Args[Run.First].ToAddr());
+		bool bContiguous = true;
+		for (int32 Idx = Run.First + 1; bContiguous && Idx <= Last; ++Idx)
+			bContiguous = static_cast<const uint8*>(Args[Idx].ToAddr()) - Base == Binding->Offsets[Idx] - Binding->Offsets[Run.First];
 
-		for (auto Idx = 0; Idx < Args.Num(); ++Idx)
+		if (bContiguous)
 		{
-			auto& Arg = Args[Idx];
-			auto& Prop = Props[Idx];
-			auto Addr = Arg.ToAddr(Prop);
-			if (!ensure(Addr))
-				break;
-			Prop->CopyCompleteValue(Prop->ContainerPtrToValuePtr<void>(StructData), Addr);
+			uint8* RunDst = Dst + Binding->Offsets[Run.First];
+			if (RunDst != Base)
+				FMemory::Memcpy(RunDst, Base, Binding->Offsets[Last] + Binding->Sizes[Last] - Binding->Offsets[Run.First]);
 		}
-		return true;
-	} while (false);
-
-	return false;
+		else
+		{
+			for (int32 Idx = Run.First; Idx <= Last; ++Idx)
+				FMemory::Memcpy(Dst + Binding->Offsets[Idx], Args[Idx].ToAddr(), Binding->Sizes[Idx]);
+		}
+	}
+	return true;
 }
 }  // namespace GMP
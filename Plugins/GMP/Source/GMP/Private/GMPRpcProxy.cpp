@@ -9,6 +9,7 @@
 #include "Engine/World.h"
 #include "GMPArchive.h"
 #include "GMPBPLib.h"
+#include "GMPCoalesce.h"
 #include "GMPRpcUtils.h"
 #include "GMPWorldLocals.h"
 #include "GameFramework/GameModeBase.h"
@@ -223,10 +224,17 @@ static FDelayedAutoRegisterHelper DelayInnerInitUGMPRpcProxy(EDelayedRegisterRun
 	static auto BindWorldEvent = [](UWorld* InWorld) {
 		if (ensure(/*!GIsEditor || */ InWorld || InWorld->IsGameWorld() && !InWorld->IsPreviewWorld()))
 		{
+			// global listeners watch every world, with per-world hubs the world's own listeners are told as well
+			static auto NotifyWorldEvent = [](const GMP::FMSGKEYFind& Key, UWorld* World) {
+				auto GlobalHub = GMP::FMessageUtils::GetMessageHub();
+				GlobalHub->SendObjectMessage(Key, GMP::FSigSource::NullSigSrc, World);
+				auto WorldHub = GMP::FMessageUtils::GetWorldHub(World);
+				if (WorldHub != GlobalHub)
+					WorldHub->SendObjectMessage(Key, GMP::FSigSource::NullSigSrc, World);
+			};
 			InWorld->OnWorldBeginPlay.AddLambda([InWorld] {
-				GMP::FMessageUtils::GetMessageHub()->SendObjectMessage(MSGKEY("GMP.OnWorldBeginPlay"), GMP::FSigSource::NullSigSrc, InWorld);
-				InWorld->GetTimerManager().SetTimerForNextTick(
-					FTimerDelegate::CreateWeakLambda(InWorld, [InWorld] { GMP::FMessageUtils::GetMessageHub()->SendObjectMessage(MSGKEY("GMP.OnWorldBeginPlayNextTick"), GMP::FSigSource::NullSigSrc, InWorld); }));
+				NotifyWorldEvent(MSGKEY("GMP.OnWorldBeginPlay"), InWorld);
+				InWorld->GetTimerManager().SetTimerForNextTick(FTimerDelegate::CreateWeakLambda(InWorld, [InWorld] { NotifyWorldEvent(MSGKEY("GMP.OnWorldBeginPlayNextTick"), InWorld); }));
 			});
 		}
 	};
@@ -366,6 +374,11 @@ void UGMPRpcProxy::Batch_Notify_Implementation(const TArray<FGMPRpcBatchData>& B
 	DispatchPendingProgress(Batcher);
 }
 
+void UGMPRpcProxy::Unreliable_Batch_Notify_Implementation(const TArray<FGMPRpcBatchData>& Batcher)
+{
+	DispatchPendingProgress(Batcher);
+}
+
 //////////////////////////////////////////////////////////////////////////
 void UGMPRpcProxy::CallMessageRemote(APlayerController* PC, const UObject* Sender, const FString& MessageStr, TArray<uint8>& Buffer, bool bReliable)
 {
@@ -378,7 +391,9 @@ void UGMPRpcProxy::CallMessageRemote(APlayerController* PC, const UObject* Sende
 		UGMPRpcProxy* Comp = PC ? PC->FindComponentByClass<UGMPRpcProxy>() : nullptr;
 		if (ensureWorldMsgf(Sender, Comp, TEXT("Found No Comp:%s"), *GetNameSafe(PC)))
 		{
-			if (Comp->ScopedCnt > 0)
+			if (GMP::FCoalescedMessageUtils::IsCoalesced(FName(*MessageStr, FNAME_Find)))
+				Comp->ParkCoalescedRPC(Sender, MessageStr, Buffer, bReliable);
+			else if (Comp->ScopedCnt > 0)
 				Comp->PendingRPCs.Emplace(const_cast<UObject*>(Sender), FString(MessageStr), MoveTemp(Buffer), false);
 			else if (bClient)
 				Comp->Message_Request(Sender, MessageStr, Buffer);
@@ -390,6 +405,52 @@ void UGMPRpcProxy::CallMessageRemote(APlayerController* PC, const UObject* Sende
 	}
 }
 
+void UGMPRpcProxy::ParkCoalescedRPC(const UObject* Sender, const FString& MessageStr, TArray<uint8>& Buffer, bool bReliable)
+{
+	if (!CoalescedFlushHandle.IsValid())
+		CoalescedFlushHandle = GMP::FCoalescedMessageUtils::OnCoalescedFlushed().AddUObject(this, &UGMPRpcProxy::FlushCoalescedRPCs);
+
+	// latest value wins, the slot keeps its position in the batch
+	// a reliable send is never downgraded by a later unreliable one replacing its value
+	auto Key = MakeTuple(FObjectKey(Sender), MessageStr);
+	if (auto Idx = CoalescedIndices.Find(Key))
+	{
+		CoalescedRPCs[*Idx].Buff = MoveTemp(Buffer);
+		if (bReliable)
+			CoalescedReliable[*Idx] = true;
+	}
+	else
+	{
+		CoalescedIndices.Add(Key, CoalescedRPCs.Emplace(const_cast<UObject*>(Sender), FString(MessageStr), MoveTemp(Buffer), false));
+		CoalescedReliable.Add(bReliable);
+	}
+}
+
+void UGMPRpcProxy::FlushCoalescedRPCs()
+{
+	if (CoalescedRPCs.Num() == 0)
+		return;
+
+	CoalescedIndices.Reset();
+	auto Pendings = MoveTemp(CoalescedRPCs);
+	auto Reliables = MoveTemp(CoalescedReliable);
+	// server requests only go reliable
+	if (GetNetMode() != NM_DedicatedServer)
+	{
+		Batch_Request(Pendings);
+		return;
+	}
+
+	TArray<FGMPRpcBatchData> ReliableBatch;
+	TArray<FGMPRpcBatchData> UnreliableBatch;
+	for (int32 Idx = 0; Idx < Pendings.Num(); ++Idx)
+		(Reliables[Idx] ? ReliableBatch : UnreliableBatch).Add(MoveTemp(Pendings[Idx]));
+	if (ReliableBatch.Num() > 0)
+		Batch_Notify(ReliableBatch);
+	if (UnreliableBatch.Num() > 0)
+		Unreliable_Batch_Notify(UnreliableBatch);
+}
+
 void UGMPRpcProxy::Message_Request_Implementation(const UObject* InObject, const FString& MessageStr, const TArray<uint8>& Buffer)
 {
 	CallLocalMessage(InObject, MessageStr, Buffer);
@@ -419,7 +480,7 @@ bool UGMPRpcProxy::CallLocalMessage(const UObject* InObject, const FString& Mess
 	if (!ensureWorldMsgf(InObject, Find, TEXT("rpc not registered for %s"), *MessageName.ToString()))
 		return false;
 
-	if (!ensureWorldMsgf(InObject, FMessageUtils::GetMessageHub()->IsAlive(MessageName), TEXT("no listener for %s"), *MessageStr))
+	if (!ensureWorldMsgf(InObject, FMessageUtils::GetSourceHub(InObject)->IsAlive(MessageName), TEXT("no listener for %s"), *MessageStr))
 		return false;
 
 	return LocalBroadcastMessage(MessageStr, *Find, InObject, Buffer);
@@ -489,7 +550,8 @@ bool UGMPRpcProxy::LocalBroadcastMessage(const FString& MessageStr, const TArray
 
 	if (bSucc)
 	{
-		FMessageUtils::GetMessageHub()->ScriptNotifyMessage(MessageStr, Params, Sender ? Sender : GetWorld());
+		FSigSource SigSource = Sender ? Sender : GetWorld();
+		FMessageUtils::GetSourceHub(SigSource)->ScriptNotifyMessage(MessageStr, Params, SigSource);
 	}
 
 	for (--Index; Index >= 0; --Index)
@@ -510,7 +572,8 @@ bool UGMPRpcProxy::LocalBroadcastMessage(const FString& MessageStr, const TArray
 	if (!UGMPBPLib::ArchiveToMessage(Buffer, Params, Props, PackageMap))
 		return false;
 
-	FMessageUtils::GetMessageHub()->ScriptNotifyMessage(MessageStr, Params, Sender ? Sender : GetWorld());
+	FSigSource SigSource = Sender ? Sender : GetWorld();
+	FMessageUtils::GetSourceHub(SigSource)->ScriptNotifyMessage(MessageStr, Params, SigSource);
 	for (auto i = 0; i < Props.Num(); ++i)
 	{
 		Props[i]->DestroyValue_InContainer(Params[i].ToAddr());
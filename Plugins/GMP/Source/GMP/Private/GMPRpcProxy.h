@@ -8,6 +8,7 @@
 #include "GMPTypeTraits.h"
 #include "Templates/SubclassOf.h"
 #include "UObject/CoreNet.h"
+#include "UObject/ObjectKey.h"
 #include "UObject/WeakObjectPtr.h"
 #include "UObject/WeakObjectPtrTemplates.h"
 
@@ -114,6 +115,8 @@ protected:
 	void Batch_Request(const TArray<FGMPRpcBatchData>& Batcher);
 	UFUNCTION(Client, Reliable)
 	void Batch_Notify(const TArray<FGMPRpcBatchData>& Batcher);
+	UFUNCTION(Client, unreliable)
+	void Unreliable_Batch_Notify(const TArray<FGMPRpcBatchData>& Batcher);
 
 	UPROPERTY(Transient)
 	TArray<FGMPRpcBatchData> PendingRPCs;
@@ -127,6 +130,18 @@ protected:
 			Proxy->FlushPendingRPCs();
 	}
 	friend struct FGMPRpcBatchScope;
+
+	// coalesced message keys collapse into one rpc per (sender, key) until the next coalescing flush
+	UPROPERTY(Transient)
+	TArray<FGMPRpcBatchData> CoalescedRPCs;
+	TMap<TPair<FObjectKey, FString>, int32> CoalescedIndices;
+	// per parked slot, set once any of its sends was reliable
+	TBitArray<> CoalescedReliable;
+	FDelegateHandle CoalescedFlushHandle;
+
+	void ParkCoalescedRPC(const UObject* Sender, const FString& MessageStr, TArray<uint8>& Buffer, bool bReliable);
+	void FlushCoalescedRPCs();
+
 public:
 	static void CallMessageRemote(APlayerController* PC, const UObject* Sender, const FString& MessageStr, TArray<uint8>& Buffer, bool bReliable = true);
 	static bool CallFunctionRemote(APlayerController* PC, UObject* InUserObject, FName InFunctionName, TArray<uint8>& Buffer);
@@ -2,7 +2,10 @@
 
 #include "GMPSerializer.h"
 
+#include "HAL/IConsoleManager.h"
+#include "Misc/App.h"
 #include "UObject/NameTypes.h"
+#include "UObject/UnrealType.h"
 
 namespace GMP
 {
@@ -78,5 +81,42 @@ namespace Serializer
 			return FName(NameView.Len(), NameView.GetData());
 	}
 
+	namespace Parallel
+	{
+		static int32 MinElements = 0;
+		FAutoConsoleVariableRef CVar_ParallelMinElements(TEXT("gmp.serializer.parallel.minelements"), MinElements, TEXT("json/proto containers with at least this many elements are serialized in parallel chunks, 0 disables"));
+		static int32 ChunkSize = 1024;
+		FAutoConsoleVariableRef CVar_ParallelChunkSize(TEXT("gmp.serializer.parallel.chunksize"), ChunkSize, TEXT("elements per parallel serialization chunk"));
+
+		static thread_local bool bInChunk = false;
+
+		int32 GetMinElements() { return MinElements; }
+		int32 GetChunkSize() { return FMath::Max(ChunkSize, 64); }
+
+		static bool ContainsObjectReference(FProperty* Prop)
+		{
+			// resolving object paths has to stay on the calling thread
+			TArray<const FStructProperty*> EncounteredStructProps;
+			return Prop && Prop->ContainsObjectReference(EncounteredStructProps, EPropertyObjectReferenceType::Strong | EPropertyObjectReferenceType::Weak);
+		}
+
+		bool ShouldSplit(int32 Num, FProperty* ElementProp, FProperty* KeyProp)
+		{
+			const int32 Min = GetMinElements();
+			if (Min <= 0 || Num < FMath::Max(Min, GetChunkSize() + 1) || bInChunk || !FApp::ShouldUseThreadingForPerformance())
+				return false;
+			return !ContainsObjectReference(ElementProp) && !ContainsObjectReference(KeyProp);
+		}
+
+		FChunkScope::FChunkScope()
+			: bPrevInChunk(bInChunk)
+		{
+			bInChunk = true;
+		}
+		FChunkScope::~FChunkScope()
+		{
+			bInChunk = bPrevInChunk;
+		}
+	}  // namespace Parallel
 }  // namespace Serializer
 }  // namespace GMP
@@ -0,0 +1,527 @@
+//  Copyright GenericMessagePlugin, Inc. All Rights Reserved.
+
+#include "GMPShmBridge.h"
+
+#include "GMPBPLib.h"
+#include "GMPReflection.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/Crc.h"
+#include "UnrealCompatibility.h"
+
+#include <atomic>
+
+namespace GMP
+{
+namespace Bridge
+{
+	// lives at the start of the shared region, the ring data follows
+	// Head is only written by the publisher and Tail only by the subscriber
+	struct alignas(64) FRingHeader
+	{
+		std::atomic<uint32> Magic;
+		uint32 Version;
+		uint32 Capacity;
+		std::atomic<uint32> bClosed;
+		std::atomic<uint64> Dropped;
+		alignas(64) std::atomic<uint64> Head;
+		alignas(64) std::atomic<uint64> Tail;
+	};
+
+	namespace Internal
+	{
+		constexpr uint32 RingMagic = 0x474D5052;  // GMPR
+		constexpr uint32 RingVersion = 1;
+
+		// records start on RecordAlign so a record header never wraps
+		struct FRecordHeader
+		{
+			uint32 Size;
+			uint32 SchemaId;
+			uint32 NumBits;
+			uint32 Reserved;
+		};
+		constexpr uint32 RecordAlign = sizeof(FRecordHeader);
+
+		// keys a subscriber is injecting are not published again by a bridge of the same process
+		// other keys sent by their listeners still go out
+		static TArray<FName, TInlineAllocator<4>> InjectingKeys;
+
+		static FString GetRegionName(const FString& ChannelName) { return FString::Printf(TEXT("GMPBridge_%s"), *ChannelName); }
+
+		static void CopyIn(uint8* Data, uint32 Mask, uint64 Pos, const void* Src, uint32 Len)
+		{
+			const uint32 Offset = uint32(Pos) & Mask;
+			const uint32 First = FMath::Min(Len, Mask + 1 - Offset);
+			FMemory::Memcpy(Data + Offset, Src, First);
+			if (First < Len)
+				FMemory::Memcpy(Data, static_cast<const uint8*>(Src) + First, Len - First);
+		}
+		static void CopyOut(void* Dst, const uint8* Data, uint32 Mask, uint64 Pos, uint32 Len)
+		{
+			const uint32 Offset = uint32(Pos) & Mask;
+			const uint32 First = FMath::Min(Len, Mask + 1 - Offset);
+			FMemory::Memcpy(Dst, Data + Offset, First);
+			if (First < Len)
+				FMemory::Memcpy(static_cast<uint8*>(Dst) + First, Data, Len - First);
+		}
+
+		static bool IsBridgeable(FProperty* Prop)
+		{
+			// a process local object path means nothing on the other side
+			TArray<const FStructProperty*> EncounteredStructProps;
+			if (Prop->ContainsObjectReference(EncounteredStructProps, EPropertyObjectReferenceType::Strong | EPropertyObjectReferenceType::Weak))
+				return false;
+			return !Prop->IsA<FMapProperty>() && !Prop->IsA<FSetProperty>();
+		}
+
+		// stable across processes
+		static uint32 MakeSchemaId(const FName& MessageKey, const TArray<FProperty*>& Props)
+		{
+			FString Sig = MessageKey.ToString();
+			Sig.AppendChar(TEXT('('));
+			for (int32 Idx = 0; Idx < Props.Num(); ++Idx)
+			{
+				if (Idx > 0)
+					Sig.AppendChar(TEXT(','));
+				Sig += Reflection::GetPropertyName(Props[Idx]).ToString();
+			}
+			Sig.AppendChar(TEXT(')'));
+			const uint32 Id = FCrc::StrCrc32(*Sig.ToLower());
+			return Id ? Id : 1u;
+		}
+	}  // namespace Internal
+
+	TSharedRef<FShmMessageBridge> FShmMessageBridge::Create(const FString& ChannelName, EShmRole Role, const FShmBridgeSettings& InSettings)
+	{
+		auto Bridge = MakeShared<FShmMessageBridge>(ChannelName, Role, InSettings);
+		if (InSettings.bAutoPump)
+			Bridge->EndFrameHandle = FCoreDelegates::OnEndFrame.AddSP(Bridge, &FShmMessageBridge::OnEndFrame);
+		return Bridge;
+	}
+
+	FShmMessageBridge::FShmMessageBridge(const FString& InChannelName, EShmRole InRole, const FShmBridgeSettings& InSettings)
+		: ChannelName(InChannelName)
+		, Role(InRole)
+		, Settings(InSettings)
+	{
+		Attach();
+	}
+
+	FShmMessageBridge::~FShmMessageBridge()
+	{
+		if (EndFrameHandle.IsValid())
+			FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+
+		if (auto Hub = FMessageUtils::GetMessageHub())
+		{
+			for (auto& Pair : Schemas)
+			{
+				if (Pair.Value.ListenKey)
+					Hub->ScriptUnbindMessage(FMSGKEYFind(FMSGKEY(Pair.Key)), Pair.Value.ListenKey);
+			}
+		}
+
+		// whatever is still backlogged gets one last chance
+		if (Role == EShmRole::Publisher)
+			FlushBacklog();
+		Detach();
+	}
+
+	FRingHeader* FShmMessageBridge::GetHeader() const
+	{
+		return Region ? static_cast<FRingHeader*>(Region->GetAddress()) : nullptr;
+	}
+
+	uint8* FShmMessageBridge::GetRingData() const
+	{
+		return Region ? static_cast<uint8*>(Region->GetAddress()) + sizeof(FRingHeader) : nullptr;
+	}
+
+	bool FShmMessageBridge::Attach()
+	{
+		using namespace Internal;
+		if (Region)
+			return true;
+
+		const FString RegionName = GetRegionName(ChannelName);
+		const uint32 Access = FPlatformMemory::ESharedMemoryAccess::Read | FPlatformMemory::ESharedMemoryAccess::Write;
+		if (Role == EShmRole::Publisher)
+		{
+			Capacity = FMath::RoundUpToPowerOfTwo(FMath::Max(Settings.CapacityBytes, 4096));
+			Region = FPlatformMemory::MapNamedSharedMemoryRegion(RegionName, true, Access, sizeof(FRingHeader) + Capacity);
+			if (!Region)
+			{
+				GMP_ERROR(TEXT("GMPShmBridge : unable to create %s"), *RegionName);
+				return false;
+			}
+
+			auto Header = new (Region->GetAddress()) FRingHeader();
+			Header->Version = RingVersion;
+			Header->Capacity = Capacity;
+			Header->bClosed.store(0, std::memory_order_relaxed);
+			Header->Dropped.store(0, std::memory_order_relaxed);
+			Header->Head.store(0, std::memory_order_relaxed);
+			Header->Tail.store(0, std::memory_order_relaxed);
+			// published last, the subscriber ignores the region until then
+			Header->Magic.store(RingMagic, std::memory_order_release);
+			return true;
+		}
+
+		// the capacity is only known once the header is readable
+		auto Probe = FPlatformMemory::MapNamedSharedMemoryRegion(RegionName, false, Access, sizeof(FRingHeader));
+		if (!Probe)
+			return false;
+
+		auto ProbeHeader = static_cast<FRingHeader*>(Probe->GetAddress());
+		const bool bReady = ProbeHeader->Magic.load(std::memory_order_acquire) == RingMagic && ProbeHeader->Version == RingVersion && !ProbeHeader->bClosed.load(std::memory_order_acquire);
+		const uint32 RingCapacity = ProbeHeader->Capacity;
+		FPlatformMemory::UnmapNamedSharedMemoryRegion(Probe);
+		if (!bReady || !ensure(FMath::IsPowerOfTwo(RingCapacity)))
+			return false;
+
+		Region = FPlatformMemory::MapNamedSharedMemoryRegion(RegionName, false, Access, sizeof(FRingHeader) + RingCapacity);
+		if (!Region)
+			return false;
+
+		Capacity = RingCapacity;
+		GMP_LOG(TEXT("GMPShmBridge : attached to %s, %u bytes"), *RegionName, Capacity);
+		return true;
+	}
+
+	void FShmMessageBridge::Detach()
+	{
+		if (!Region)
+			return;
+
+		if (Role == EShmRole::Publisher)
+			GetHeader()->bClosed.store(1, std::memory_order_release);
+		FPlatformMemory::UnmapNamedSharedMemoryRegion(Region);
+		Region = nullptr;
+		Capacity = 0;
+	}
+
+	bool FShmMessageBridge::RegisterKey(const FName& MessageKey, const TArray<FProperty*>& Props)
+	{
+		if (!ensure(!MessageKey.IsNone()))
+			return false;
+
+		FSchema Schema;
+		Schema.MessageKey = MessageKey;
+		FArrayTypeNames TypeNames;
+		for (auto Prop : Props)
+		{
+			if (!ensureMsgf(Prop && Internal::IsBridgeable(Prop), TEXT("GMPShmBridge : %s has a parameter that can not leave the process"), *MessageKey.ToString()))
+				return false;
+
+			const int32 PropAlign = FMath::Max(Prop->GetMinAlignment(), 1);
+			Schema.Size = Align(Schema.Size, PropAlign);
+			Schema.Align = FMath::Max(Schema.Align, PropAlign);
+			Schema.Props.Add(Prop);
+			Schema.Offsets.Add(Schema.Size);
+#if UE_5_05_OR_LATER
+			Schema.Size += Prop->GetElementSize() * Prop->ArrayDim;
+#else
+			Schema.Size += Prop->ElementSize * Prop->ArrayDim;
+#endif
+			TypeNames.Add(Reflection::GetPropertyName(Prop));
+		}
+
+		// the bridge schema has to agree with what the hub already knows about the key
+		const FArrayTypeNames* OldTypes = nullptr;
+		if (!FMessageHub::IsSignatureCompatible(Role == EShmRole::Subscriber, MessageKey, TypeNames, OldTypes))
+			return false;
+
+		Schema.Id = Internal::MakeSchemaId(MessageKey, Props);
+		if (auto Exist = SchemaIds.Find(Schema.Id))
+		{
+			if (!ensureMsgf(*Exist == MessageKey, TEXT("GMPShmBridge : schema id of %s collides with %s"), *MessageKey.ToString(), *Exist->ToString()))
+				return false;
+		}
+
+		UnregisterKey(MessageKey);
+		if (Role == EShmRole::Publisher)
+		{
+			auto Hub = FMessageUtils::GetMessageHub();
+			if (!ensure(Hub))
+				return false;
+			Schema.ListenKey = Hub->ScriptListenMessage(FSigSource::NullSigSrc, MessageKey, nullptr, [this](FMessageBody& Body) { OnHubMessage(Body); });
+		}
+
+		SchemaIds.Add(Schema.Id, MessageKey);
+		Schemas.Add(MessageKey, MoveTemp(Schema));
+		return true;
+	}
+
+	bool FShmMessageBridge::RegisterKey(const FName& MessageKey, const FArrayTypeNames& TypeNames)
+	{
+		TArray<FProperty*> Props;
+		for (auto& TypeName : TypeNames)
+		{
+			FProperty* Prop = nullptr;
+			if (!Reflection::PropertyFromString(TypeName.ToString(), Prop) || !Prop)
+			{
+				GMP_ERROR(TEXT("GMPShmBridge : unknown type %s for %s"), *TypeName.ToString(), *MessageKey.ToString());
+				return false;
+			}
+			Props.Add(Prop);
+		}
+		return RegisterKey(MessageKey, Props);
+	}
+
+	void FShmMessageBridge::UnregisterKey(const FName& MessageKey)
+	{
+		FSchema Schema;
+		if (!Schemas.RemoveAndCopyValue(MessageKey, Schema))
+			return;
+
+		SchemaIds.Remove(Schema.Id);
+		if (Schema.ListenKey)
+		{
+			if (auto Hub = FMessageUtils::GetMessageHub())
+				Hub->ScriptUnbindMessage(FMSGKEYFind(FMSGKEY(MessageKey)), Schema.ListenKey);
+		}
+	}
+
+	uint32 FShmMessageBridge::FindSchemaId(const FName& MessageKey, const TArray<FProperty*>& Props) const
+	{
+		auto Schema = Schemas.Find(MessageKey);
+		if (!Schema || !ensureMsgf(Schema->Props.Num() == Props.Num(), TEXT("GMPShmBridge : %s expects %d params but got %d"), *MessageKey.ToString(), Schema->Props.Num(), Props.Num()))
+			return 0;
+
+		for (int32 Idx = 0; Idx < Props.Num(); ++Idx)
+		{
+			if (Props[Idx] != Schema->Props[Idx] && !ensure(Reflection::GetPropertyName(Props[Idx]) == Reflection::GetPropertyName(Schema->Props[Idx])))
+				return 0;
+		}
+		return Schema->Id;
+	}
+
+	void FShmMessageBridge::OnHubMessage(FMessageBody& Body)
+	{
+		if (Internal::InjectingKeys.Contains(Body.MessageKey()))
+			return;
+		Publish(Body.MessageKey(), Body.GetParams());
+	}
+
+	EShmPublishResult FShmMessageBridge::Publish(const FName& MessageKey, const FTypedAddresses& Params)
+	{
+		auto Schema = Schemas.Find(MessageKey);
+		if (Role != EShmRole::Publisher || !Schema || !ensureMsgf(Params.Num() == Schema->Props.Num(), TEXT("GMPShmBridge : %s expects %d params but got %d"), *MessageKey.ToString(), Schema->Props.Num(), Params.Num()))
+			return EShmPublishResult::Rejected;
+
+		FGMPNetBitWriter Writer(static_cast<UPackageMap*>(nullptr), 0);
+		for (int32 Idx = 0; Idx < Params.Num(); ++Idx)
+		{
+			if (!UGMPBPLib::NetSerializeProperty(Writer, Schema->Props[Idx], Params[Idx].ToAddr(), nullptr))
+				return EShmPublishResult::Rejected;
+		}
+		return PublishRecord(Schema->Id, Writer);
+	}
+
+	EShmPublishResult FShmMessageBridge::PublishRecord(uint32 SchemaId, FGMPNetBitWriter& Writer)
+	{
+		if (Role != EShmRole::Publisher || Writer.IsError())
+			return EShmPublishResult::Rejected;
+
+		const uint32 NumBytes = static_cast<uint32>(Writer.GetNumBytes());
+		const uint32 NumBits = static_cast<uint32>(Writer.GetNumBits());
+		const uint32 Size = Align(sizeof(Internal::FRecordHeader) + NumBytes, Internal::RecordAlign);
+		if (Capacity > 0 && Size > Capacity / 2)
+		{
+			GMP_WARNING(TEXT("GMPShmBridge : %u bytes record does not fit %s"), Size, *ChannelName);
+			return EShmPublishResult::Rejected;
+		}
+
+		// nothing overtakes the backlog
+		if (Backlog.Num() == 0 && TryWrite(SchemaId, Writer.GetData(), NumBytes, NumBits))
+			return EShmPublishResult::Written;
+
+		if (Settings.FullPolicy == EShmFullPolicy::Backlog && BacklogBytes + int32(NumBytes) <= Settings.MaxBacklogBytes)
+		{
+			auto& Pending = Backlog.AddDefaulted_GetRef();
+			Pending.SchemaId = SchemaId;
+			Pending.NumBits = NumBits;
+			Pending.Bytes.Append(Writer.GetData(), NumBytes);
+			BacklogBytes += NumBytes;
+			return EShmPublishResult::Backlogged;
+		}
+
+		++Dropped;
+		if (auto Header = GetHeader())
+			Header->Dropped.fetch_add(1, std::memory_order_relaxed);
+		return EShmPublishResult::Dropped;
+	}
+
+	bool FShmMessageBridge::TryWrite(uint32 SchemaId, const uint8* Bytes, uint32 NumBytes, uint32 NumBits)
+	{
+		using namespace Internal;
+		auto Header = GetHeader();
+		if (!Header && (!Attach() || !(Header = GetHeader())))
+			return false;
+
+		const uint32 Size = Align(sizeof(FRecordHeader) + NumBytes, RecordAlign);
+		const uint64 Head = Header->Head.load(std::memory_order_relaxed);
+		const uint64 Tail = Header->Tail.load(std::memory_order_acquire);
+		if (Head - Tail + Size > Capacity)
+			return false;
+
+		const uint32 Mask = Capacity - 1;
+		uint8* Data = GetRingData();
+		FRecordHeader Rec{Size, SchemaId, NumBits, 0};
+		CopyIn(Data, Mask, Head, &Rec, sizeof(Rec));
+		CopyIn(Data, Mask, Head + sizeof(Rec), Bytes, NumBytes);
+		Header->Head.store(Head + Size, std::memory_order_release);
+		++Written;
+		return true;
+	}
+
+	int32 FShmMessageBridge::FlushBacklog()
+	{
+		int32 Cnt = 0;
+		for (; Cnt < Backlog.Num(); ++Cnt)
+		{
+			auto& Pending = Backlog[Cnt];
+			if (!TryWrite(Pending.SchemaId, Pending.Bytes.GetData(), Pending.Bytes.Num(), Pending.NumBits))
+				break;
+			BacklogBytes -= Pending.Bytes.Num();
+		}
+		if (Cnt > 0)
+			Backlog.RemoveAt(0, Cnt, EAllowShrinking::No);
+		return Cnt;
+	}
+
+	int32 FShmMessageBridge::Pump()
+	{
+		if (Role == EShmRole::Publisher)
+			return FlushBacklog();
+		return Drain();
+	}
+
+	void FShmMessageBridge::OnEndFrame()
+	{
+		Pump();
+	}
+
+	int32 FShmMessageBridge::Drain()
+	{
+		using namespace Internal;
+		// a listener pumping again would start from the same tail and deliver the records twice
+		if (bDraining || !Attach())
+			return 0;
+		TGuardValue<bool> DrainGuard(bDraining, true);
+
+		auto Header = GetHeader();
+		const uint32 Mask = Capacity - 1;
+		const uint8* Data = GetRingData();
+		uint64 Tail = Header->Tail.load(std::memory_order_relaxed);
+		const uint64 Head = Header->Head.load(std::memory_order_acquire);
+
+		int32 Cnt = 0;
+		while (Tail != Head && (Settings.MaxRecordsPerPump <= 0 || Cnt < Settings.MaxRecordsPerPump))
+		{
+			FRecordHeader Rec;
+			CopyOut(&Rec, Data, Mask, Tail, sizeof(Rec));
+			if (Rec.Size < sizeof(Rec) || Rec.Size > Head - Tail || Rec.NumBits > (Rec.Size - sizeof(Rec)) * 8)
+			{
+				GMP_ERROR(TEXT("GMPShmBridge : corrupted record on %s, skipping %llu bytes"), *ChannelName, Head - Tail);
+				Tail = Head;
+				break;
+			}
+
+			// the slot is handed back before delivery, listeners may take their time
+			const uint32 NumBytes = (Rec.NumBits + 7) / 8;
+			Scratch.SetNumUninitialized(NumBytes + 1, EAllowShrinking::No);
+			CopyOut(Scratch.GetData(), Data, Mask, Tail + sizeof(Rec), NumBytes);
+			Tail += Rec.Size;
+			Header->Tail.store(Tail, std::memory_order_release);
+			++Cnt;
+
+			auto Key = SchemaIds.Find(Rec.SchemaId);
+			if (!Key)
+			{
+				++Unknown;
+				continue;
+			}
+			// a listener may unregister keys or pump again
+			TArray<uint8> Bytes = MoveTemp(Scratch);
+			Deliver(Schemas.FindChecked(*Key), Bytes.GetData(), Rec.NumBits);
+			Scratch = MoveTemp(Bytes);
+			// the ring is gone if a listener detached the bridge
+			if (!Region)
+				return Cnt;
+		}
+		Header->Tail.store(Tail, std::memory_order_release);
+
+		// the publisher went away, a new one may create the channel again
+		if (Tail == Header->Head.load(std::memory_order_acquire) && Header->bClosed.load(std::memory_order_acquire))
+		{
+			Dropped = Header->Dropped.load(std::memory_order_relaxed);
+			Detach();
+		}
+		return Cnt;
+	}
+
+	void FShmMessageBridge::Deliver(const FSchema& Schema, uint8* Bytes, uint32 NumBits)
+	{
+		auto Hub = FMessageUtils::GetMessageHub();
+		if (!Hub)
+			return;
+
+		// the schema may go away inside the notify
+		const FName MessageKey = Schema.MessageKey;
+		const TArray<FProperty*> Props = Schema.Props;
+		uint8* Locals = static_cast<uint8*>(FMemory::Malloc(FMath::Max(Schema.Size, 1), Schema.Align));
+
+		FTypedAddresses Params;
+		Params.Reserve(Props.Num());
+		FGMPNetBitReader Reader(static_cast<UPackageMap*>(nullptr), Bytes, NumBits);
+		bool bSucc = true;
+		int32 Index = 0;
+		for (; Index < Props.Num(); ++Index)
+		{
+			uint8* Addr = Locals + Schema.Offsets[Index];
+			Props[Index]->InitializeValue(Addr);
+			Params.AddDefaulted_GetRef().SetAddr(Addr, Props[Index]);
+			if (!UGMPBPLib::NetSerializeProperty(Reader, Props[Index], Addr, nullptr))
+			{
+				bSucc = false;
+				++Index;
+				break;
+			}
+		}
+
+		if (bSucc)
+		{
+			++Received;
+			Internal::InjectingKeys.Push(MessageKey);
+			Hub->ScriptNotifyMessage(MessageKey, Params);
+			Internal::InjectingKeys.Pop(EAllowShrinking::No);
+		}
+		else
+		{
+			GMP_WARNING(TEXT("GMPShmBridge : failed to decode %s on %s"), *MessageKey.ToString(), *ChannelName);
+		}
+
+		for (--Index; Index >= 0; --Index)
+			Props[Index]->DestroyValue(Params[Index].ToAddr());
+		FMemory::Free(Locals);
+	}
+
+	FShmBridgeStats FShmMessageBridge::GetStats() const
+	{
+		FShmBridgeStats Stats;
+		Stats.Written = Written;
+		Stats.Received = Received;
+		Stats.Unknown = Unknown;
+		Stats.BacklogBytes = BacklogBytes;
+		Stats.Dropped = Dropped;
+		if (auto Header = GetHeader())
+		{
+			if (Role == EShmRole::Subscriber)
+				Stats.Dropped = Header->Dropped.load(std::memory_order_relaxed);
+			Stats.FreeBytes = int32(Capacity - (Header->Head.load(std::memory_order_acquire) - Header->Tail.load(std::memory_order_acquire)));
+		}
+		return Stats;
+	}
+}  // namespace Bridge
+}  // namespace GMP
@@ -0,0 +1,345 @@
+//  Copyright GenericMessagePlugin, Inc. All Rights Reserved.
+
+#include "GMPSigElmAllocator.h"
+
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTLS.h"
+#include "Misc/ScopeLock.h"
+#include "Misc/ScopeRWLock.h"
+
+#include <atomic>
+
+namespace GMP
+{
+namespace SigElmAllocator
+{
+	static bool bUseSlab = true;
+	FAutoConsoleVariableRef CVar_UseSlab(TEXT("gmp.sigelm.slab"), bUseSlab, TEXT("allocate listener slots from size class pages, slots already allocated are unaffected"));
+
+	// chunks come from FMemory, pages are carved out of chunks and hold slots of one size class and one arena
+	static constexpr SIZE_T ChunkSize = 64 * 1024;
+	static constexpr SIZE_T PageSize = 4 * 1024;
+	static constexpr uint32 SlotAlign = 16;
+	static constexpr uint32 ClassSizes[] = {48, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320, 384, 448, 512};
+	static constexpr int32 NumClasses = sizeof(ClassSizes) / sizeof(ClassSizes[0]);
+	static constexpr uint32 MaxSlotSize = ClassSizes[NumClasses - 1];
+	// slots allocated outside of an arena scope spread over these by thread
+	static constexpr uint32 NumSharedArenas = 8;
+
+	struct FPage
+	{
+		FArena* Arena;
+		FPage* Prev;
+		FPage* Next;
+		void* FreeSlots;
+		uint8* Bump;
+		int32 Class;
+		int32 Live;
+	};
+	static constexpr SIZE_T HeaderSize = (sizeof(FPage) + SlotAlign - 1) & ~SIZE_T(SlotAlign - 1);
+
+	struct FArena
+	{
+		// guards the pages of the arena and their slots
+		FCriticalSection Lock;
+		// pages with at least one slot in use and one free
+		FPage* Partial[NumClasses] = {};
+		int32 NumPages = 0;
+		bool bReleased = false;
+	};
+
+	// lock order is arena, pool, chunks
+	struct FState
+	{
+		FArena Shared[NumSharedArenas];
+
+		FCriticalSection PoolLock;
+		FPage* FreePages = nullptr;
+		// used pages per chunk
+		TMap<UPTRINT, int32> ChunkPages;
+		UPTRINT SpareChunk = 0;
+		FGMPMemoryStat Reserved;
+
+		// tells slab slots from large ones, read on every free
+		FRWLock ChunkLock;
+		TSet<UPTRINT> Chunks;
+
+		FCriticalSection LargeLock;
+		TMap<void*, SIZE_T> LargeSlots;
+		FGMPMemoryStat Large;
+
+		std::atomic<int64> UsedBytes{0};
+		std::atomic<int32> UsedCount{0};
+		uint8 SizeToClass[MaxSlotSize / SlotAlign + 1];
+
+		FState()
+		{
+			int32 Class = 0;
+			for (uint32 Idx = 0; Idx <= MaxSlotSize / SlotAlign; ++Idx)
+			{
+				while (ClassSizes[Class] < Idx * SlotAlign)
+					++Class;
+				SizeToClass[Idx] = Class;
+			}
+		}
+	};
+
+	static FState& GetState()
+	{
+		// never destroyed, slots may be freed during static teardown
+		static FState* State = new FState();
+		return *State;
+	}
+
+	static thread_local FArena* CurrentArena = nullptr;
+
+	FORCEINLINE static UPTRINT ChunkOf(const void* Ptr) { return UPTRINT(Ptr) & ~UPTRINT(ChunkSize - 1); }
+	FORCEINLINE static FPage* PageOf(const void* Ptr) { return reinterpret_cast<FPage*>(UPTRINT(Ptr) & ~UPTRINT(PageSize - 1)); }
+	FORCEINLINE static bool IsFull(const FPage* Page) { return !Page->FreeSlots && Page->Bump + ClassSizes[Page->Class] > reinterpret_cast<const uint8*>(Page) + PageSize; }
+
+	static void LinkPage(FPage*& Head, FPage* Page)
+	{
+		Page->Prev = nullptr;
+		Page->Next = Head;
+		if (Head)
+			Head->Prev = Page;
+		Head = Page;
+	}
+
+	static void UnlinkPage(FPage*& Head, FPage* Page)
+	{
+		if (Page->Prev)
+			Page->Prev->Next = Page->Next;
+		else
+			Head = Page->Next;
+		if (Page->Next)
+			Page->Next->Prev = Page->Prev;
+		Page->Prev = Page->Next = nullptr;
+	}
+
+	static bool IsSlabSlot(FState& State, const void* Ptr)
+	{
+		FReadScopeLock ReadLock(State.ChunkLock);
+		return State.Chunks.Contains(ChunkOf(Ptr));
+	}
+
+	// the arena lock is held by the caller
+	static FPage* AcquirePage(FState& State, FArena* Arena, int32 Class)
+	{
+		FPage* Page = nullptr;
+		{
+			FScopeLock PoolLock(&State.PoolLock);
+			if (!State.FreePages)
+			{
+				uint8* Chunk = static_cast<uint8*>(FMemory::Malloc(ChunkSize, ChunkSize));
+				State.ChunkPages.Add(UPTRINT(Chunk), 0);
+				State.Reserved.Add(ChunkSize);
+				for (SIZE_T Offset = ChunkSize; Offset > 0; Offset -= PageSize)
+					LinkPage(State.FreePages, reinterpret_cast<FPage*>(Chunk + Offset - PageSize));
+				FWriteScopeLock WriteLock(State.ChunkLock);
+				State.Chunks.Add(UPTRINT(Chunk));
+			}
+
+			Page = State.FreePages;
+			UnlinkPage(State.FreePages, Page);
+			const UPTRINT Chunk = ChunkOf(Page);
+			++State.ChunkPages.FindChecked(Chunk);
+			if (State.SpareChunk == Chunk)
+				State.SpareChunk = 0;
+		}
+
+		Page->Arena = Arena;
+		Page->FreeSlots = nullptr;
+		Page->Bump = reinterpret_cast<uint8*>(Page) + HeaderSize;
+		Page->Class = Class;
+		Page->Live = 0;
+		++Arena->NumPages;
+		LinkPage(Arena->Partial[Class], Page);
+		return Page;
+	}
+
+	// the arena lock is held by the caller, returns whether the arena has to be deleted once unlocked
+	static bool ReleasePage(FState& State, FPage* Page)
+	{
+		FArena* Arena = Page->Arena;
+		Page->Arena = nullptr;
+		const bool bDeleteArena = --Arena->NumPages == 0 && Arena->bReleased;
+
+		FScopeLock PoolLock(&State.PoolLock);
+		LinkPage(State.FreePages, Page);
+		const UPTRINT Chunk = ChunkOf(Page);
+		if (--State.ChunkPages.FindChecked(Chunk) > 0)
+			return bDeleteArena;
+
+		// one empty chunk is kept so a single listener bound and unbound in a loop does not hit FMemory
+		if (!State.SpareChunk)
+		{
+			State.SpareChunk = Chunk;
+			return bDeleteArena;
+		}
+		for (SIZE_T Offset = 0; Offset < ChunkSize; Offset += PageSize)
+			UnlinkPage(State.FreePages, reinterpret_cast<FPage*>(Chunk + Offset));
+		State.ChunkPages.Remove(Chunk);
+		{
+			FWriteScopeLock WriteLock(State.ChunkLock);
+			State.Chunks.Remove(Chunk);
+		}
+		State.Reserved.Bytes -= ChunkSize;
+		--State.Reserved.Count;
+		FMemory::Free(reinterpret_cast<void*>(Chunk));
+		return bDeleteArena;
+	}
+
+	void* Malloc(SIZE_T Size)
+	{
+		auto& State = GetState();
+		if (!bUseSlab || Size > MaxSlotSize)
+		{
+			void* Ptr = FMemory::Malloc(Size, SlotAlign);
+			FScopeLock LargeLock(&State.LargeLock);
+			State.LargeSlots.Add(Ptr, Size);
+			State.Large.Add(Size);
+			return Ptr;
+		}
+
+		const int32 Class = State.SizeToClass[(Size + SlotAlign - 1) / SlotAlign];
+		FArena* Arena = CurrentArena ? CurrentArena : &State.Shared[FPlatformTLS::GetCurrentThreadId() % NumSharedArenas];
+		void* Slot = nullptr;
+		{
+			FScopeLock ArenaLock(&Arena->Lock);
+			FPage* Page = Arena->Partial[Class];
+			if (!Page)
+				Page = AcquirePage(State, Arena, Class);
+
+			Slot = Page->FreeSlots;
+			if (Slot)
+			{
+				Page->FreeSlots = *static_cast<void**>(Slot);
+			}
+			else
+			{
+				Slot = Page->Bump;
+				Page->Bump += ClassSizes[Class];
+			}
+			++Page->Live;
+			if (IsFull(Page))
+				UnlinkPage(Arena->Partial[Class], Page);
+		}
+
+		State.UsedBytes.fetch_add(ClassSizes[Class], std::memory_order_relaxed);
+		State.UsedCount.fetch_add(1, std::memory_order_relaxed);
+		return Slot;
+	}
+
+	void Free(void* Ptr)
+	{
+		if (!Ptr)
+			return;
+
+		auto& State = GetState();
+		if (!IsSlabSlot(State, Ptr))
+		{
+			{
+				FScopeLock LargeLock(&State.LargeLock);
+				SIZE_T Size = 0;
+				if (ensure(State.LargeSlots.RemoveAndCopyValue(Ptr, Size)))
+				{
+					State.Large.Bytes -= Size;
+					--State.Large.Count;
+				}
+			}
+			FMemory::Free(Ptr);
+			return;
+		}
+
+		// the slot keeps its page and the page its arena until this free
+		FPage* Page = PageOf(Ptr);
+		FArena* Arena = Page->Arena;
+		const int32 Class = Page->Class;
+		bool bDeleteArena = false;
+		{
+			FScopeLock ArenaLock(&Arena->Lock);
+			const bool bWasFull = IsFull(Page);
+			*static_cast<void**>(Ptr) = Page->FreeSlots;
+			Page->FreeSlots = Ptr;
+
+			if (--Page->Live == 0)
+			{
+				if (!bWasFull)
+					UnlinkPage(Arena->Partial[Class], Page);
+				bDeleteArena = ReleasePage(State, Page);
+			}
+			else if (bWasFull)
+			{
+				LinkPage(Arena->Partial[Class], Page);
+			}
+		}
+		if (bDeleteArena)
+			delete Arena;
+
+		State.UsedBytes.fetch_sub(ClassSizes[Class], std::memory_order_relaxed);
+		State.UsedCount.fetch_sub(1, std::memory_order_relaxed);
+	}
+
+	SIZE_T GetAllocSize(const void* Ptr)
+	{
+		if (!Ptr)
+			return 0;
+
+		auto& State = GetState();
+		if (IsSlabSlot(State, Ptr))
+			return ClassSizes[PageOf(Ptr)->Class];
+		FScopeLock LargeLock(&State.LargeLock);
+		auto Find = State.LargeSlots.Find(const_cast<void*>(Ptr));
+		return Find ? *Find : 0;
+	}
+
+	FArenaScope::FArenaScope(FArena* InArena)
+		: Prev(CurrentArena)
+	{
+		CurrentArena = InArena;
+	}
+
+	FArenaScope::~FArenaScope()
+	{
+		CurrentArena = Prev;
+	}
+
+	FArena* CreateArena()
+	{
+		return new FArena();
+	}
+
+	void ReleaseArena(FArena* InArena)
+	{
+		if (!InArena)
+			return;
+
+		bool bDeleteArena = false;
+		{
+			FScopeLock ArenaLock(&InArena->Lock);
+			InArena->bReleased = true;
+			bDeleteArena = InArena->NumPages == 0;
+		}
+		if (bDeleteArena)
+			delete InArena;
+	}
+
+	FStats GetStats()
+	{
+		auto& State = GetState();
+		FStats Stats;
+		{
+			FScopeLock PoolLock(&State.PoolLock);
+			Stats.Reserved = State.Reserved;
+		}
+		{
+			FScopeLock LargeLock(&State.LargeLock);
+			Stats.Large = State.Large;
+		}
+		Stats.Used.Bytes = SIZE_T(State.UsedBytes.load(std::memory_order_relaxed));
+		Stats.Used.Count = State.UsedCount.load(std::memory_order_relaxed);
+		return Stats;
+	}
+}  // namespace SigElmAllocator
+}  // namespace GMP
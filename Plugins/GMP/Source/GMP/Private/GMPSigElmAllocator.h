@@ -0,0 +1,39 @@
+//  Copyright GenericMessagePlugin, Inc. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+
+#include "GMPMemoryReport.h"
+#include "GMPSignalsImpl.h"
+
+namespace GMP
+{
+namespace SigElmAllocator
+{
+	// slots allocated inside the scope share the pages of InArena
+	struct FArenaScope
+	{
+		explicit FArenaScope(FArena* InArena);
+		~FArenaScope();
+
+	private:
+		FArena* Prev;
+	};
+
+	// stores below this many slots allocate from the shared arenas, about one page of the common slot sizes
+	static constexpr int32 SharedArenaMaxSlots = 32;
+
+	// slots allocated outside of an arena scope go to the shared arenas
+	FArena* CreateArena();
+	// pages that still hold slots are released with their last slot
+	void ReleaseArena(FArena* InArena);
+
+	struct FStats
+	{
+		FGMPMemoryStat Reserved;  // chunks taken from FMemory
+		FGMPMemoryStat Used;      // slots handed out of the pages
+		FGMPMemoryStat Large;     // slots above the largest size class
+	};
+	FStats GetStats();
+}  // namespace SigElmAllocator
+}  // namespace GMP
@@ -6,7 +6,11 @@
 #include "Engine/GameInstance.h"
 #include "Engine/GameViewportClient.h"
 #include "Engine/World.h"
+#include "GMPMemoryReport.h"
+#include "GMPSigElmAllocator.h"
+#include "Misc/CoreDelegates.h"
 #include "Misc/DelayedAutoRegister.h"
+#include "UObject/UObjectGlobals.h"
 #include "XConsoleManager.h"
 
 #include <algorithm>
@@ -42,6 +46,9 @@ FXConsoleCommandLambda CVar_GMPDebugMsgKey(TEXT("gmp.msgkey.debug"), [](FName In
 #endif
 static bool bShouldClearWorldSubOjbects = true;
 FAutoConsoleVariableRef CVar_ShouldClearWorldSubOjbects(TEXT("gmp.flag.clearWorldSubs"), bShouldClearWorldSubOjbects, TEXT(""));
+static bool bBatchObjectRemoval = true;
+FAutoConsoleVariableRef CVar_BatchObjectRemoval(TEXT("gmp.flag.batchRemoval"), bBatchObjectRemoval, TEXT("sweep listeners of objects destroyed by gc once per store instead of once per object"));
+static int32 GMPBatchRemovalScopes = 0;
 static void GMPDebug(FName MessageKey, GMP::FSigElm* Elm, const TCHAR* Desc)
 {
 #if !UE_BUILD_SHIPPING
@@ -106,12 +113,50 @@ static FCriticalSection* GetGMPCritical()
 #define GMP_VERIFY_GAME_THREAD() GMP_CHECK(IsInGameThread())
 static TSet<TUniquePtr<FSigElm>, FSigElm::FKeyFuncs> GlobalSigElmSet;
 
+#ifndef GMP_SIGNAL_SHARD_BITS
+#define GMP_SIGNAL_SHARD_BITS 4
+#endif
+static constexpr uint32 NumSignalShards = 1u << GMP_SIGNAL_SHARD_BITS;
+
+using FSigStoreSet = TSet<TWeakPtr<FSignalStore, FSignalBase::SPMode>>;
+// global registries split so that unrelated message keys and sources never share a lock
+// stores and slots go by message key, source mappings by source
+struct FSignalShard
+{
+	FCriticalSection Lock;
+	TArray<FSignalStore*> SignalStores;
+	TMap<FSigSource, FSigStoreSet> MessageMappings;
+#if GMP_SIGNAL_WITH_GLOBAL_SIGELMSET
+	// game thread only like every slot container
+	TSet<TUniquePtr<FSigElm>, FSigElm::FKeyFuncs> SigElmSet;
+#endif
+};
+
+static FSignalShard* GetSignalShards()
+{
+	// never destroyed, stores may outlive static teardown
+	static FSignalShard* Shards = new FSignalShard[NumSignalShards];
+	return Shards;
+}
+FORCEINLINE static uint32 GetShardIndex(uint32 Hash)
+{
+	return GMP_SIGNAL_SHARD_BITS > 0 ? (Hash * 0x9E3779B1u) >> (32 - GMP_SIGNAL_SHARD_BITS) : 0;
+}
+static FSignalShard& GetKeyShard(FName MessageKey)
+{
+	return GetSignalShards()[GetShardIndex(GetTypeHash(MessageKey))];
+}
+static FSignalShard& GetSourceShard(FSigSource InSigSrc)
+{
+	return GetSignalShards()[GetShardIndex(GetTypeHash(InSigSrc))];
+}
+
 struct FSignalUtils
 {
 	static auto& GetSigElmSet(const FSignalStore* In)
 	{
 #if GMP_SIGNAL_WITH_GLOBAL_SIGELMSET
-		return GlobalSigElmSet;
+		return In ? GetKeyShard(In->MessageKey).SigElmSet : GlobalSigElmSet;
 #else
 		return In ? In->SigElmSet : GlobalSigElmSet;
 #endif
@@ -133,10 +178,17 @@ struct FSignalUtils
 	static TArray<FGMPKey> GetSigElmSetKeys(const FSignalStore* In)
 	{
 		TArray<FGMPKey> Keys;
+#if GMP_SIGNAL_WITH_GLOBAL_SIGELMSET
+		// the shard set is shared with other keys, every slot of this store is in one source bucket
+		for (auto& Pair : In->SourceObjs)
+			Keys.Append(Pair.Value.Array());
+		Keys.Sort();
+#else
 		for (auto& Elem : GetSigElmSet(In))
 		{
 			Keys.Add(Elem->GetGMPKey());
 		}
+#endif
 		return Keys;
 	}
 
@@ -167,6 +219,13 @@ struct FSignalUtils
 		return ResultKeys;
 	}
 
+	static UWorld* GetClearedWorld(const UObject* Obj)
+	{
+		if (bShouldClearWorldSubOjbects && Obj && (!Obj->IsA<UGameInstance>() && !Obj->IsA<UGameViewportClient>()))
+			return Obj->GetWorld();
+		return nullptr;
+	}
+
 	static void StaticOnObjectRemoved(FSignalStore* In, FSigSource InSigSrc)
 	{
 		GMP_VERIFY_GAME_THREAD();
@@ -180,9 +239,8 @@ struct FSignalUtils
 
 		static FSignalStore::FSigElmKeySet Dummy;
 		FSignalStore::FSigElmKeySet* Handlers = &Dummy;
-		if (bool bShouldIncludeWorld = bShouldClearWorldSubOjbects && Obj && (!Obj->IsA<UGameInstance>() && !Obj->IsA<UGameViewportClient>()))
+		if (UWorld* ObjWorld = GetClearedWorld(Obj))
 		{
-			auto ObjWorld = bShouldIncludeWorld ? Obj->GetWorld() : (UWorld*)nullptr;
 			if (auto Find = In->SourceObjs.Find(ObjWorld))
 				Handlers = Find;
 		}
@@ -236,6 +294,84 @@ struct FSignalUtils
 #endif
 	}
 
+	// gc pass variant of StaticOnObjectRemoved, returns true when the store has to be queued for a sweep
+	static bool DeferOnObjectRemoved(FSignalStore* In, FSigSource InSigSrc)
+	{
+		GMP_VERIFY_GAME_THREAD();
+		GMPDebug(In->MessageKey, nullptr, TEXT("DeferOnObjectRemoved"));
+
+		// the address may be reused before the sweep, so the source bucket goes right away
+		FSignalStore::FSigElmKeySet SigKeys;
+		In->SourceObjs.RemoveAndCopyValue(InSigSrc, SigKeys);
+
+		auto& StorageRef = FSignalUtils::GetSigElmSet(In);
+		for (auto SigKey : SigKeys)
+		{
+			// never fires again, even through the world bucket or a broadcast
+			if (auto Find = StorageRef.Find(SigKey))
+				(*Find)->SetLeftTimes(0);
+			In->PendingRemovals.Add(SigKey);
+		}
+
+		if (UWorld* ObjWorld = GetClearedWorld(InSigSrc.TryGetUObject()))
+			In->PendingWorlds.AddUnique(ObjWorld);
+
+		const bool bQueue = !In->bSweepPending;
+		In->bSweepPending = true;
+		return bQueue;
+	}
+
+	// one stale handler pass and one compaction for every source destroyed since the last sweep
+	static bool StaticOnObjectsRemoved(FSignalStore* In)
+	{
+		GMP_VERIFY_GAME_THREAD();
+		if (!In->bSweepPending)
+			return true;
+		if (In->IsFiring())
+			return false;
+
+		GMPDebug(In->MessageKey, nullptr, TEXT("StaticOnObjectsRemoved"));
+		In->bSweepPending = false;
+
+		FSignalStore::FSigElmKeySet SigKeys;
+		SigKeys.Append(In->PendingRemovals);
+		In->PendingRemovals.Empty();
+		auto Worlds = MoveTemp(In->PendingWorlds);
+
+		auto& StorageRef = FSignalUtils::GetSigElmSet(In);
+		if (StorageRef.Num() > 0)
+		{
+			for (auto SigKey : RemoveAndCopyInvalidHandlerObjs(In, SigKeys))
+			{
+				for (auto World : Worlds)
+				{
+					if (auto Handlers = In->SourceObjs.Find(World))
+						Handlers->Remove(SigKey);
+				}
+#if !GMP_DEBUG_SIGNAL
+				StorageRef.Remove(SigKey);
+#else
+				FSignalUtils::RemoveOp(In, SigKey, [&](FSigElm* Elm) {
+					auto SigSrc = Elm->GetSource();
+					if (FSignalStore::FSigElmKeySet* KeySet = In->SourceObjs.Find(SigSrc))
+					{
+						KeySet->Remove(SigKey);
+						if (!KeySet->Num())
+						{
+							In->SourceObjs.Remove(SigSrc);
+						}
+					}
+				});
+#endif
+			}
+		}
+
+		In->SourceObjs.Compact();
+		In->HandlerObjs.Compact();
+		StorageRef.Compact();
+		return true;
+	}
+
 	template<bool bAllowDuplicate>
 	static void RemoveSigElmImpl(FSignalStore* In, FSigElm* SigElm)
 	{
@@ -280,7 +416,12 @@ struct FSignalUtils
 #if GMP_SIGNAL_WITH_GLOBAL_SIGELMSET
 		if (!In)
 		{
-			FSignalUtils::RemoveOp(In, Key, [](FSigElm* SigElm) {});
+			// connections do not keep their store, the slot is in one of the shards
+			for (uint32 Idx = 0; Idx < NumSignalShards; ++Idx)
+			{
+				if (GetSignalShards()[Idx].SigElmSet.Remove(Key))
+					break;
+			}
 			return;
 		}
 #endif
@@ -388,14 +529,23 @@ public:
 	}
 
 	virtual void NotifyUObjectDeleted(const UObjectBase* ObjectBase, int32 Index) override { RouterObjectRemoved(FSigSource::RawSigSource(ObjectBase)); }
-	using FSigStoreSet = TSet<TWeakPtr<FSignalStore, FSignalBase::SPMode>>;
 	void OnUObjectArrayShutdown()
 	{
 		GMP_THREAD_LOCK();
-		MessageMappings.Reset();
-		for (auto Ptr : SignalStores)
+		PendingStores.Reset();
+		// a store destroyed by another's reset removes itself from its shard, the stores are held while resetting
+		TArray<TSharedRef<FSignalStore, FSignalBase::SPMode>> Stores;
+		for (uint32 Idx = 0; Idx < NumSignalShards; ++Idx)
 		{
-			FSignalUtils::ShutdownSignal(Ptr);
+			auto& Shard = GetSignalShards()[Idx];
+			FScopeLock ShardLock(&Shard.Lock);
+			Shard.MessageMappings.Reset();
+			for (auto Ptr : Shard.SignalStores)
+				Stores.Add(Ptr->AsShared());
+		}
+		for (auto& Store : Stores)
+		{
+			FSignalUtils::ShutdownSignal(&Store.Get());
 		}
 	}
 
@@ -412,14 +562,27 @@ public:
 			GMP_THREAD_LOCK();
 			GMPSigIncs.Remove(InSigSrc);
 #endif
+			// objects purged by gc come in bursts, their stores are swept once the pass is over
+			const bool bBatch = bBatchObjectRemoval && (GMPBatchRemovalScopes > 0 || IsGarbageCollecting() || IsIncrementalPurgePending());
 			auto RemoveObject = [&](FSigSource InObj) {
 				FSigStoreSet RemovedStores;
-				if (MessageMappings.RemoveAndCopyValue(InObj, RemovedStores))
+				bool bMapped = false;
+				{
+					auto& Shard = GetSourceShard(InObj);
+					FScopeLock ShardLock(&Shard.Lock);
+					bMapped = Shard.MessageMappings.RemoveAndCopyValue(InObj, RemovedStores);
+				}
+				if (bMapped)
 				{
 					for (auto It = RemovedStores.CreateIterator(); It; ++It)
 					{
 						if (auto Pin = It->Pin())
-							FSignalUtils::StaticOnObjectRemoved(Pin.Get(), InObj);
+						{
+							if (!bBatch)
+								FSignalUtils::StaticOnObjectRemoved(Pin.Get(), InObj);
+							else if (FSignalUtils::DeferOnObjectRemoved(Pin.Get(), InObj))
+								PendingStores.Add(*It);
+						}
 					}
 				}
 				ObjNameMappings.Remove(InObj);
@@ -438,8 +601,29 @@ public:
 		}
 	}
 
-	TArray<FSignalStore*, TInlineAllocator<32>> SignalStores;
-	TMap<FSigSource, FSigStoreSet> MessageMappings;
+	int32 FlushPendingRemovals()
+	{
+		GMP_VERIFY_GAME_THREAD();
+		if (PendingStores.Num() == 0)
+			return 0;
+
+		auto Stores = MoveTemp(PendingStores);
+		for (auto& Weak : Stores)
+		{
+			auto Pin = Weak.Pin();
+			// a firing store is retried at the next flush, its pending slots are already muted
+			if (Pin && !FSignalUtils::StaticOnObjectsRemoved(Pin.Get()))
+				PendingStores.Add(Weak);
+		}
+		return PendingStores.Num();
+	}
+	static void OnFlushPendingRemovals()
+	{
+		if (auto Deleter = TryGet(false))
+			Deleter->FlushPendingRemovals();
+	}
+
+	TArray<TWeakPtr<FSignalStore, FSignalBase::SPMode>> PendingStores;
 
 	TMap<FSigSource, std::set<FName, FNameFastLess>> ObjNameMappings;
 
@@ -511,7 +695,11 @@ public:
 	static void AddMessageMapping(FSigSource InSigSrc, FSignalStore* InPtr)
 	{
 		if (InSigSrc.IsValid())
-			TryGet()->MessageMappings.FindOrAdd(InSigSrc).Add(InPtr->AsShared());
+		{
+			auto& Shard = GetSourceShard(InSigSrc);
+			FScopeLock ShardLock(&Shard.Lock);
+			Shard.MessageMappings.FindOrAdd(InSigSrc).Add(InPtr->AsShared());
+		}
 	}
 
 	TLockFreePointerListUnordered<FSigSource, PLATFORM_CACHE_LINE_SIZE> GameThreadObjects;
@@ -532,6 +720,8 @@ void CreateGMPSourceAndHandlerDeleter()
 		});
 #endif
 		FCoreDelegates::OnPreExit.AddStatic(&FGMPSourceAndHandlerDeleter::OnPreExit);
+		FCoreUObjectDelegates::GetPostGarbageCollect().AddStatic(&FGMPSourceAndHandlerDeleter::OnFlushPendingRemovals);
+		FCoreDelegates::OnEndFrame.AddStatic(&FGMPSourceAndHandlerDeleter::OnFlushPendingRemovals);
 	}
 }
 void DestroyGMPSourceAndHandlerDeleter()
@@ -557,21 +747,23 @@ ISigSource::~ISigSource()
 
 FSignalStore::FSignalStore()
 {
-	if (auto Deleter = FGMPSourceAndHandlerDeleter::TryGet())
-		Deleter->SignalStores.Add(this);
 }
 
 FSignalStore::~FSignalStore()
 {
 	GMP_VERIFY_GAME_THREAD();
-	if (auto Deleter = FGMPSourceAndHandlerDeleter::TryGet(false))
-		Deleter->SignalStores.RemoveSwap(this);
+	{
+		auto& Shard = GetKeyShard(MessageKey);
+		FScopeLock ShardLock(&Shard.Lock);
+		Shard.SignalStores.RemoveSwap(this);
+	}
 	Reset();
+	SigElmAllocator::ReleaseArena(Arena);
 }
 
 void FSignalStore::Reset()
 {
-#if !GMP_SIGNAL_WITH_GLOBAL_SIGELMSET
+	// the slot set may be shared with other keys, only the slots of this store are removed
 	FSigElmKeySet TobeRemoved;
 	for (auto& Pair : SourceObjs)
 	{
@@ -581,15 +773,16 @@ void FSignalStore::Reset()
 	{
 		TobeRemoved.Append(Pair.Value);
 	}
+	TobeRemoved.Append(PendingRemovals);
 	for (auto& Key : TobeRemoved)
 	{
 		FSignalUtils::GetSigElmSet(this).Remove(Key);
 	}
-#else
-	FSignalUtils::GetSigElmSet(this).Reset();
-#endif
 	SourceObjs.Reset();
 	HandlerObjs.Reset();
+	PendingRemovals.Reset();
+	PendingWorlds.Reset();
+	bSweepPending = false;
 }
 
 FSigSource FSigSource::ObjNameFilter(const UObject* InObj, FName InName, bool bCreate)
@@ -634,8 +827,14 @@ FSigSource::AddrType FSigSource::ObjectToAddr(const UObject* InObj)
 
 TSharedRef<FSignalStore, FSignalBase::SPMode> FSignalImpl::MakeSignals(FName MessageKey)
 {
+	GMP_LLM_SCOPE();
 	auto SignalImpl = MakeShared<FSignalStore, FSignalBase::SPMode>();
 	SignalImpl->MessageKey = MessageKey;
+	{
+		auto& Shard = GetKeyShard(MessageKey);
+		FScopeLock ShardLock(&Shard.Lock);
+		Shard.SignalStores.Add(&SignalImpl.Get());
+	}
 	return SignalImpl;
 }
 struct FConnectionImpl : public FSigCollection::FConnection
@@ -744,7 +943,7 @@ template GMP_API void FSignalImpl::DisconnectExactly<true>(const UObject* Listen
 template GMP_API void FSignalImpl::DisconnectExactly<false>(const UObject* Listener, FSigSource InSigSrc);
 
 template<bool bAllowDuplicate>
-void FSignalImpl::OnFire(const TGMPFunctionRef<void(FSigElm*)>& Invoker) const
+void FSignalImpl::OnFire(const TGMPFunctionRef<void(FSigElm*)>& Invoker, const bool* ConsumedFlag) const
 {
 	GMP_VERIFY_GAME_THREAD();
 	GMP_CNOTE_ONCE(Store.IsUnique(), TEXT("maybe unsafe, should avoid reentry."));
@@ -766,6 +965,9 @@ void FSignalImpl::OnFire(const TGMPFunctionRef<void(FSigElm*)>& Invoker) const
 			continue;
 		}
 
+		if (Elem->ShouldSkipConsumed(ConsumedFlag))
+			continue;
+
 		if (!Elem->TestInvokable([&] { Invoker(Elem); }))
 		{
 			EraseIDs.Add(Key);
@@ -780,11 +982,11 @@ void FSignalImpl::OnFire(const TGMPFunctionRef<void(FSigElm*)>& Invoker) const
 		FSignalUtils::DisconnectHandlerByID<bAllowDuplicate>(&StoreRef, Key);
 	}
 }
-template GMP_API void FSignalImpl::OnFire<true>(const TGMPFunctionRef<void(FSigElm*)>& Invoker) const;
-template GMP_API void FSignalImpl::OnFire<false>(const TGMPFunctionRef<void(FSigElm*)>& Invoker) const;
+template GMP_API void FSignalImpl::OnFire<true>(const TGMPFunctionRef<void(FSigElm*)>& Invoker, const bool* ConsumedFlag) const;
+template GMP_API void FSignalImpl::OnFire<false>(const TGMPFunctionRef<void(FSigElm*)>& Invoker, const bool* ConsumedFlag) const;
 
 template<bool bAllowDuplicate>
-FSignalImpl::FOnFireResults FSignalImpl::OnFireWithSigSource(FSigSource InSigSrc, const TGMPFunctionRef<void(FSigElm*)>& Invoker) const
+FSignalImpl::FOnFireResults FSignalImpl::OnFireWithSigSource(FSigSource InSigSrc, const TGMPFunctionRef<void(FSigElm*)>& Invoker, const bool* ConsumedFlag) const
 {
 	GMP_VERIFY_GAME_THREAD();
 
@@ -803,6 +1005,9 @@ FSignalImpl::FOnFireResults FSignalImpl::OnFireWithSigSource(FSigSource InSigSrc
 			continue;
 		}
 
+		if (Elem->ShouldSkipConsumed(ConsumedFlag))
+			continue;
+
 #if GMP_DEBUG_SIGNAL
 		auto Listener = Elem->GetHandler();
 		if (!Listener.IsStale())
@@ -834,8 +1039,8 @@ FSignalImpl::FOnFireResults FSignalImpl::OnFireWithSigSource(FSigSource InSigSrc
 #endif
 }
 
-template GMP_API FSignalImpl::FOnFireResults FSignalImpl::OnFireWithSigSource<true>(FSigSource InSigSrc, const TGMPFunctionRef<void(FSigElm*)>& Invoker) const;
-template GMP_API FSignalImpl::FOnFireResults FSignalImpl::OnFireWithSigSource<false>(FSigSource InSigSrc, const TGMPFunctionRef<void(FSigElm*)>& Invoker) const;
+template GMP_API FSignalImpl::FOnFireResults FSignalImpl::OnFireWithSigSource<true>(FSigSource InSigSrc, const TGMPFunctionRef<void(FSigElm*)>& Invoker, const bool* ConsumedFlag) const;
+template GMP_API FSignalImpl::FOnFireResults FSignalImpl::OnFireWithSigSource<false>(FSigSource InSigSrc, const TGMPFunctionRef<void(FSigElm*)>& Invoker, const bool* ConsumedFlag) const;
 
 FSigSource FSigSource::NullSigSrc = FSigSource(nullptr);
 struct FAnySigSrcType
@@ -853,6 +1058,25 @@ void FSigSource::RemoveSource(FSigSource InSigSrc)
 		Deleter->RouterObjectRemoved(InSigSrc);
 }
 
+FSigSource::FBatchRemovalScope::FBatchRemovalScope()
+{
+	GMP_VERIFY_GAME_THREAD();
+	++GMPBatchRemovalScopes;
+}
+
+FSigSource::FBatchRemovalScope::~FBatchRemovalScope()
+{
+	GMP_VERIFY_GAME_THREAD();
+	--GMPBatchRemovalScopes;
+}
+
+int32 FSigSource::FlushRemovedSources()
+{
+	if (auto Deleter = FGMPSourceAndHandlerDeleter::TryGet(true))
+		return Deleter->FlushPendingRemovals();
+	return 0;
+}
+
 FSigElm* FSignalStore::FindSigElm(FGMPKey Key) const
 {
 	GMP_VERIFY_GAME_THREAD();
@@ -908,7 +1132,7 @@ bool FSignalStore::IsAlive(const UObject* InHandler, FSigSource InSigSrc) const
 		for (auto It = KeysFind->CreateIterator(); It; ++It)
 		{
 			auto SigElm = FindSigElm(*It);
-			if (SigElm && (!InSigSrc || SigElm->Source == InSigSrc))
+			if (SigElm && SigElm->HasLeftTimes() && (!InSigSrc || SigElm->Source == InSigSrc))
 				return true;
 		}
 	}
@@ -941,9 +1165,20 @@ void FSignalStore::RemoveSigElmStorage(FGMPKey SigKey)
 
 FSigElm* FSignalStore::AddSigElmImpl(FGMPKey Key, const UObject* InListener, FSigSource InSigSrc, const TGMPFunctionRef<FSigElm*()>& Ctor)
 {
+	GMP_LLM_SCOPE();
 	FSigElm* SigElm = FindSigElm(Key);
 	if (!SigElm)
 	{
+		// a page per size class is only worth it once the store holds about a page of slots
+		if (!Arena)
+		{
+			int32 NumSlots = 0;
+			for (auto& Pair : SourceObjs)
+				NumSlots += Pair.Value.Num();
+			if (NumSlots >= SigElmAllocator::SharedArenaMaxSlots)
+				Arena = SigElmAllocator::CreateArena();
+		}
+		SigElmAllocator::FArenaScope ArenaScope(Arena);
 		SigElm = Ctor();
 		GMP_CHECK(SigElm);
 		FSignalUtils::GetSigElmSet(this).Emplace(SigElm);
@@ -980,10 +1215,73 @@ FSigElm* FSignalStore::AddSigElmImpl(FGMPKey Key, const UObject* InListener, FSi
 	return SigElm;
 }
 
+void FSignalStore::CollectMemory(FGMPMemoryReport& Report) const
+{
+	GMP_VERIFY_GAME_THREAD();
+	SIZE_T ContainerBytes = sizeof(FSignalStore) + SourceObjs.GetAllocatedSize() + HandlerObjs.GetAllocatedSize() + PendingRemovals.GetAllocatedSize();
+	for (auto& Pair : SourceObjs)
+		ContainerBytes += Pair.Value.GetAllocatedSize();
+	for (auto& Pair : HandlerObjs)
+		ContainerBytes += Pair.Value.GetAllocatedSize();
+#if !GMP_SIGNAL_WITH_GLOBAL_SIGELMSET
+	ContainerBytes += SigElmSet.GetAllocatedSize();
+#endif
+	Report.MessageKeys.FindOrAdd(MessageKey).Add(ContainerBytes, 0);
+
+	// every slot is indexed by exactly one source bucket
+	for (auto& Pair : SourceObjs)
+	{
+		for (auto SigKey : Pair.Value)
+		{
+			if (auto SigElm = FindSigElm(SigKey))
+			{
+				SIZE_T ElmBytes = SigElmAllocator::GetAllocSize(SigElm);
+				ElmBytes = (ElmBytes ? ElmBytes : sizeof(FSigElm)) + SigElm->GetHeapAllocatedSize();
+				Report.AddListener(MessageKey, SigElm->GetHandler(), Pair.Key, ElmBytes);
+			}
+		}
+	}
+}
+
+void FSignalStore::CollectSharedMemory(FGMPMemoryReport& Report)
+{
+	GMP_VERIFY_GAME_THREAD();
+	Report.SharedBytes += GlobalSigElmSet.GetAllocatedSize();
+
+	// slot bytes are attributed per listener, only the unused part of the pages is shared
+	const auto SlabStats = SigElmAllocator::GetStats();
+	Report.Slab = SlabStats.Reserved;
+	Report.SlabSlots = SlabStats.Used;
+	Report.LargeSlots = SlabStats.Large;
+	Report.SharedBytes += SlabStats.Reserved.Bytes - FMath::Min(SlabStats.Reserved.Bytes, SlabStats.Used.Bytes);
+	for (uint32 Idx = 0; Idx < NumSignalShards; ++Idx)
+	{
+		auto& Shard = GetSignalShards()[Idx];
+		FScopeLock ShardLock(&Shard.Lock);
+		Report.SharedBytes += sizeof(FSignalShard) + Shard.SignalStores.GetAllocatedSize() + Shard.MessageMappings.GetAllocatedSize();
+#if GMP_SIGNAL_WITH_GLOBAL_SIGELMSET
+		Report.SharedBytes += Shard.SigElmSet.GetAllocatedSize();
+#endif
+		for (auto& Pair : Shard.MessageMappings)
+		{
+			const SIZE_T Bytes = Pair.Value.GetAllocatedSize();
+			Report.SharedBytes += Bytes;
+			Report.Sources.FindOrAdd(Pair.Key).Add(Bytes, 0);
+		}
+	}
+	if (auto Deleter = FGMPSourceAndHandlerDeleter::TryGet(false))
+	{
+		Report.SharedBytes += Deleter->ObjNameMappings.GetAllocatedSize();
+		// std::set nodes are not tracked, estimate one tree node per name
+		for (auto& Pair : Deleter->ObjNameMappings)
+			Report.SharedBytes += Pair.Value.size() * (sizeof(FName) + 4 * sizeof(void*));
+	}
+}
+
 bool FSignalStore::IsAlive(FGMPKey Key) const
 {
 	FSigElm* SigElm = FindSigElm(Key);
-	return SigElm && !SigElm->GetHandler().IsStale();
+	return SigElm && SigElm->HasLeftTimes() && !SigElm->GetHandler().IsStale();
 }
 
 void FSigCollection::DisconnectAll()
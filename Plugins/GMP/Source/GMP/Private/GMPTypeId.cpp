@@ -0,0 +1,129 @@
+//  Copyright GenericMessagePlugin, Inc. All Rights Reserved.
+
+#include "GMPTypeId.h"
+
+#include "GMPMacros.h"
+#include "Misc/ScopeRWLock.h"
+
+namespace GMP
+{
+namespace TypeId
+{
+	namespace Internal
+	{
+		using FTypeId = uint32;
+		constexpr FTypeId InvalidId = 0;
+
+		struct FTypeKey
+		{
+			FTypeId Inner[2];
+			EKind Kind;
+
+			friend bool operator==(const FTypeKey& Lhs, const FTypeKey& Rhs) { return Lhs.Kind == Rhs.Kind && Lhs.Inner[0] == Rhs.Inner[0] && Lhs.Inner[1] == Rhs.Inner[1]; }
+			friend uint32 GetTypeHash(const FTypeKey& In) { return HashCombine(HashCombine(GetTypeHash((uint8)In.Kind), GetTypeHash(In.Inner[0])), GetTypeHash(In.Inner[1])); }
+		};
+
+		struct FTypeTable
+		{
+			FRWLock Lock;
+			// FName of every id
+			TArray<FName> Names;
+			TMap<FName, FTypeId> NameToId;
+			TMap<FTypeKey, FTypeId> KeyToId;
+
+			FTypeTable()
+			{
+				// InvalidId
+				Names.Add(NAME_None);
+			}
+
+			static FName Render(EKind Kind, FName Inner, FName Inner2)
+			{
+				switch (Kind)
+				{
+					case EKind::Array:
+						return *FString::Printf(TEXT("TArray<%s>"), *Inner.ToString());
+					case EKind::Set:
+						return *FString::Printf(TEXT("TSet<%s>"), *Inner.ToString());
+					case EKind::Map:
+						return *FString::Printf(TEXT("TMap<%s,%s>"), *Inner.ToString(), *Inner2.ToString());
+					case EKind::Optional:
+						return *FString::Printf(TEXT("TOptional<%s>"), *Inner.ToString());
+					case EKind::SubclassOf:
+						return *FString::Printf(TEXT("TSubClassOf<%s>"), *Inner.ToString());
+					case EKind::ObjectPtr:
+						return *FString::Printf(NAME_GMP_TObjectPtr TEXT("<%s>"), *Inner.ToString());
+					default:
+						return Inner;
+				}
+			}
+
+			FTypeId FindName(FName Name) const
+			{
+				auto Find = NameToId.Find(Name);
+				return Find ? *Find : InvalidId;
+			}
+			FTypeId FindKey(const FTypeKey& Key) const
+			{
+				auto Find = KeyToId.Find(Key);
+				return Find ? *Find : InvalidId;
+			}
+
+			FTypeId AddName(FName Name)
+			{
+				if (auto Find = NameToId.Find(Name))
+					return *Find;
+				const FTypeId Id = Names.Add(Name);
+				NameToId.Add(Name, Id);
+				return Id;
+			}
+
+			FTypeId AddKey(const FTypeKey& Key)
+			{
+				if (auto Find = KeyToId.Find(Key))
+					return *Find;
+
+				// formatted once per tuple
+				const FName Name = Render(Key.Kind, Names[Key.Inner[0]], Names[Key.Inner[1]]);
+
+				// a spelling seen before as an inner name shares its id
+				const FTypeId Id = AddName(Name);
+				KeyToId.Add(Key, Id);
+				return Id;
+			}
+
+			static FTypeKey MakeKey(EKind Kind, FTypeId Inner, FTypeId Inner2) { return FTypeKey{{Inner, Kind == EKind::Map ? Inner2 : InvalidId}, Kind}; }
+		};
+
+		static FTypeTable& GetTable()
+		{
+			static FTypeTable Table;
+			return Table;
+		}
+	}  // namespace Internal
+
+	FName ComposeName(EKind Kind, FName Inner, FName Inner2)
+	{
+		if (Kind == EKind::Name)
+			return Inner;
+
+		using namespace Internal;
+		auto& Table = GetTable();
+		{
+			FReadScopeLock ReadLock(Table.Lock);
+			const FTypeId InnerId = Table.FindName(Inner);
+			const FTypeId Inner2Id = Kind == EKind::Map ? Table.FindName(Inner2) : InvalidId;
+			if (InnerId && (Inner2Id || Kind != EKind::Map))
+			{
+				if (auto Id = Table.FindKey(FTypeTable::MakeKey(Kind, InnerId, Inner2Id)))
+					return Table.Names[Id];
+			}
+		}
+
+		FWriteScopeLock WriteLock(Table.Lock);
+		const FTypeId InnerId = Table.AddName(Inner);
+		const FTypeId Inner2Id = Kind == EKind::Map ? Table.AddName(Inner2) : InvalidId;
+		return Table.Names[Table.AddKey(FTypeTable::MakeKey(Kind, InnerId, Inner2Id))];
+	}
+}  // namespace TypeId
+}  // namespace GMP
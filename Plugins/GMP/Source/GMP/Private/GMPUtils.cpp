@@ -3,19 +3,27 @@
 #include "GMPUtils.h"
 
 #include "Engine/LatentActionManager.h"
+#include "Engine/World.h"
+#include "GMPCoalesceInternal.h"
+#include "GMPWorldLocals.h"
+#include "HAL/IConsoleManager.h"
 #include "Modules/ModuleManager.h"
 
 namespace GMP
 {
 extern bool IsGMPModuleInited();
 
+bool FMessageUtils::bPerWorldHub = false;
+// listeners stay on the hub they were bound to, so this is only taken from ini or the command line
+static FAutoConsoleVariableRef CVar_PerWorldHub(TEXT("gmp.hub.perworld"), FMessageUtils::bPerWorldHub, TEXT("give each game world its own message hub, messages without a world source stay on the global hub"), ECVF_ReadOnly);
+
 void FMessageUtils::UnbindMessage(const FMSGKEYFind& MessageId, const UObject* Obj)
 {
 #if !UE_BUILD_SHIPPING && !UE_BUILD_TEST
 	if (IsGMPModuleInited() && ensure(Obj))
 #endif
 	{
-		GetMessageHub()->UnbindMessage(MessageId, Obj);
+		ForEachHub([&](FMessageHub& Hub) { Hub.UnbindMessage(MessageId, Obj); });
 	}
 }
 
@@ -25,7 +33,7 @@ void FMessageUtils::UnbindMessage(const FMSGKEYFind& MessageId, FGMPKey GMPKey)
 	if (IsGMPModuleInited() && ensure(GMPKey))
 #endif
 	{
-		GetMessageHub()->UnbindMessage(MessageId, GMPKey);
+		ForEachHub([&](FMessageHub& Hub) { Hub.UnbindMessage(MessageId, GMPKey); });
 	}
 }
 
@@ -35,7 +43,7 @@ void FMessageUtils::ScriptUnbindMessage(const FMSGKEYAny& K, FGMPKey InKey)
 	if (ensure(IsGMPModuleInited()))
 #endif
 	{
-		GetMessageHub()->ScriptUnbindMessage(FMSGKEYFind(K), InKey);
+		ForEachHub([&](FMessageHub& Hub) { Hub.ScriptUnbindMessage(FMSGKEYFind(K), InKey); });
 	}
 }
 
@@ -45,7 +53,7 @@ void FMessageUtils::ScriptUnbindMessage(const FMSGKEYAny& K, const UObject* List
 	if (ensure(IsGMPModuleInited()))
 #endif
 	{
-		GetMessageHub()->ScriptUnbindMessage(FMSGKEYFind(K), Listener);
+		ForEachHub([&](FMessageHub& Hub) { Hub.ScriptUnbindMessage(FMSGKEYFind(K), Listener); });
 	}
 }
 
@@ -61,7 +69,8 @@ void FMessageUtils::ScriptRemoveSigSource(const FSigSource InSigSrc)
 
 FMessageBody* FMessageUtils::GetCurrentMessageBody()
 {
-	return GetMessageHub()->GetCurrentMessageBody();
+	auto Hub = FMessageHub::GetDispatchingHub();
+	return (Hub ? Hub : GetMessageHub())->GetCurrentMessageBody();
 }
 
 UGMPManager* FMessageUtils::GetManager()
@@ -76,6 +85,54 @@ FMessageHub* FMessageUtils::GetMessageHub()
 	return &GetManager()->GetHub();
 }
 
+static auto& GetWorldHubs()
+{
+	return WorldLocals::TInlineOps<UWorld>::GetStorage<FMessageHub>();
+}
+
+FMessageHub* FMessageUtils::GetWorldHubImpl(const UWorld* InWorld)
+{
+	if (!InWorld || !InWorld->IsGameWorld())
+		return GetMessageHub();
+
+	// a world past its teardown gets no new hub, listeners bound now would outlive the world cleanup
+	if (InWorld->bIsTearingDown || IsGarbageCollecting())
+	{
+		auto Hub = WorldLocals::Find(const_cast<UWorld*>(InWorld), GetWorldHubs());
+		return Hub ? Hub : GetMessageHub();
+	}
+	// released with the world on OnWorldBeginTearDown, which drops all its listeners at once
+	return WorldLocalObject<FMessageHub>(InWorld, [] {
+		auto Hub = MakeShared<FMessageHub>();
+		auto GlobalHub = GetMessageHub();
+		Hub->AnySourceHub = GlobalHub;
+		if (GlobalHub->CoalescedChannels)
+			Hub->GetCoalescedChannels().Inherit(*GlobalHub->CoalescedChannels);
+		return Hub;
+	});
+}
+
+FMessageHub* FMessageUtils::GetSourceHubImpl(FSigSource InSigSrc)
+{
+	// outers rather than GetWorld, game instances and their subsystems outlive the world they report
+	auto Obj = InSigSrc.TryGetUObject();
+	auto World = Cast<UWorld>(Obj);
+	return GetWorldHubImpl(World ? World : (Obj ? Obj->GetTypedOuter<UWorld>() : nullptr));
+}
+
+void FMessageUtils::ForEachHub(TFunctionRef<void(FMessageHub&)> Func)
+{
+	Func(*GetMessageHub());
+	if (!bPerWorldHub)
+		return;
+
+	for (auto& Pair : GetWorldHubs())
+	{
+		if (Pair.Object.IsValid())
+			Func(*Pair.Object);
+	}
+}
+
 struct FLifetimePair
 {
 	using FFunctionArray = TArray<TUniqueFunction<void(IModuleInterface*)>>;
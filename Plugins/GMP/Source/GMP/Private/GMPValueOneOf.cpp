@@ -2,10 +2,75 @@
 
 #include "GMPValueOneOf.h"
 
+#include "GMPJsonLazyDocument.h"
 #include "GMPJsonUtils.h"
 #include "GMPProtoUtils.h"
 #include "GMPJsonSerializer.h"
 #include "GMPProtoSerializer.h"
+#include "Hash/CityHash.h"
+
+bool FGMPValuePath::Compile(const FString& InPath, FString* OutError)
+{
+	Path = InPath;
+	Steps.Reset();
+	PathHash = 0;
+
+	auto Fail = [&](const TCHAR* Reason, int32 Pos) {
+		if (OutError)
+			*OutError = FString::Printf(TEXT("%s at %d in \"%s\""), Reason, Pos, *InPath);
+		Steps.Reset();
+		return false;
+	};
+
+	// lower case canonical form, a.b[3].c
+	FString Canonical;
+	const TCHAR* Str = *InPath;
+	const int32 Len = InPath.Len();
+	int32 Pos = 0;
+	while (Pos < Len)
+	{
+		if (Str[Pos] == TEXT('['))
+		{
+			const int32 Begin = ++Pos;
+			int64 Index = 0;
+			while (Pos < Len && FChar::IsDigit(Str[Pos]) && Index <= MAX_int32)
+				Index = Index * 10 + (Str[Pos++] - TEXT('0'));
+			if (Pos == Begin || Index > MAX_int32 || Pos >= Len || Str[Pos] != TEXT(']'))
+				return Fail(TEXT("invalid index"), Begin);
+			++Pos;
+			Steps.AddDefaulted_GetRef().Index = int32(Index);
+			Canonical.AppendChar(TEXT('['));
+			Canonical.AppendInt(int32(Index));
+			Canonical.AppendChar(TEXT(']'));
+			continue;
+		}
+
+		if (Steps.Num() > 0)
+		{
+			if (Str[Pos] != TEXT('.'))
+				return Fail(TEXT("expect '.' or '['"), Pos);
+			++Pos;
+		}
+		const int32 Begin = Pos;
+		while (Pos < Len && Str[Pos] != TEXT('.') && Str[Pos] != TEXT('['))
+			++Pos;
+		if (Pos == Begin)
+			return Fail(TEXT("empty key"), Begin);
+
+		auto& Step = Steps.AddDefaulted_GetRef();
+		Step.Key = InPath.Mid(Begin, Pos - Begin);
+		Step.Hash = int32(GMP::Json::Lazy::HashKey(*Step.Key, Step.Key.Len()));
+		for (TCHAR C : Step.Key)
+			Step.bAscii &= uint32(C) < 0x80;
+		Canonical.AppendChar(TEXT('.'));
+		Canonical.Append(Step.Key.ToLower());
+	}
+
+	PathHash = int64(CityHash64(reinterpret_cast<const char*>(*Canonical), Canonical.Len() * sizeof(TCHAR)));
+	// zero means not compiled
+	PathHash = PathHash ? PathHash : 1;
+	return true;
+}
 
 int32 FGMPValueOneOf::IterateKeyValueImpl(int32 Idx, FString& OutKey, FGMPValueOneOf& OutValue, bool bBinary) const
 {
@@ -33,11 +98,15 @@ bool FGMPValueOneOf::LoadFromFile(const FString& FilePath, bool bBinary /*=false
 
 bool FGMPValueOneOf::FromJsonStr(const FStringView& Content)
 {
-	return GMP::Json::UStructFromJson(Content, *this);
+	return GMP::Json::Lazy::FromJson(*this, Content);
+}
+bool FGMPValueOneOf::FromJsonBuf(TArray<uint8> Utf8Content)
+{
+	return GMP::Json::Lazy::FromJson(*this, MoveTemp(Utf8Content));
 }
 bool FGMPValueOneOf::ToJsonStr(FString& Out) const
 {
-	return GMP::Json::UStructToJson(Out, *this);
+	return GMP::Json::Lazy::ToJson(*this, Out) || GMP::Json::UStructToJson(Out, *this);
 }
 
 bool FGMPValueOneOf::AsValueImpl(FProperty* Prop, void* Out, FName SubKey, bool bBinary) const
@@ -52,6 +121,11 @@ bool FGMPValueOneOf::AsValueImpl(FProperty* Prop, void* Out, FName SubKey, bool
 	}
 }
 
+bool FGMPValueOneOf::AsValueImpl(FProperty* Prop, void* Out, const FGMPValuePath& Path) const
+{
+	return UGMPJsonUtils::AsValueImpl(*this, Prop, Out, Path);
+}
+
 bool FGMPValueOneOf::AsValueImpl(FProperty* ResultProp, void* Out, TConstArrayView<FName> SubKeys, bool bBinary) const
 {
 	check(SubKeys.Num());
@@ -61,7 +135,7 @@ bool FGMPValueOneOf::AsValueImpl(FProperty* ResultProp, void* Out, TConstArrayVi
 	{
 		for (auto i = 0; i < SubKeys.Num() - 1; ++i)
 		{
-			if (UGMPJsonUtils::AsValueImpl(Val, OneOfProp, &Val, SubKeys[i]))
+			if (!UGMPJsonUtils::AsValueImpl(Val, OneOfProp, &Val, SubKeys[i]))
 			{
 				return false;
 			}
@@ -72,7 +146,7 @@ bool FGMPValueOneOf::AsValueImpl(FProperty* ResultProp, void* Out, TConstArrayVi
 	{
 		for (auto i = 0; i < SubKeys.Num() - 1; ++i)
 		{
-			if (UGMPProtoUtils::AsValueImpl(Val, OneOfProp, &Val, SubKeys[i]))
+			if (!UGMPProtoUtils::AsValueImpl(Val, OneOfProp, &Val, SubKeys[i]))
 			{
 				return false;
 			}
@@ -5,12 +5,14 @@
 
 #if GMP_EXTEND_CONSOLE
 #include "Engine/Engine.h"
+#include "GMPJsonEscape.h"
 #include "GMPWorldLocals.h"
 #include "HAL/ConsoleManager.h"
 #include "HAL/PlatformProcess.h"
 #include "Misc/AsciiSet.h"
 #include "Misc/ConfigCacheIni.h"
 #include "Misc/CommandLine.h"
+#include "Misc/CoreDelegates.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
 #include "Misc/RemoteConfigIni.h"
@@ -35,8 +37,24 @@ template<typename Builder>
 static Builder& AppendEscapeJsonString(Builder& AppendTo, const FString& StringVal)
 {
 	AppendTo += TEXT("\"");
-	for (const TCHAR* Char = *StringVal; *Char != TCHAR('\0'); ++Char)
+	const TCHAR* Str = *StringVal;
+	const int32 Len = StringVal.Len();
+	for (int32 Idx = 0; Idx < Len; ++Idx)
 	{
+		// copy plain ascii runs in bulk
+		const int32 Cnt = GMP::Json::Escape::CountPlainChars(Str + Idx, Len - Idx);
+		if (Cnt > 0)
+		{
+			AppendTo.AppendChars(Str + Idx, Cnt);
+			Idx += Cnt;
+			if (Idx >= Len)
+				break;
+		}
+
+		const TCHAR* Char = Str + Idx;
+		if (*Char == TCHAR('\0'))
+			break;
+
 		switch (*Char)
 		{
 			case TCHAR('\\'):
@@ -95,10 +113,13 @@ TArray<FXCmdGroup>& GetXCmdGroups(UWorld* InWorld)
 {
 	return *GMP::GameLocalObject<TArray<FXCmdGroup>>(InWorld);
 }
+struct FXCmdBatch;
 struct FXConsoleCmdData
 {
 	int32 PauseCnt = 0;
 	int32 XCmdIndex = 0;
+	// pause and continue go to the running batch instead of the pipeline
+	TSharedPtr<FXCmdBatch> Batch;
 };
 FXConsoleCmdData& GetXCmdData(UWorld* InWorld)
 {
@@ -427,6 +448,10 @@ public:
 #endif  // !NO_CVARS
 
 	bool ProcessUserXCommandInput(FString& Cmd, TArray<FString>& Args, FOutputDevice& Ar, UWorld* InWorld);
+	// nullptr when missing, unregistered or a disabled cheat
+	IConsoleObject* FindXConsoleObject(const TCHAR* Name) const;
+	// precompiled batches call this directly and flush the variable sinks once per frame
+	bool ProcessResolvedXCommand(IConsoleObject* CObj, const FString& Cmd, TArray<FString>& Args, bool bCommandEndedInQuestion, FOutputDevice& Ar, UWorld* InWorld, bool bCallSinks = true);
 	bool IsProcessingCommand() const { return bIsProcessingCommamd; }
 
 private:  // ----------------------------------------------------
@@ -729,20 +754,8 @@ TArray<FString> XSplitCommandLine(const TCHAR*& CmdLine, bool bEnableSingleQuote
 
 bool FConsoleManager::ProcessUserXCommandInput(FString& Cmd, TArray<FString>& Args, FOutputDevice& Ar, UWorld* InWorld)
 {
-#if defined(WITH_EDITOR)
-#define AR_LOGF(Fmt, ...) Ar.Logf(Fmt, ##__VA_ARGS__)
-#else
-#define AR_LOGF(Fmt, ...)
-#endif
 	UE_LOG(LogXConsoleManager, Log, TEXT("ProcessUserXCommandInput Cmd : %s with %d Args"), *Cmd, Args.Num());
 
-	auto Old = bIsProcessingCommamd;
-	bIsProcessingCommamd = true;
-	ON_SCOPE_EXIT
-	{
-		bIsProcessingCommamd = Old;
-	};
-
 	// Remove a trailing ? if present, to kick it into help mode
 	const bool bCommandEndedInQuestion = Cmd.EndsWith(TEXT("?"), ESearchCase::CaseSensitive);
 	if (bCommandEndedInQuestion)
@@ -750,23 +763,50 @@ bool FConsoleManager::ProcessUserXCommandInput(FString& Cmd, TArray<FString>& Ar
 		Cmd.MidInline(0, Cmd.Len() - 1, EAllowShrinking::No);
 	}
 
-	IConsoleObject* CObj = FindConsoleObject(*Cmd);
+	IConsoleObject* CObj = FindXConsoleObject(*Cmd);
 	if (!CObj)
 	{
 		return false;
 	}
 
+	return ProcessResolvedXCommand(CObj, Cmd, Args, bCommandEndedInQuestion, Ar, InWorld);
+}
+
+IConsoleObject* FConsoleManager::FindXConsoleObject(const TCHAR* Name) const
+{
+	IConsoleObject* CObj = FindConsoleObject(Name);
+	if (!CObj)
+	{
+		return nullptr;
+	}
+
 #if DISABLE_CHEAT_CVARS
 	if (CObj->TestFlags(ECVF_Cheat))
 	{
-		return false;
+		return nullptr;
 	}
 #endif  // DISABLE_CHEAT_CVARS
 
 	if (CObj->TestFlags(ECVF_Unregistered))
 	{
-		return false;
+		return nullptr;
 	}
+	return CObj;
+}
+
+bool FConsoleManager::ProcessResolvedXCommand(IConsoleObject* CObj, const FString& Cmd, TArray<FString>& Args, bool bCommandEndedInQuestion, FOutputDevice& Ar, UWorld* InWorld, bool bCallSinks)
+{
+#if defined(WITH_EDITOR)
+#define AR_LOGF(Fmt, ...) Ar.Logf(Fmt, ##__VA_ARGS__)
+#else
+#define AR_LOGF(Fmt, ...)
+#endif
+	auto Old = bIsProcessingCommamd;
+	bIsProcessingCommamd = true;
+	ON_SCOPE_EXIT
+	{
+		bIsProcessingCommamd = Old;
+	};
 
 	IConsoleCommand* CCmd = CObj->AsCommand();
 	IConsoleVariable* CVar = CObj->AsVariable();
@@ -832,7 +872,8 @@ bool FConsoleManager::ProcessUserXCommandInput(FString& Cmd, TArray<FString>& Ar
 
 					AR_LOGF(TEXT("%s = \"%s\""), *Cmd, *CVar->GetString());
 
-					CallAllConsoleVariableSinks();
+					if (bCallSinks)
+						CallAllConsoleVariableSinks();
 				}
 			}
 		}
@@ -895,28 +936,25 @@ const TCHAR* GetCurCmdName(UWorld* InWorld)
 	} while (false);
 	return TEXT("None");
 }
-static void InsertsXCommandImpl(UWorld* InWorld, const TCHAR* InStr, bool bSearchDelim = false)
+static const TCHAR XCmdDelim[] = TEXT("---");
+static TArray<FXCmdGroup> ParseXCmdGroups(const TCHAR* InStr, bool bSearchDelim = false)
 {
-	UE_LOG(LogXConsoleManager, Log, TEXT("InsertsXCommandImpl"));
+	TArray<FXCmdGroup> Groups;
 	do
 	{
 		auto AllArgs = XSplitCommandLine(InStr);
-		static const TCHAR XCmdDelim[] = TEXT("---");
 
 		int32 FromIdx = 0;
 		if (bSearchDelim && !AllArgs.Find(XCmdDelim, FromIdx))
 			break;
 
-		auto& XCmdIndex = GetXCmdData(InWorld).XCmdIndex;
-		auto& XCmdGroups = GetXCmdGroups(InWorld);
-		auto InsertIdx = FMath::Min(XCmdGroups.Num(), XCmdIndex + 1);
 		for (auto i = FromIdx; i <= AllArgs.Num(); ++i)
 		{
 			if (i == AllArgs.Num() || AllArgs[i] == XCmdDelim)
 			{
 				if (FromIdx < i)
 				{
-					auto& Pair = XCmdGroups.InsertDefaulted_GetRef(InsertIdx++);
+					auto& Pair = Groups.AddDefaulted_GetRef();
 					Pair.Cmd = MoveTemp(AllArgs[FromIdx]);
 					Pair.Args.Reserve(i - FromIdx);
 					for (auto j = FromIdx + 1; j < i; ++j)
@@ -928,6 +966,18 @@ static void InsertsXCommandImpl(UWorld* InWorld, const TCHAR* InStr, bool bSearc
 			}
 		}
 	} while (false);
+	return Groups;
+}
+static void InsertsXCommandImpl(UWorld* InWorld, const TCHAR* InStr, bool bSearchDelim = false)
+{
+	UE_LOG(LogXConsoleManager, Log, TEXT("InsertsXCommandImpl"));
+	auto Groups = ParseXCmdGroups(InStr, bSearchDelim);
+	if (Groups.Num() > 0)
+	{
+		auto& XCmdIndex = GetXCmdData(InWorld).XCmdIndex;
+		auto& XCmdGroups = GetXCmdGroups(InWorld);
+		XCmdGroups.Insert(MoveTemp(Groups), FMath::Min(XCmdGroups.Num(), XCmdIndex + 1));
+	}
 };
 template<bool bTryInitHttp = PLATFORM_DESKTOP>
 IXConsoleManager* GetSingleton()
@@ -1008,7 +1058,292 @@ FAutoConsoleCommandWithWorldArgsAndOutputDevice CVar_XConsoleCmdList(TEXT("z.XCm
 																	 }));
 
 static int32 PipelineInt = 0;
+// bumped on every write so batches can tell a reported code from a stale one
+static uint32 PipelineIntSerial = 0;
 static FString PipelineString;
+
+static int32 XCmdBatchMaxCmds = 0;
+FAutoConsoleVariableRef CVar_XCmdBatchMaxCmds(TEXT("gmp.xcmd.batch.maxcmds"), XCmdBatchMaxCmds, TEXT("default number of commands a precompiled batch runs per frame, 0 means no limit"));
+static float XCmdBatchMaxMs = 5.f;
+FAutoConsoleVariableRef CVar_XCmdBatchMaxMs(TEXT("gmp.xcmd.batch.maxms"), XCmdBatchMaxMs, TEXT("default milliseconds a precompiled batch spends per frame, 0 means no limit"));
+
+struct FXCmdBatchEntry
+{
+	FString Cmd;
+	TArray<FString> Args;
+	IConsoleObject* CObj = nullptr;
+	bool bShowHelp = false;
+};
+
+// parsed and resolved once, then run from the end of frame under a budget
+struct FXCmdBatch : public TSharedFromThis<FXCmdBatch>
+{
+	TArray<FXCmdBatchEntry> Entries;
+	int32 Index = 0;
+	int32 MaxCmdsPerFrame = 0;
+	float MaxMsPerFrame = 0.f;
+	bool bRollbackOnFailure = false;
+	// the batch was started by the pipeline and holds it until finished
+	bool bHoldsPipeline = false;
+	bool bAwaitResult = false;
+	int32 PauseCnt = 0;
+	uint32 ResultSerial = 0;
+	int32 ResultCode = 0;
+
+	UWorld* World = nullptr;
+	TWeakObjectPtr<UWorld> WeakWorld;
+	FXConsoleCmdData* Owner = nullptr;
+	// previous values of the variables set so far, restored backwards on failure
+	TArray<TPair<IConsoleVariable*, FString>> Undo;
+
+	FDelegateHandle EndFrameHandle;
+#if UE_5_04_OR_LATER
+	FDelegateHandle UnregisteredHandle;
+#endif
+
+	~FXCmdBatch()
+	{
+		FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+#if UE_5_04_OR_LATER
+		XConsoleManager->OnConsoleObjectUnregistered().Remove(UnregisteredHandle);
+#endif
+	}
+
+	bool Compile(const TCHAR* InStr, FOutputDevice& Ar)
+	{
+		for (auto& Group : ParseXCmdGroups(InStr))
+		{
+			auto& Entry = Entries.AddDefaulted_GetRef();
+			Entry.Cmd = MoveTemp(Group.Cmd);
+			Entry.Args = MoveTemp(Group.Args);
+			Entry.bShowHelp = Entry.Cmd.EndsWith(TEXT("?"), ESearchCase::CaseSensitive);
+			if (Entry.bShowHelp)
+				Entry.Cmd.MidInline(0, Entry.Cmd.Len() - 1, EAllowShrinking::No);
+
+			Entry.CObj = XConsoleManager->FindXConsoleObject(*Entry.Cmd);
+			if (!Entry.CObj)
+			{
+				Ar.Logf(ELogVerbosity::Error, TEXT("XCmdBatch : unknown or disabled command %s at %d"), *Entry.Cmd, Entries.Num() - 1);
+				return false;
+			}
+			auto CVar = Entry.CObj->AsVariable();
+			if (CVar && CVar->TestFlags(ECVF_ReadOnly) && Entry.Args.Num() > 0 && !Entry.bShowHelp && Entry.Args[0] != TEXT("?"))
+			{
+				Ar.Logf(ELogVerbosity::Error, TEXT("XCmdBatch : %s is read only at %d"), *Entry.Cmd, Entries.Num() - 1);
+				return false;
+			}
+		}
+
+#if UE_5_04_OR_LATER
+		// commands are deleted on unregister, drop them before they dangle
+		UnregisteredHandle = XConsoleManager->OnConsoleObjectUnregistered().AddLambda([this](const TCHAR*, IConsoleObject* CObj) {
+			for (auto& Entry : Entries)
+			{
+				if (Entry.CObj == CObj)
+					Entry.CObj = nullptr;
+			}
+			Undo.RemoveAll([&](auto& Pair) { return Pair.Key == CObj; });
+		});
+#endif
+		return true;
+	}
+
+	// returns false once finished
+	bool RunSlice(FOutputDevice& Ar)
+	{
+		if (PauseCnt > 0)
+			return true;
+
+		bool bSinksDirty = false;
+		ON_SCOPE_EXIT
+		{
+			if (bSinksDirty)
+				XConsoleManager->CallAllConsoleVariableSinks();
+		};
+
+		if (bAwaitResult)
+		{
+			bAwaitResult = false;
+			if (IsResultFailed())
+				return Finish(Ar, PipelineInt);
+		}
+
+		const double EndTime = FPlatformTime::Seconds() + MaxMsPerFrame * 0.001;
+		int32 StepCnt = 0;
+		while (Entries.IsValidIndex(Index))
+		{
+			if ((MaxCmdsPerFrame > 0 && StepCnt >= MaxCmdsPerFrame) || (MaxMsPerFrame > 0.f && StepCnt > 0 && FPlatformTime::Seconds() >= EndTime))
+				return true;
+			++StepCnt;
+
+			auto& Entry = Entries[Index++];
+			if (!Entry.CObj || Entry.CObj->TestFlags(ECVF_Unregistered))
+			{
+				Ar.Logf(ELogVerbosity::Error, TEXT("XCmdBatch : %s was unregistered"), *Entry.Cmd);
+				return Finish(Ar, 1);
+			}
+
+			auto CVar = Entry.CObj->AsVariable();
+			if (CVar && Entry.Args.Num() > 0)
+			{
+				bSinksDirty = true;
+				if (bRollbackOnFailure)
+					Undo.Emplace(CVar, CVar->GetString());
+			}
+
+			// exec style commands return false by design, like the pipeline only the pipeline integer tells a failure
+			ResultSerial = PipelineIntSerial;
+			XConsoleManager->ProcessResolvedXCommand(Entry.CObj, Entry.Cmd, Entry.Args, Entry.bShowHelp, Ar, World, false);
+
+			// the result of a command that paused arrives with its continue
+			if (PauseCnt > 0)
+			{
+				bAwaitResult = true;
+				return true;
+			}
+			if (IsResultFailed())
+			{
+				Ar.Logf(ELogVerbosity::Error, TEXT("XCmdBatch : %s failed with %d at %d"), *Entry.Cmd, PipelineInt, Index - 1);
+				return Finish(Ar, PipelineInt);
+			}
+		}
+		return Finish(Ar, 0);
+	}
+
+	bool Finish(FOutputDevice& Ar, int32 Code)
+	{
+		ResultCode = Code;
+		if (Code != 0 && bRollbackOnFailure)
+		{
+			for (int32 i = Undo.Num() - 1; i >= 0; --i)
+				Undo[i].Key->Set(*Undo[i].Value, ECVF_SetByConsole);
+			if (Undo.Num() > 0)
+				XConsoleManager->CallAllConsoleVariableSinks();
+			Ar.Logf(TEXT("XCmdBatch : rolled back %d variables"), Undo.Num());
+		}
+		Undo.Empty();
+		UE_LOG(LogXConsoleManager, Log, TEXT("XCmdBatch finished with code %d after %d commands"), Code, Index);
+		return false;
+	}
+
+	void OnEndFrame()
+	{
+		TSharedRef<FXCmdBatch> Self = AsShared();
+		FOutputDevice& Ar = XCmdAr ? *XCmdAr : *GLog;
+		if (World && !WeakWorld.IsValid())
+		{
+			World = nullptr;
+			Finish(Ar, 1);
+			Release();
+			return;
+		}
+		if (!RunSlice(Ar))
+			Release();
+	}
+
+	void Release()
+	{
+		FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+		if (ensure(Owner && Owner->Batch.Get() == this))
+		{
+			IXConsoleManager::CommandPipelineInteger(ResultCode);
+			auto Self = AsShared();
+			Owner->Batch.Reset();
+			if (bHoldsPipeline && World)
+				ProcessingNextXCmdList(World);
+		}
+	}
+
+private:
+	bool IsResultFailed() const { return ResultSerial != PipelineIntSerial && PipelineInt != 0; }
+};
+
+static bool RunXCmdBatch(UWorld* InWorld, const TCHAR* InStr, const FXCmdBatchOptions& Options, FOutputDevice& Ar)
+{
+	auto& LocalXCmdData = GetXCmdData(InWorld);
+	if (LocalXCmdData.Batch)
+	{
+		Ar.Logf(ELogVerbosity::Error, TEXT("XCmdBatch : another batch is running"));
+		IXConsoleManager::CommandPipelineInteger(1);
+		return false;
+	}
+
+	auto Batch = MakeShared<FXCmdBatch>();
+	if (!Batch->Compile(InStr, Ar))
+	{
+		IXConsoleManager::CommandPipelineInteger(1);
+		return false;
+	}
+
+	Batch->MaxCmdsPerFrame = Options.MaxCmdsPerFrame >= 0 ? Options.MaxCmdsPerFrame : XCmdBatchMaxCmds;
+	Batch->MaxMsPerFrame = Options.MaxMsPerFrame >= 0.f ? Options.MaxMsPerFrame : XCmdBatchMaxMs;
+	Batch->bRollbackOnFailure = Options.bRollbackOnFailure;
+	Batch->World = InWorld;
+	Batch->WeakWorld = InWorld;
+	Batch->Owner = &LocalXCmdData;
+	LocalXCmdData.Batch = Batch;
+	UE_LOG(LogXConsoleManager, Log, TEXT("XCmdBatch compiled %d commands"), Batch->Entries.Num());
+
+	// the first slice runs right away, short batches never wait for a frame
+	if (!Batch->RunSlice(Ar))
+	{
+		Batch->Release();
+		return true;
+	}
+
+	// hold the pipeline the same way z.PipelineDelay does
+	if (XConsoleManager->IsProcessingCommand())
+	{
+		Batch->bHoldsPipeline = true;
+		LocalXCmdData.PauseCnt++;
+	}
+	Batch->EndFrameHandle = FCoreDelegates::OnEndFrame.AddRaw(&Batch.Get(), &FXCmdBatch::OnEndFrame);
+	return true;
+}
+
+static void AbortXCmdBatch(UWorld* InWorld, FOutputDevice& Ar)
+{
+	auto& LocalXCmdData = GetXCmdData(InWorld);
+	if (auto Batch = LocalXCmdData.Batch)
+	{
+		Ar.Logf(TEXT("XCmdBatch : aborted at %d"), Batch->Index);
+		Batch->Finish(Ar, 1);
+		Batch->Release();
+	}
+}
+
+FAutoConsoleCommandWithWorldArgsAndOutputDevice CVar_XConsoleCmdBatch(TEXT("z.XCmdBatch"),
+																	  TEXT("z.XCmdBatch [-MaxCmds=N] [-MaxMs=F] [-Rollback] FilePathList...\n"
+																		   "resolves every command before running any, then runs them under a per frame budget.\n"
+																		   "a failed command aborts the rest, -Rollback restores the variables set so far"),
+																	  FXConsoleFullCmdDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* InWorld, FOutputDevice& Ar) {
+																		  FXCmdBatchOptions Options;
+																		  TStringBuilder<4096> Buffer;
+																		  for (auto& Arg : Args)
+																		  {
+																			  if (FParse::Value(*Arg, TEXT("-MaxCmds="), Options.MaxCmdsPerFrame) || FParse::Value(*Arg, TEXT("-MaxMs="), Options.MaxMsPerFrame))
+																				  continue;
+																			  if (Arg == TEXT("-Rollback"))
+																			  {
+																				  Options.bRollbackOnFailure = true;
+																				  continue;
+																			  }
+
+																			  FString FileStr;
+																			  if (!ensure(FFileHelper::LoadFileToString(FileStr, *Arg)))
+																			  {
+																				  IXConsoleManager::CommandPipelineInteger(1);
+																				  return;
+																			  }
+																			  // groups never run across files
+																			  Buffer << FileStr << TEXT(" ") << XCmdDelim << TEXT(" ");
+																		  }
+																		  RunXCmdBatch(InWorld, *Buffer, Options, Ar);
+																	  }));
+
+FAutoConsoleCommandWithWorldArgsAndOutputDevice CVar_XConsoleCmdBatchAbort(TEXT("z.XCmdBatchAbort"), TEXT("z.XCmdBatchAbort"), FXConsoleFullCmdDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* InWorld, FOutputDevice& Ar) {
+																			   AbortXCmdBatch(InWorld, Ar);
+																		   }));
 }  // namespace GMPConsoleManger
 
 IXConsoleManager& IXConsoleManager::Get()
@@ -1019,15 +1354,38 @@ IXConsoleManager& IXConsoleManager::Get()
 void IXConsoleManager::PauseXConsoleCommandPipeline(UWorld* InWorld, const TCHAR* Reason)
 {
 	UE_LOG(LogXConsoleManager, Log, TEXT("XConsoleCommandline - Paused : %s"), Reason ? Reason : GMPConsoleManger::GetCurCmdName(InWorld));
-	GMPConsoleManger::GetXCmdData(InWorld).PauseCnt++;
+	auto& LocalXCmdData = GMPConsoleManger::GetXCmdData(InWorld);
+	if (LocalXCmdData.Batch)
+		LocalXCmdData.Batch->PauseCnt++;
+	else
+		LocalXCmdData.PauseCnt++;
 }
 
 void IXConsoleManager::ContinueXConsoleCommandPipeline(UWorld* InWorld, const TCHAR* Reason)
 {
 	UE_LOG(LogXConsoleManager, Log, TEXT("XConsoleCommandline-Continued: %s"), Reason ? Reason : GMPConsoleManger::GetCurCmdName(InWorld));
+	auto& LocalXCmdData = GMPConsoleManger::GetXCmdData(InWorld);
+	if (LocalXCmdData.Batch)
+	{
+		// the batch picks up again at the end of frame
+		if (ensureWorldMsgf(InWorld, LocalXCmdData.Batch->PauseCnt > 0, TEXT("PauseXConsoleCommandPipeline & ContinueXConsoleCommandPipeline mismatched")))
+			LocalXCmdData.Batch->PauseCnt--;
+		return;
+	}
 	GMPConsoleManger::ProcessingNextXCmdList(InWorld);
 }
 
+bool IXConsoleManager::RunXCommandBatch(UWorld* InWorld, const FString& Cmds, const FXCmdBatchOptions& Options, FOutputDevice* OutAr)
+{
+	GMPConsoleManger::GetSingleton();
+	return GMPConsoleManger::RunXCmdBatch(InWorld, *Cmds, Options, OutAr ? *OutAr : *GLog);
+}
+
+void IXConsoleManager::AbortXCommandBatch(UWorld* InWorld)
+{
+	GMPConsoleManger::AbortXCmdBatch(InWorld, *GLog);
+}
+
 int32 IXConsoleManager::CommandPipelineInteger()
 {
 	return GMPConsoleManger::PipelineInt;
@@ -1040,6 +1398,7 @@ int32 IXConsoleManager::CommandPipelineInteger(int32 InVal)
 		GMPConsoleManger::XCmdAr->Logf(TEXT("{\"code\":%d}\n"), InVal);
 	}
 
+	++GMPConsoleManger::PipelineIntSerial;
 	Swap(InVal, GMPConsoleManger::PipelineInt);
 	return InVal;
 }
@@ -3,6 +3,7 @@
 #pragma once
 #if defined(JSENV_API)
 #include "GMPCore.h"
+#include "GMP/GMPScriptMarshal.h"
 #include "Misc/ScopeExit.h"
 #include "V8Utils.h"
 #include "v8.h"
@@ -46,6 +47,12 @@ void BindWeakCallback(v8::Isolate* InIsolate, const v8::Local<v8::Object>& JsObj
 }
 using namespace puerts;
 
+using FV8MarshalCache = GMP::Script::TMarshalPlanCache<std::unique_ptr<FPropertyTranslator>>;
+inline const FV8MarshalCache::FPlan* FindV8MarshalPlan(FName MsgKey, int32 NumArgs, TFunctionRef<FName(int32)> GetTypeName)
+{
+	return FV8MarshalCache::FindOrAdd(MsgKey, NumArgs, GetTypeName, [](FProperty* Prop) { return FPropertyTranslator::Create(Prop); });
+}
+
 // function ListenObjectMessage(watchedobj, msgkey, weakobj, function [,times])
 // function ListenObjectMessage(watchedobj, msgkey, weakobj, globalfuncstr [,times])
 inline void v8_ListenObjectMessage(const v8::FunctionCallbackInfo<v8::Value>& Info)
@@ -147,33 +154,14 @@ inline void v8_ListenObjectMessage(const v8::FunctionCallbackInfo<v8::Value>& In
 #endif
 
 				const int32 NumArgs = Addrs.Num();
-				bool bSucc = true;
-				TArray<std::unique_ptr<FPropertyTranslator>, TInlineAllocator<8>> Incs;
-				for (auto Idx = 0; Idx < NumArgs; ++Idx)
-				{
-					FProperty* Prop = nullptr;
-					if (GMPReflection::PropertyFromString(GetTypeName(Idx).ToString(), Prop) && Prop)
-					{
-						auto Inc = FPropertyTranslator::Create(Prop);
-						if (Inc)
-						{
-							Incs.Add(std::move(Inc));
-							continue;
-						}
-					}
-
-					GMP_ERROR(TEXT("cannot get property from [%s]"), *GetTypeName(Idx).ToString());
-					bSucc = false;
-					break;
-				}
-
-				if (bSucc)
+				auto Plan = FindV8MarshalPlan(Body.MessageKey(), NumArgs, GetTypeName);
+				if (Plan)
 				{
 					v8::Local<v8::Value>* Args = static_cast<v8::Local<v8::Value>*>(FMemory_Alloca(sizeof(v8::Local<v8::Value>) * NumArgs));
 					FMemory::Memset(Args, 0, sizeof(v8::Local<v8::Value>) * NumArgs);
 					for (auto Idx = 0; Idx < NumArgs; ++Idx)
 					{
-						auto& Inc = Incs[Idx];
+						auto& Inc = (*Plan)[Idx].Converter;
 						Args[Idx] = Inc->UEToJs(Isolate, CbContext, Addrs[Idx].ToAddr(), true);
 					}
 
@@ -261,12 +249,6 @@ inline void v8_NotifyObjectMessage(const v8::FunctionCallbackInfo<v8::Value>& In
 		UObject* Sender = FV8Utils::GetUObject(Context, Info[0]);
 		FName MsgKey = *FV8Utils::ToFString(Isolate, Info[1]);
 
-		GMP::FTypedAddresses Params;
-		Params.Reserve(NumArgs);
-
-		TArray<FGMPTypedAddr::FPropertyValuePair, TInlineAllocator<8>> PropPairs;
-		PropPairs.Reserve(NumArgs);
-
 		auto Types = GMP::FMessageBody::GetMessageTypes(Sender, MsgKey);
 		if (!ensure(Types && NumArgs - 2 >= Types->Num()))
 		{
@@ -274,20 +256,21 @@ inline void v8_NotifyObjectMessage(const v8::FunctionCallbackInfo<v8::Value>& In
 			return;
 		}
 
-		for (auto i = 2; i < NumArgs; ++i)
-		{
-			FProperty* Prop = nullptr;
-			if (!GMPReflection::PropertyFromString((*Types)[i - 2].ToString(), Prop))
-			{
-				return;
-			}
-			auto Inc = FPropertyTranslator::Create(Prop);
-			if (!Inc)
-				return;
+		auto Plan = FindV8MarshalPlan(MsgKey, Types->Num(), [&](int32 Idx) { return (*Types)[Idx]; });
+		if (!Plan)
+			return;
 
-			auto& Ref = PropPairs.Emplace_GetRef(Prop, FMemory_Alloca_Aligned(Prop->ElementSize, Prop->GetMinAlignment()));
-			Inc->JsToUE(Isolate, Context, Info[i], Ref.Addr, false);
-			Params.AddDefaulted_GetRef().SetAddr(Ref);
+		GMP::FTypedAddresses Params;
+		GMP::Script::FArgBuffers::FScope Buffer(Isolate, Plan->BufferSize, Plan->BufferAlign);
+		Plan->InitializeArgs(Buffer.GetData(), Params);
+		ON_SCOPE_EXIT
+		{
+			Plan->DestroyArgs(Buffer.GetData());
+		};
+		for (auto Idx = 0; Idx < Plan->Num(); ++Idx)
+		{
+			auto& Slot = (*Plan)[Idx];
+			Slot.Converter->JsToUE(Isolate, Context, Info[Idx + 2], Buffer.GetData() + Slot.Offset, false);
 		}
 
 		GMP::FMessageHub::FTagTypeSetter SetMsgTagType(TEXT("Puerts"));
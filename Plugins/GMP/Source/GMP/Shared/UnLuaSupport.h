@@ -3,6 +3,8 @@
 #pragma once
 #if defined(UNLUA_API)
 #include "GMPCore.h"
+#include "GMP/GMPScriptMarshal.h"
+#include "Misc/ScopeExit.h"
 #include "UnLuaDelegates.h"
 #include "UnLuaEx.h"
 
@@ -22,6 +24,35 @@ extern UnLua::ITypeInterface* CreateTypeInterface(lua_State* L, int32 Idx);
 #endif
 
 GMP_EXTERNAL_SIGSOURCE(lua_State)
+using FGMPLuaMarshalCache = GMP::Script::TMarshalPlanCache<UnLua::ITypeInterface*>;
+using FGMPLuaMarshalPlan = FGMPLuaMarshalCache::FPlan;
+
+inline const FGMPLuaMarshalPlan* GMP_FindLuaMarshalPlan(FName MsgKey, int32 NumArgs, TFunctionRef<FName(int32)> GetTypeName)
+{
+	return FGMPLuaMarshalCache::FindOrAdd(MsgKey, NumArgs, GetTypeName, [](FProperty* Prop) { return CreateTypeInterface(Prop); });
+}
+
+// coroutines share the argument buffers of their main state, which is the one released with the env
+inline lua_State* GMP_GetLuaMainState(lua_State* L)
+{
+	lua_rawgeti(L, LUA_REGISTRYINDEX, LUA_RIDX_MAINTHREAD);
+	lua_State* MainState = lua_tothread(L, -1);
+	lua_pop(L, 1);
+	return MainState ? MainState : L;
+}
+
+// cheap lua value check against the planned property, replaces per-argument type interface creation
+inline bool GMP_IsLuaValueCompatible(lua_State* L, int32 Idx, const FProperty* Prop)
+{
+	const int LuaType = lua_type(L, Idx);
+	if (Prop->IsA<FBoolProperty>())
+		return LuaType == LUA_TBOOLEAN || LuaType == LUA_TNIL;
+	if (Prop->IsA<FNumericProperty>() || Prop->IsA<FEnumProperty>())
+		return LuaType == LUA_TNUMBER;
+	if (Prop->IsA<FStrProperty>() || Prop->IsA<FNameProperty>() || Prop->IsA<FTextProperty>())
+		return LuaType == LUA_TSTRING || LuaType == LUA_TUSERDATA;
+	return LuaType == LUA_TTABLE || LuaType == LUA_TUSERDATA || LuaType == LUA_TNIL;
+}
 
 enum GMP_Unlua_Listen_Index : int32
 {
@@ -162,11 +193,9 @@ inline int Lua_ListenObjectMessage(lua_State* L)
 				if (!ensure(L))
 					return;
 
-				bool bSucc = true;
 				auto& Addrs = Body.GetParams();
 				const int32 NumArgs = Addrs.Num();
 
-				TArray<UnLua::ITypeInterface*, TInlineAllocator<8>> Incs;
 				auto Types = Body.GetMessageTypes(WatchedObject);
 
 #if !GMP_WITH_TYPENAME
@@ -182,23 +211,8 @@ inline int Lua_ListenObjectMessage(lua_State* L)
 #endif
 				};
 
-				for (auto i = 0; i < NumArgs; ++i)
-				{
-					FProperty* Prop = nullptr;
-					if (GMPReflection::PropertyFromString(GetTypeName(i).ToString(), Prop) && Prop)
-					{
-						using namespace UnLua;
-						if (auto Inc = CreateTypeInterface(Prop))
-						{
-							Incs.Add(Inc);
-							continue;
-						}
-					}
-
-					GMP_ERROR(TEXT("cannot get property from [%s]"), *GetTypeName(i).ToString());
-					bSucc = false;
-					break;
-				}
+				auto Plan = GMP_FindLuaMarshalPlan(Body.MessageKey(), NumArgs, GetTypeName);
+				bool bSucc = !!Plan;
 
 				lua_settop(L, 0);
 				if (bSucc)
@@ -216,7 +230,7 @@ inline int Lua_ListenObjectMessage(lua_State* L)
 
 					for (auto i = 0; i < NumArgs; ++i)
 					{
-						auto& Inc = Incs[i];
+						auto& Inc = (*Plan)[i].Converter;
 #if 1
 						// fixme : make unlua happy, unlua treat all integer as same type
 						auto IncProp = CastField<FNumericProperty>(Inc->GetUProperty());
@@ -326,6 +340,37 @@ inline int Lua_NotifyObjectMessage(lua_State* L)
 		GMP::FTypedAddresses Params;
 		Params.Reserve(NumArgs);
 
+		// fast path : signature already registered, reuse the cached plan and the per-state argument buffer
+		auto Types = GMP::FMessageBody::GetMessageTypes(Sender, MsgKey);
+		if (Types && Types->Num() == NumArgs - 2)
+		{
+			auto Plan = GMP_FindLuaMarshalPlan(MsgKey, Types->Num(), [&](int32 Idx) { return (*Types)[Idx]; });
+			for (auto i = 0; Plan && i < Plan->Num(); ++i)
+			{
+				// the per argument conversion below decides, as it did before the plan
+				if (!GMP_IsLuaValueCompatible(L, i + 3, (*Plan)[i].Prop))
+				{
+					GMP_WARNING(TEXT("Lua Notify %s argument %d is a lua %s, expected %s"), *MsgKey.ToString(), i + 1, UTF8_TO_TCHAR(luaL_typename(L, i + 3)), *(*Types)[i].ToString());
+					Plan = nullptr;
+				}
+			}
+			if (Plan)
+			{
+				// converters and listeners may raise lua errors, the args and the buffer scope are released while unwinding
+				GMP::Script::FArgBuffers::FScope Buffer(GMP_GetLuaMainState(L), Plan->BufferSize, Plan->BufferAlign);
+				Plan->InitializeArgs(Buffer.GetData(), Params);
+				ON_SCOPE_EXIT { Plan->DestroyArgs(Buffer.GetData()); };
+				for (auto i = 0; i < Plan->Num(); ++i)
+					(*Plan)[i].Converter->Write(L, Buffer.GetData() + (*Plan)[i].Offset, i + 3);
+
+				{
+					GMP::FMessageHub::FTagTypeSetter SetMsgTagType(TEXT("Unlua"));
+					FGMPHelper::ScriptNotifyMessage(MsgKey, Params, Sender);
+				}
+				break;
+			}
+		}
+
 		TArray<FGMPTypedAddr::FPropertyValuePair, TInlineAllocator<8>> PropPairs;
 		PropPairs.Reserve(NumArgs);
 
@@ -346,7 +391,7 @@ inline int Lua_NotifyObjectMessage(lua_State* L)
 		}
 
 #if GMP_WITH_DYNAMIC_TYPE_CHECK
-		if (auto Types = GMP::FMessageBody::GetMessageTypes(Sender, MsgKey))
+		if (Types)
 		{
 			for (auto i = 0; i < PropPairs.Num(); ++i)
 			{
@@ -643,6 +688,7 @@ inline void GMP_UnregisterToLua(lua_State* L)
 	if (ensure(L))
 	{
 		FGMPSigSource::RemoveSource(L);
+		GMP::Script::FArgBuffers::Release(L);
 	}
 }
 
@@ -67,6 +67,15 @@ namespace Serializer
 DECLARE_DELEGATE_ThreeParams(FXConsoleCommandWithWorldArgsAndOutputDeviceDelegate, const TArray<FString>&, UWorld*, FOutputDevice&);
 using FXConsoleFullCmdDelegate = FXConsoleCommandWithWorldArgsAndOutputDeviceDelegate;
 
+struct FXCmdBatchOptions
+{
+	// negative values take gmp.xcmd.batch.maxcmds and gmp.xcmd.batch.maxms
+	int32 MaxCmdsPerFrame = -1;
+	float MaxMsPerFrame = -1.f;
+	// restore the variables set by the batch when a command fails, commands themselves are not undone
+	bool bRollbackOnFailure = false;
+};
+
 class IXConsoleManager 
 #if !NO_CVARS
 : public IConsoleManager
@@ -129,6 +138,10 @@ public:
 	static GMP_API const FString& CommandPipelineString();
 	static GMP_API void CommandPipelineString(const FString& InStr);
 
+	// resolves every command before running any, then runs them under a per frame budget, false when nothing ran
+	static GMP_API bool RunXCommandBatch(UWorld* InWorld, const FString& Cmds, const FXCmdBatchOptions& Options = FXCmdBatchOptions(), FOutputDevice* OutAr = nullptr);
+	static GMP_API void AbortXCommandBatch(UWorld* InWorld);
+
 	virtual const GMP::FArrayTypeNames* GetXConsoleCommandProps(const TCHAR* Name) const = 0;
 	virtual TArray<FString> GetXConsoleCommandList() const = 0;
 
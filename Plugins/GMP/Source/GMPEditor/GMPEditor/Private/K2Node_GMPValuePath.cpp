@@ -0,0 +1,245 @@
+//  Copyright GenericMessagePlugin, Inc. All Rights Reserved.
+
+#include "K2Node_GMPValuePath.h"
+
+#include "BlueprintActionDatabaseRegistrar.h"
+#include "BlueprintNodeSpawner.h"
+#include "EdGraphSchema_K2.h"
+#include "GMP/GMPValueOneOf.h"
+#include "K2Node_CallFunction.h"
+#include "Kismet/KismetSystemLibrary.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Kismet2/CompilerResultsLog.h"
+#include "KismetCompiler.h"
+
+#define LOCTEXT_NAMESPACE "K2Node_GMPValuePath"
+
+namespace GMP
+{
+namespace ValuePathUtils
+{
+	static FName ValuePin{TEXT("Value")};
+	static FName PathPin{TEXT("Path")};
+	static FName ResultPin{TEXT("Result")};
+	static FName SuccessPin{TEXT("bSuccess")};
+
+	// UGMPJsonUtils is not exported
+	static UFunction* AsValueByPathFunc()
+	{
+		static TWeakObjectPtr<UFunction> Func;
+		if (!Func.IsValid())
+			Func = FindObject<UFunction>(nullptr, TEXT("/Script/GMP.GMPJsonUtils:AsValueByPath"));
+		return Func.Get();
+	}
+	static UFunction* CompileValuePathFunc()
+	{
+		static TWeakObjectPtr<UFunction> Func;
+		if (!Func.IsValid())
+			Func = FindObject<UFunction>(nullptr, TEXT("/Script/GMP.GMPJsonUtils:CompileValuePath"));
+		return Func.Get();
+	}
+
+	// the pin holding a path known when the blueprint compiles, an unlinked path pin or the value of a Make Literal String feeding it
+	static const UEdGraphPin* FindLiteralPath(const UEdGraphPin* Pin)
+	{
+		if (!Pin)
+			return nullptr;
+		if (Pin->LinkedTo.Num() == 0)
+			return Pin;
+		auto CallNode = Pin->LinkedTo.Num() == 1 ? Cast<UK2Node_CallFunction>(Pin->LinkedTo[0]->GetOwningNode()) : nullptr;
+		if (!CallNode || CallNode->FunctionReference.GetMemberName() != GET_FUNCTION_NAME_CHECKED(UKismetSystemLibrary, MakeLiteralString) || CallNode->FunctionReference.GetMemberParentClass() != UKismetSystemLibrary::StaticClass())
+			return nullptr;
+		auto ValuePin = CallNode->FindPin(TEXT("Value"), EGPD_Input);
+		return ValuePin && ValuePin->LinkedTo.Num() == 0 ? ValuePin : nullptr;
+	}
+}  // namespace ValuePathUtils
+}  // namespace GMP
+
+void UK2Node_GMPValuePath::AllocateDefaultPins()
+{
+	using namespace GMP::ValuePathUtils;
+	CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_Exec, UEdGraphSchema_K2::PN_Execute);
+	CreatePin(EGPD_Output, UEdGraphSchema_K2::PC_Exec, UEdGraphSchema_K2::PN_Then);
+
+	auto InValuePin = CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_Struct, FGMPValueOneOf::StaticStruct(), ValuePin);
+	InValuePin->PinType.bIsReference = true;
+	InValuePin->PinType.bIsConst = true;
+	CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_String, PathPin);
+
+	CreatePin(EGPD_Output, UEdGraphSchema_K2::PC_Wildcard, ResultPin);
+	CreatePin(EGPD_Output, UEdGraphSchema_K2::PC_Boolean, SuccessPin);
+
+	Super::AllocateDefaultPins();
+}
+
+void UK2Node_GMPValuePath::ReallocatePinsDuringReconstruction(TArray<UEdGraphPin*>& OldPins)
+{
+	AllocateDefaultPins();
+
+	if (auto OldResultPin = OldPins.FindByPredicate([](auto Pin) { return Pin && Pin->PinName == GMP::ValuePathUtils::ResultPin; }))
+	{
+		FindPinChecked(GMP::ValuePathUtils::ResultPin)->PinType = (*OldResultPin)->PinType;
+	}
+
+	RestoreSplitPins(OldPins);
+}
+
+FText UK2Node_GMPValuePath::GetNodeTitle(ENodeTitleType::Type TitleType) const
+{
+	auto LiteralPin = GMP::ValuePathUtils::FindLiteralPath(FindPin(GMP::ValuePathUtils::PathPin));
+	if (TitleType != ENodeTitleType::MenuTitle && LiteralPin && !LiteralPin->DefaultValue.IsEmpty())
+		return FText::Format(LOCTEXT("ValuePathNodeTitle", "Get OneOf {0}"), FText::FromString(LiteralPin->DefaultValue));
+	return LOCTEXT("ValuePathNodeMenuTitle", "Get OneOf By Path");
+}
+
+FText UK2Node_GMPValuePath::GetTooltipText() const
+{
+	return LOCTEXT("ValuePathNodeTooltip", "Reads a nested value like a.b[3].c, a literal path is compiled with the blueprint");
+}
+
+void UK2Node_GMPValuePath::SynchronizeResultPinType(UEdGraphPin* Pin)
+{
+	if (Pin->LinkedTo.Num() > 0)
+	{
+		if (Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Wildcard)
+		{
+			Pin->PinType = Pin->LinkedTo[0]->PinType;
+			Pin->PinType.bIsReference = false;
+			Pin->PinType.bIsConst = false;
+		}
+	}
+	else if (Pin->PinType.PinCategory != UEdGraphSchema_K2::PC_Wildcard)
+	{
+		Pin->PinType.ResetToDefaults();
+		Pin->PinType.PinCategory = UEdGraphSchema_K2::PC_Wildcard;
+	}
+	GetGraph()->NotifyGraphChanged();
+}
+
+void UK2Node_GMPValuePath::PinConnectionListChanged(UEdGraphPin* Pin)
+{
+	Super::PinConnectionListChanged(Pin);
+	if (!Pin)
+		return;
+
+	if (Pin->PinName == GMP::ValuePathUtils::ResultPin)
+	{
+		SynchronizeResultPinType(Pin);
+	}
+	else if (Pin->PinName == GMP::ValuePathUtils::PathPin)
+	{
+		GetGraph()->NotifyGraphChanged();
+	}
+}
+
+void UK2Node_GMPValuePath::PinDefaultValueChanged(UEdGraphPin* Pin)
+{
+	Super::PinDefaultValueChanged(Pin);
+	if (Pin && Pin->PinName == GMP::ValuePathUtils::PathPin)
+	{
+		GetGraph()->NotifyGraphChanged();
+		FBlueprintEditorUtils::MarkBlueprintAsModified(GetBlueprint());
+	}
+}
+
+void UK2Node_GMPValuePath::EarlyValidation(class FCompilerResultsLog& MessageLog) const
+{
+	Super::EarlyValidation(MessageLog);
+
+	auto LiteralPin = GMP::ValuePathUtils::FindLiteralPath(FindPinChecked(GMP::ValuePathUtils::PathPin));
+	FString Error;
+	if (LiteralPin && !FGMPValuePath().Compile(LiteralPin->DefaultValue, &Error))
+	{
+		MessageLog.Error(*FString::Printf(TEXT("%s @@"), *Error), LiteralPin);
+	}
+
+	auto ResultPin = FindPinChecked(GMP::ValuePathUtils::ResultPin);
+	if (ResultPin->PinType.PinCategory == UEdGraphSchema_K2::PC_Wildcard)
+	{
+		MessageLog.Error(TEXT("Result type is not resolved @@"), ResultPin);
+	}
+}
+
+void UK2Node_GMPValuePath::ExpandNode(class FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph)
+{
+	using namespace GMP::ValuePathUtils;
+	Super::ExpandNode(CompilerContext, SourceGraph);
+
+	auto PathPinPtr = FindPinChecked(PathPin);
+	auto ResultPinPtr = FindPinChecked(ResultPin);
+	auto Func = AsValueByPathFunc();
+	if (!Func || ResultPinPtr->PinType.PinCategory == UEdGraphSchema_K2::PC_Wildcard)
+	{
+		CompilerContext.MessageLog.Error(TEXT("Data Error @@"), ResultPinPtr);
+		BreakAllNodeLinks();
+		return;
+	}
+
+	UK2Node_CallFunction* CallNode = CompilerContext.SpawnIntermediateNode<UK2Node_CallFunction>(this, SourceGraph);
+	CallNode->SetFromFunction(Func);
+	CallNode->AllocateDefaultPins();
+	CompilerContext.MessageLog.NotifyIntermediateObjectCreation(CallNode, this);
+
+	bool bErrorFree = true;
+	bErrorFree &= CompilerContext.MovePinLinksToIntermediate(*GetExecPin(), *CallNode->GetExecPin()).CanSafeConnect();
+	bErrorFree &= CompilerContext.MovePinLinksToIntermediate(*FindPinChecked(UEdGraphSchema_K2::PN_Then), *CallNode->GetThenPin()).CanSafeConnect();
+	bErrorFree &= CompilerContext.MovePinLinksToIntermediate(*FindPinChecked(ValuePin), *CallNode->FindPinChecked(TEXT("InValue"))).CanSafeConnect();
+
+	auto CallPathPin = CallNode->FindPinChecked(TEXT("Path"));
+	if (auto LiteralPin = FindLiteralPath(PathPinPtr))
+	{
+		// steps and hashes are baked into the struct literal, nothing is parsed at runtime
+		FGMPValuePath Compiled;
+		FString Error;
+		if (!Compiled.Compile(LiteralPin->DefaultValue, &Error))
+		{
+			CompilerContext.MessageLog.Error(*FString::Printf(TEXT("%s @@"), *Error), LiteralPin);
+			BreakAllNodeLinks();
+			return;
+		}
+		FString Literal;
+		FGMPValuePath::StaticStruct()->ExportText(Literal, &Compiled, nullptr, nullptr, PPF_None, nullptr);
+		CompilerContext.GetSchema()->TrySetDefaultValue(*CallPathPin, Literal);
+	}
+	else if (auto CompileFunc = CompileValuePathFunc())
+	{
+		UK2Node_CallFunction* CompileNode = CompilerContext.SpawnIntermediateNode<UK2Node_CallFunction>(this, SourceGraph);
+		CompileNode->SetFromFunction(CompileFunc);
+		CompileNode->AllocateDefaultPins();
+		CompilerContext.MessageLog.NotifyIntermediateObjectCreation(CompileNode, this);
+		bErrorFree &= CompilerContext.MovePinLinksToIntermediate(*PathPinPtr, *CompileNode->FindPinChecked(TEXT("InPath"))).CanSafeConnect();
+		bErrorFree &= CompilerContext.GetSchema()->TryCreateConnection(CompileNode->GetReturnValuePin(), CallPathPin);
+	}
+
+	auto OutValuePin = CallNode->FindPinChecked(TEXT("OutValue"));
+	OutValuePin->PinType = ResultPinPtr->PinType;
+	OutValuePin->PinType.bIsReference = false;
+	bErrorFree &= CompilerContext.MovePinLinksToIntermediate(*ResultPinPtr, *OutValuePin).CanSafeConnect();
+	bErrorFree &= CompilerContext.MovePinLinksToIntermediate(*FindPinChecked(SuccessPin), *CallNode->GetReturnValuePin()).CanSafeConnect();
+
+	if (!bErrorFree)
+	{
+		CompilerContext.MessageLog.Error(TEXT("Internal connection error @@"), this);
+	}
+
+	BreakAllNodeLinks();
+}
+
+void UK2Node_GMPValuePath::GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const
+{
+	UClass* ActionKey = GetClass();
+	if (ActionRegistrar.IsOpenForRegistration(ActionKey))
+	{
+		UBlueprintNodeSpawner* NodeSpawner = UBlueprintNodeSpawner::Create(GetClass());
+		check(NodeSpawner != nullptr);
+
+		ActionRegistrar.AddBlueprintAction(ActionKey, NodeSpawner);
+	}
+}
+
+FText UK2Node_GMPValuePath::GetMenuCategory() const
+{
+	return LOCTEXT("GMP_SubCategory_OneOf", "GMP|OneOf(Json)");
+}
+
+#undef LOCTEXT_NAMESPACE
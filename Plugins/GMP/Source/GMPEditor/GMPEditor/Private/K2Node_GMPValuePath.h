@@ -0,0 +1,40 @@
+//  Copyright GenericMessagePlugin, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "K2Node.h"
+#include "UObject/ObjectMacros.h"
+#include "UnrealCompatibility.h"
+
+#include "K2Node_GMPValuePath.generated.h"
+
+class FBlueprintActionDatabaseRegistrar;
+class UEdGraph;
+
+// reads a.b[3].c out of a FGMPValueOneOf, a literal path is compiled with the blueprint
+UCLASS()
+class GMPEDITOR_API UK2Node_GMPValuePath : public UK2Node
+{
+	GENERATED_BODY()
+public:
+	//~ Begin UEdGraphNode Interface.
+	virtual void AllocateDefaultPins() override;
+	virtual FText GetNodeTitle(ENodeTitleType::Type TitleType) const override;
+	virtual FText GetTooltipText() const override;
+	virtual void PinConnectionListChanged(UEdGraphPin* Pin) override;
+	virtual void PinDefaultValueChanged(UEdGraphPin* Pin) override;
+	//~ End UEdGraphNode Interface.
+
+	//~ Begin UK2Node Interface.
+	virtual void ReallocatePinsDuringReconstruction(TArray<UEdGraphPin*>& OldPins) override;
+	virtual void EarlyValidation(class FCompilerResultsLog& MessageLog) const override;
+	virtual void ExpandNode(class FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph) override;
+	virtual void GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const override;
+	virtual FText GetMenuCategory() const override;
+	//~ End UK2Node Interface.
+
+private:
+	void SynchronizeResultPinType(UEdGraphPin* Pin);
+};
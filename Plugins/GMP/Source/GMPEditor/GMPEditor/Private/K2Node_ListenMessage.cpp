@@ -47,6 +47,7 @@ namespace GMPListenMessage
 const FGraphPinNameType EventName = TEXT("EventName");
 const FGraphPinNameType TimesName = TEXT("Times");
 const FGraphPinNameType OrderName = TEXT("Order");
+const FGraphPinNameType ObserveConsumedName = TEXT("bObserveConsumed");
 const FGraphPinNameType ExactObjName = TEXT("ExactObjName");
 const FGraphPinNameType OnMessageName = TEXT("OnMessage");
 const FGraphPinNameType DelegateName = TEXT("Delegate");
@@ -631,6 +632,24 @@ void UK2Node_ListenMessage::AllocateDefaultPinsImpl(TArray<UEdGraphPin*>* InOldP
 		return true;
 	}();
 
+	PinType.ResetToDefaults();
+	PinType.PinCategory = UEdGraphSchema_K2::PC_Boolean;
+	Pin = CreatePin(EGPD_Input, PinType, GMPListenMessage::ObserveConsumedName);
+	Pin->DefaultValue = TEXT("false");
+	Pin->PinFriendlyName = INVTEXT("Observe Consumed");
+	Pin->PinToolTip = TEXT("Still Triggered after a higher order listener consumed the message");
+	Pin->bAdvancedView = [InOldPins] {
+		if (InOldPins)
+		{
+			for (auto OldPin : *InOldPins)
+			{
+				if (OldPin->GetFName() == GMPListenMessage::ObserveConsumedName)
+					return !OldPin->DefaultValue.ToBool();
+			}
+		}
+		return true;
+	}();
+
 	if (IsAllowLatentFuncs())
 	{
 		PinType.ResetToDefaults();
@@ -745,6 +764,10 @@ void UK2Node_ListenMessage::PinDefaultValueChanged(UEdGraphPin* ChangedPin)
 		LexFromString(Order, *ChangedPin->DefaultValue);
 		ChangedPin->bAdvancedView = (Order != 0);
 	}
+	else if (ChangedPin == FindPin(GMPListenMessage::ObserveConsumedName))
+	{
+		ChangedPin->bAdvancedView = !ChangedPin->DefaultValue.ToBool();
+	}
 	else if (ChangedPin == FindPin(GMPListenMessage::ExactObjName))
 	{
 		ChangedPin->bAdvancedView = (ChangedPin->DefaultValue.IsEmpty() || ChangedPin->DefaultValue == TEXT("None"));
@@ -895,7 +918,7 @@ void UK2Node_ListenMessage::ExpandNode(class FKismetCompilerContext& CompilerCon
 		{
 			if (UnlistenPin->LinkedTo.Num())
 			{
-				UFunction* UnListenMessageFunc = GMP_UFUNCTION_CHECKED(UGMPBPLib, UnlistenMessageByKey);
+				UFunction* UnListenMessageFunc = GMP_UFUNCTION_CHECKED(UGMPBPLib, UnlistenMessageByName);
 				UK2Node_CallFunction* UnListenMessageFuncNode = CompilerContext.SpawnIntermediateNode<UK2Node_CallFunction>(this, SourceGraph);
 				UnListenMessageFuncNode->SetFromFunction(UnListenMessageFunc);
 				UnListenMessageFuncNode->AllocateDefaultPins();
@@ -926,6 +949,11 @@ void UK2Node_ListenMessage::ExpandNode(class FKismetCompilerContext& CompilerCon
 		if (UEdGraphPin* PinOrder = ListenMessageFuncNode->FindPin(GMPListenMessage::OrderName))
 			bIsErrorFree &= TryCreateConnection(CompilerContext, OrderPin, PinOrder);
 	}
+	if (UEdGraphPin* ObserveConsumedPin = FindPin(GMPListenMessage::ObserveConsumedName))
+	{
+		if (UEdGraphPin* PinObserveConsumed = ListenMessageFuncNode->FindPin(GMPListenMessage::ObserveConsumedName))
+			bIsErrorFree &= TryCreateConnection(CompilerContext, ObserveConsumedPin, PinObserveConsumed);
+	}
 	if (auto ThenPin = FindPin(UEdGraphSchema_K2::PN_Then))
 		bIsErrorFree &= TryCreateConnection(CompilerContext, ThenPin, ListenMessageFuncNode->GetThenPin());
 	bIsErrorFree &= TryCreateConnection(CompilerContext, FindPinChecked(UEdGraphSchema_K2::PN_Execute), ListenMessageFuncNode->GetExecPin());
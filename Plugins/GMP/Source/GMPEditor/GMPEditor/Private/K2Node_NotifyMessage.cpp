@@ -100,7 +100,7 @@ TSharedPtr<class SGraphNode> UK2Node_NotifyMessage::CreateVisualWidget()
 
 			const auto Limitation = 10;
 			Listeners.Reset(0);
-			const bool bEllipsis = GMP::FMessageUtils::GetMessageHub()->GetListeners(SenderObj, Node->MsgTag.GetTagName(), Listeners, Limitation);
+			const bool bEllipsis = GMP::FMessageUtils::GetSourceHub(SenderObj)->GetListeners(SenderObj, Node->MsgTag.GetTagName(), Listeners, Limitation);
 			if (Listeners.Num() == 0)
 			{
 				static const FString NoListener(TEXT("no listener "));
@@ -534,11 +534,25 @@ void UK2Node_NotifyMessage::ExpandNode(class FKismetCompilerContext& CompilerCon
 	auto ResponsedPin = FindPinChecked(GMPNotifyMessage::Responed, EGPD_Output);
 	const bool bResponsed = ResponsedPin && ResponsedPin->LinkedTo.Num() > 0;
 
-	UFunction* NotifyMessageFunc = (UE_4_25_OR_LATER) ? (bResponsed ? GMP_UFUNCTION_CHECKED(UGMPBPLib, NotifyMessageByKeyVariadicRet) : GMP_UFUNCTION_CHECKED(UGMPBPLib, NotifyMessageByKeyVariadic))
+	// the key literal becomes a name constant in bytecode, resolved once at load instead of per send
+	UFunction* NotifyMessageFunc = (UE_4_25_OR_LATER) ? (bResponsed ? GMP_UFUNCTION_CHECKED(UGMPBPLib, NotifyMessageByNameVariadicRet) : GMP_UFUNCTION_CHECKED(UGMPBPLib, NotifyMessageByNameVariadic))
 													  : (bResponsed ? GMP_UFUNCTION_CHECKED(UGMPBPLib, NotifyMessageByKeyRet) : GMP_UFUNCTION_CHECKED(UGMPBPLib, NotifyMessageByKey));
-	UFunction* RequestMessageFunc = (UE_4_25_OR_LATER) ? (bResponsed ? GMP_UFUNCTION_CHECKED(UGMPBPLib, RequestMessageVariadicRet) : GMP_UFUNCTION_CHECKED(UGMPBPLib, RequestMessageVariadic))
+	UFunction* RequestMessageFunc = (UE_4_25_OR_LATER) ? (bResponsed ? GMP_UFUNCTION_CHECKED(UGMPBPLib, RequestMessageByNameVariadicRet) : GMP_UFUNCTION_CHECKED(UGMPBPLib, RequestMessageByNameVariadic))
 													   : (bResponsed ? GMP_UFUNCTION_CHECKED(UGMPBPLib, RequestMessageRet) : GMP_UFUNCTION_CHECKED(UGMPBPLib, RequestMessage));
 
+	// common arities have their own thunks, the variadic one stays the fallback
+	if (UE_4_25_OR_LATER && !bHasResponse)
+	{
+		// must match the pins ExpandMessageCall adds, the thunk steps exactly that many
+		int32 NumArgs = 0;
+		for (int32 Index = 0; Index < ParameterTypes.Num(); ++Index)
+			NumArgs += GetInputPinByIndex(Index) ? 1 : 0;
+
+		auto FixedFunc = NumArgs <= 8 ? UGMPBPLib::StaticClass()->FindFunctionByName(*FString::Printf(TEXT("NotifyMessageByName%d"), NumArgs)) : nullptr;
+		if (FixedFunc)
+			NotifyMessageFunc = FixedFunc;
+	}
+
 	UK2Node_CallFunction* InvokeMessageNode = CompilerContext.SpawnIntermediateNode<UK2Node_CallFunction>(this, SourceGraph);
 	InvokeMessageNode->SetFromFunction(bHasResponse ? RequestMessageFunc : NotifyMessageFunc);
 	InvokeMessageNode->AllocateDefaultPins();
@@ -0,0 +1,26 @@
+//  Copyright GenericMessagePlugin, Inc. All Rights Reserved.
+
+using UnrealBuildTool;
+using System.IO;
+
+public class GMPTests : ModuleRules
+{
+	public GMPTests(ReadOnlyTargetRules Target)
+		: base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PrivateIncludePaths.AddRange(new string[] {
+			ModuleDirectory + "/Private",
+		});
+
+		PrivateDependencyModuleNames.AddRange(new string[] {
+			"Core",
+			"CoreUObject",
+			"Engine",
+			"GMP",
+			"HTTP",  // EHttpResponseCodes
+		});
+		PrivateDefinitions.Add("SUPPRESS_MONOLITHIC_HEADER_WARNINGS=1");
+	}
+}
@@ -0,0 +1,190 @@
+//  Copyright GenericMessagePlugin, Inc. All Rights Reserved.
+
+#include "GMPArchive.h"
+#include "GMPClass2Prop.h"
+#include "GMPJsonHttpClient.h"
+#include "GMPJsonSerializer.h"
+#include "GMPProtoSerializer.h"
+#include "GMPTestUtils.h"
+#include "GMPUtils.h"
+#include "UObject/StructOnScope.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+GMP_IMPLEMENT_BENCH(FGMPBenchDispatch, "Dispatch")
+bool FGMPBenchDispatch::RunTest(const FString& Parameters)
+{
+	using namespace GMP;
+	auto Hub = FMessageUtils::GetMessageHub();
+	if (!TestTrue(TEXT("message hub is available"), Hub && Hub->IsValidHub()))
+		return false;
+
+	for (int32 NumListeners : {1, 8, 64, 512})
+	{
+		const FMSGKEY Key(FString::Printf(TEXT("GMP.Bench.Dispatch.%d"), NumListeners));
+		FSigHandle Listener;
+		int64 Calls = 0;
+		for (int32 i = 0; i < NumListeners; ++i)
+			Hub->ListenMessage(Key, &Listener, [&Calls](int32 Value) { Calls += Value; });
+
+		const FMSGKEYFind SendKey(Key);
+		int32 Value = 1;
+		const int32 Iterations = Tests::BenchIterations(FMath::Max(1000, 2000000 / NumListeners));
+		const double NsPerSend = Tests::MeasureNsPerOp(Iterations, [&] { Hub->SendObjectMessage(SendKey, FSigSource::NullSigSrc, Value); });
+		Tests::ReportBench(*this, FString::Printf(TEXT("dispatch listeners=%d"), NumListeners), NsPerSend);
+		Tests::ReportBench(*this, FString::Printf(TEXT("dispatch listeners=%d per listener"), NumListeners), NsPerSend / NumListeners);
+
+		TestEqual(TEXT("every listener is called"), Calls, int64(NumListeners) * (Iterations + FMath::Max(1, Iterations / 10)));
+	}
+	return true;
+}
+
+GMP_IMPLEMENT_BENCH(FGMPBenchJson, "Json")
+bool FGMPBenchJson::RunTest(const FString& Parameters)
+{
+	using namespace GMP;
+	for (int32 NumItems : {1, 16, 256, 4096})
+	{
+		const FGMPTestPayload Payload = Tests::MakePayload(NumItems);
+		const int32 Iterations = Tests::BenchIterations(FMath::Max(20, 200000 / (NumItems + 4)));
+
+		TArray<uint8> Buf;
+		const double NsEncode = Tests::MeasureNsPerOp(Iterations, [&] {
+			Buf.Reset();
+			Json::UStructToJson(Buf, Payload);
+		});
+
+		FGMPTestPayload Decoded;
+		bool bSucc = true;
+		const double NsDecode = Tests::MeasureNsPerOp(Iterations, [&] { bSucc &= Json::UStructFromJson(Buf, Decoded); });
+		TestTrue(TEXT("decode succeeds"), bSucc);
+
+		const FString Case = FString::Printf(TEXT("json items=%d bytes=%d"), NumItems, Buf.Num());
+		Tests::ReportBench(*this, Case + TEXT(" encode"), NsEncode);
+		Tests::ReportBench(*this, Case + TEXT(" decode"), NsDecode);
+	}
+	return true;
+}
+
+GMP_IMPLEMENT_BENCH(FGMPBenchHttp, "Http")
+bool FGMPBenchHttp::RunTest(const FString& Parameters)
+{
+	using namespace GMP;
+	using namespace GMP::Json::Http;
+	for (int32 NumItems : {16, 256, 4096})
+	{
+		const FGMPTestPayload Payload = Tests::MakePayload(NumItems);
+		TArray<uint8> Body;
+		Json::UStructToJson(Body, Payload);
+		// answered inline, what is left is encode, pooling, decode and the hop to the game thread
+		auto Transport = MakeShared<FLoopbackTransport, ESPMode::ThreadSafe>([Body](const FRequest& Req, FResponse& Rsp) { Rsp.Content = Body; }, false);
+
+		for (bool bDecodeOnWorker : {true, false})
+		{
+			FClientSettings Settings;
+			Settings.bDecodeOnWorker = bDecodeOnWorker;
+			auto Client = FJsonHttpClient::Create(Transport, Settings);
+
+			int32 NumSent = 0;
+			int32 NumDone = 0;
+			bool bSucc = true;
+			const int32 Iterations = Tests::BenchIterations(FMath::Max(20, 20000 / (NumItems + 4)));
+			const double NsRoundTrip = Tests::MeasureNsPerOp(Iterations, [&] {
+				++NumSent;
+				Client->Post<FGMPTestPayload, FGMPTestPayload>(TEXT("http://loopback/echo"), Payload, [&](bool bRspSucc, int32 Code, const FGMPTestPayload& Rsp) {
+					++NumDone;
+					bSucc &= bRspSucc;
+				});
+				Tests::PumpGameThreadUntil([&] { return NumDone == NumSent; });
+			});
+			TestEqual(TEXT("every response is delivered"), NumDone, NumSent);
+			TestTrue(TEXT("decode succeeds"), bSucc);
+
+			const FString Case = FString::Printf(TEXT("http loopback items=%d bytes=%d %s"), NumItems, Body.Num(), bDecodeOnWorker ? TEXT("worker decode") : TEXT("game thread decode"));
+			Tests::ReportBench(*this, Case + TEXT(" round trip"), NsRoundTrip);
+		}
+	}
+	return true;
+}
+
+GMP_IMPLEMENT_BENCH(FGMPBenchProto, "Proto")
+bool FGMPBenchProto::RunTest(const FString& Parameters)
+{
+#if defined(GMP_WITH_UPB)
+	using namespace GMP;
+	auto Structs = Tests::GetProtoStructs();
+	if (Structs.Num() == 0)
+	{
+		AddInfo(TEXT("no proto defined structs are loaded, nothing to measure"));
+		return true;
+	}
+
+	for (UScriptStruct* Struct : Structs)
+	{
+		FStructOnScope Value(Struct);
+		const int32 Iterations = Tests::BenchIterations(FMath::Max(100, 2000000 / (Struct->GetStructureSize() + 16)));
+
+		TArray<uint8> Buf;
+		const double NsEncode = Tests::MeasureNsPerOp(Iterations, [&] {
+			Buf.Reset();
+			Proto::UStructToProto(Buf, Struct, Value.GetStructMemory());
+		});
+
+		FStructOnScope Decoded(Struct);
+		const double NsDecode = Tests::MeasureNsPerOp(Iterations, [&] { Proto::UStructFromProto(TConstArrayView<uint8>(Buf), Struct, Decoded.GetStructMemory()); });
+
+		const FString Case = FString::Printf(TEXT("proto %s size=%d bytes=%d"), *Struct->GetName(), Struct->GetStructureSize(), Buf.Num());
+		Tests::ReportBench(*this, Case + TEXT(" encode"), NsEncode);
+		Tests::ReportBench(*this, Case + TEXT(" decode"), NsDecode);
+	}
+#else
+	AddInfo(TEXT("built without upb"));
+#endif
+	return true;
+}
+
+GMP_IMPLEMENT_BENCH(FGMPBenchRpcPacking, "RpcPacking")
+bool FGMPBenchRpcPacking::RunTest(const FString& Parameters)
+{
+	using namespace GMP;
+	// the argument layout PostRPC packs, without a package map as no object is referenced
+	using MyTraits = Class2Prop::TPropertiesTraits<int32, FString, TArray<int32>>;
+	const auto& Props = MyTraits::GetProperties();
+
+	for (int32 NumValues : {0, 16, 256, int32(Serializer::MaxNetArrayNum)})
+	{
+		int32 Id = NumValues;
+		FString Name = TEXT("GMP.Bench.RpcPacking");
+		TArray<int32> Values;
+		for (int32 i = 0; i < NumValues; ++i)
+			Values.Add(i * 7919);
+
+		const int32 Iterations = Tests::BenchIterations(FMath::Max(100, 1000000 / (NumValues + 8)));
+
+		int64 NumBits = 0;
+		TArray<uint8> Bytes;
+		const double NsPack = Tests::MeasureNsPerOp(Iterations, [&] {
+			FGMPNetBitWriter Writer(static_cast<UPackageMap*>(nullptr), 0);
+			Serializer::NetSerializeWithProps(nullptr, Writer, Props, Id, Name, Values);
+			NumBits = Writer.GetNumBits();
+			if (Bytes.Num() == 0)
+				Bytes = *Writer.GetBuffer();
+		});
+
+		int32 OutId = 0;
+		FString OutName;
+		TArray<int32> OutValues;
+		const double NsUnpack = Tests::MeasureNsPerOp(Iterations, [&] {
+			FGMPNetBitReader Reader(static_cast<UPackageMap*>(nullptr), Bytes.GetData(), NumBits);
+			Serializer::NetSerializeWithProps(nullptr, Reader, Props, OutId, OutName, OutValues);
+		});
+		TestTrue(TEXT("unpacked values match"), OutId == Id && OutName == Name && OutValues == Values);
+
+		const FString Case = FString::Printf(TEXT("rpc values=%d bytes=%d"), NumValues, int32((NumBits + 7) / 8));
+		Tests::ReportBench(*this, Case + TEXT(" pack"), NsPack);
+		Tests::ReportBench(*this, Case + TEXT(" unpack"), NsUnpack);
+	}
+	return true;
+}
+
+#endif  // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,78 @@
+//  Copyright GenericMessagePlugin, Inc. All Rights Reserved.
+
+#include "GMPTestUtils.h"
+#include "GMPShmBridge.h"
+#include "GMPUtils.h"
+#include "Misc/Guid.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+GMP_IMPLEMENT_TEST(FGMPShmBridgeRoundTripTest, "Bridge.ShmRoundTrip")
+bool FGMPShmBridgeRoundTripTest::RunTest(const FString& Parameters)
+{
+	using namespace GMP;
+	using namespace GMP::Bridge;
+	auto Hub = FMessageUtils::GetMessageHub();
+	if (!TestTrue(TEXT("message hub is available"), Hub && Hub->IsValidHub()))
+		return false;
+
+	const FMSGKEY PingKey(TEXT("GMP.Tests.Bridge.Ping"));
+	const FMSGKEY PongKey(TEXT("GMP.Tests.Bridge.Pong"));
+	const FString Channel = FString::Printf(TEXT("GMPTests_%s"), *FGuid::NewGuid().ToString(EGuidFormats::Digits));
+
+	FShmBridgeSettings Settings;
+	Settings.bAutoPump = false;
+	auto Pub = FShmMessageBridge::Create(Channel, EShmRole::Publisher, Settings);
+	if (!Pub->IsAttached())
+	{
+		AddWarning(TEXT("named shared memory is not available on this platform"));
+		return true;
+	}
+	auto Sub = FShmMessageBridge::Create(Channel, EShmRole::Subscriber, Settings);
+	TestTrue(TEXT("subscriber attached"), Sub->IsAttached());
+
+	TestTrue(TEXT("publisher registers ping"), Pub->RegisterKey<int32, FString>(PingKey));
+	TestTrue(TEXT("publisher registers pong"), Pub->RegisterKey<int32>(PongKey));
+	TestTrue(TEXT("subscriber registers ping"), Sub->RegisterKey<int32, FString>(PingKey));
+	TestTrue(TEXT("subscriber registers pong"), Sub->RegisterKey<int32>(PongKey));
+
+	// both bridges share the hub here, the ping listener answers with another registered key and pumps again
+	FSigHandle Listener;
+	int32 Pings = 0;
+	int32 Pongs = 0;
+	int32 LastValue = 0;
+	FString LastName;
+	auto PingListen = Hub->ListenMessage(PingKey, &Listener, [&](int32 Value, const FString& Name) {
+		++Pings;
+		LastValue = Value;
+		LastName = Name;
+		int32 Reply = Value + 1;
+		Hub->SendObjectMessage(FMSGKEYFind(PongKey), FSigSource::NullSigSrc, Reply);
+		TestEqual(TEXT("nested pump delivers nothing"), Sub->Pump(), 0);
+	});
+	auto PongListen = Hub->ListenMessage(PongKey, &Listener, [&](int32 Value) { Pongs += Value; });
+
+	int32 Value = 41;
+	FString Name = TEXT("ping");
+	TestTrue(TEXT("typed publish is written"), Pub->Publish(PingKey, Value, Name) == EShmPublishResult::Written);
+	TestEqual(TEXT("nothing is sent locally by a typed publish"), Pings, 0);
+
+	// the injected ping is not published again, the pong its listener sends is
+	TestEqual(TEXT("subscriber drains the ping"), Sub->Pump(), 1);
+	TestEqual(TEXT("ping injected once"), Pings, 1);
+	TestEqual(TEXT("int argument delivered"), LastValue, 41);
+	TestEqual(TEXT("string argument delivered"), LastName, Name);
+	TestEqual(TEXT("local pong delivered"), Pongs, 42);
+	TestEqual(TEXT("injected ping is not echoed, the pong is published"), Pub->GetStats().Written, 2);
+
+	TestEqual(TEXT("pong crossed the ring"), Sub->Pump(), 1);
+	TestEqual(TEXT("remote pong delivered"), Pongs, 84);
+	TestEqual(TEXT("injected pong is not echoed"), Pub->GetStats().Written, 2);
+	TestEqual(TEXT("subscriber received both records"), Sub->GetStats().Received, 2);
+
+	Hub->UnbindMessage(FMSGKEYFind(PingKey), PingListen);
+	Hub->UnbindMessage(FMSGKEYFind(PongKey), PongListen);
+	return true;
+}
+
+#endif  // WITH_DEV_AUTOMATION_TESTS
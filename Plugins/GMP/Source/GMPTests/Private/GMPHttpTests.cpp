@@ -0,0 +1,165 @@
+//  Copyright GenericMessagePlugin, Inc. All Rights Reserved.
+
+#include "GMPJsonHttpClient.h"
+#include "GMPTestUtils.h"
+#include "Interfaces/IHttpResponse.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace GMP
+{
+namespace Tests
+{
+	// keeps every request until the test completes it, so the pool state can be checked in between
+	class FHeldTransport final : public Json::Http::ITransport
+	{
+	public:
+		virtual bool Send(Json::Http::FRequest&& Req, Json::Http::FOnTransportDone&& OnDone) override
+		{
+			Urls.Add(Req.Url);
+			Held.Add(MoveTemp(OnDone));
+			return true;
+		}
+
+		void Complete(int32 Index, const TArray<uint8>& Body)
+		{
+			Json::Http::FResponse Rsp;
+			Rsp.bConnected = true;
+			Rsp.Code = EHttpResponseCodes::Ok;
+			Rsp.Content = Body;
+			// completing may dispatch the next request into Held
+			auto OnDone = MoveTemp(Held[Index]);
+			OnDone(MoveTemp(Rsp));
+		}
+
+		TArray<FString> Urls;
+		TArray<Json::Http::FOnTransportDone> Held;
+	};
+
+	static TSharedRef<Json::Http::FLoopbackTransport, ESPMode::ThreadSafe> MakeEchoTransport(const FGMPTestPayload& Payload, bool bAsync)
+	{
+		TArray<uint8> Body;
+		Json::UStructToJson(Body, Payload);
+		return MakeShared<Json::Http::FLoopbackTransport, ESPMode::ThreadSafe>([Body](const Json::Http::FRequest& Req, Json::Http::FResponse& Rsp) { Rsp.Content = Body; }, bAsync);
+	}
+}  // namespace Tests
+}  // namespace GMP
+
+GMP_IMPLEMENT_TEST(FGMPHttpPoolingTest, "Http.Pooling")
+bool FGMPHttpPoolingTest::RunTest(const FString& Parameters)
+{
+	using namespace GMP;
+	using namespace GMP::Json::Http;
+	auto Transport = MakeShared<Tests::FHeldTransport, ESPMode::ThreadSafe>();
+	FClientSettings Settings;
+	Settings.MaxConcurrentPerHost = 2;
+	auto Client = FJsonHttpClient::Create(Transport, Settings);
+
+	const FGMPTestPayload Payload = Tests::MakePayload(4);
+	TArray<uint8> Body;
+	Json::UStructToJson(Body, Payload);
+
+	int32 NumDone = 0;
+	int32 NumSucc = 0;
+	auto OnRsp = [&](bool bSucc, int32 Code, const FGMPTestPayload& Rsp) {
+		++NumDone;
+		NumSucc += bSucc && Code == EHttpResponseCodes::Ok && FGMPTestPayload::StaticStruct()->CompareScriptStruct(&Rsp, &Payload, PPF_None);
+	};
+	for (int32 i = 0; i < 5; ++i)
+		Client->Get<FGMPTestPayload>(FString::Printf(TEXT("http://Pool.Host/a/%d"), i), OnRsp);
+	Client->Get<FGMPTestPayload>(TEXT("http://other.host/b"), OnRsp);
+
+	TestEqual(TEXT("only the pool limit reaches the transport"), Transport->Held.Num(), 3);
+	TestEqual(TEXT("hosts are pooled case insensitively"), Client->GetNumInFlight(TEXT("pool.host")), 2);
+	TestEqual(TEXT("requests over the limit wait"), Client->GetNumQueued(TEXT("pool.host")), 3);
+	TestEqual(TEXT("other hosts have their own pool"), Client->GetNumInFlight(TEXT("other.host")), 1);
+
+	// a completed request hands its slot to the next queued one
+	Transport->Complete(0, Body);
+	TestEqual(TEXT("next queued request is sent"), Transport->Held.Num(), 4);
+	TestEqual(TEXT("in flight stays at the limit"), Client->GetNumInFlight(TEXT("pool.host")), 2);
+	TestEqual(TEXT("queue shrinks"), Client->GetNumQueued(TEXT("pool.host")), 2);
+
+	for (int32 i = 1; i < Transport->Held.Num(); ++i)
+		Transport->Complete(i, Body);
+	TestEqual(TEXT("every request is sent"), Transport->Held.Num(), 6);
+	TestEqual(TEXT("pool drains"), Client->GetNumInFlight(TEXT("pool.host")), 0);
+	TestEqual(TEXT("queue drains"), Client->GetNumQueued(TEXT("pool.host")), 0);
+
+	const TArray<FString> Expected{TEXT("http://Pool.Host/a/0"), TEXT("http://Pool.Host/a/1"), TEXT("http://other.host/b"), TEXT("http://Pool.Host/a/2"), TEXT("http://Pool.Host/a/3"), TEXT("http://Pool.Host/a/4")};
+	TestEqual(TEXT("queued requests are sent in order"), Transport->Urls, Expected);
+
+	TestTrue(TEXT("every response is delivered"), Tests::PumpGameThreadUntil([&] { return NumDone == 6; }));
+	TestEqual(TEXT("every response decodes"), NumSucc, 6);
+	return true;
+}
+
+GMP_IMPLEMENT_TEST(FGMPHttpLoopbackTest, "Http.Loopback")
+bool FGMPHttpLoopbackTest::RunTest(const FString& Parameters)
+{
+	using namespace GMP;
+	using namespace GMP::Json::Http;
+	const FGMPTestPayload Payload = Tests::MakePayload(64);
+
+	for (bool bDecodeOnWorker : {true, false})
+	{
+		auto Transport = Tests::MakeEchoTransport(Payload, true);
+		FClientSettings Settings;
+		Settings.MaxConcurrentPerHost = 3;
+		Settings.bDecodeOnWorker = bDecodeOnWorker;
+		auto Client = FJsonHttpClient::Create(Transport, Settings);
+
+		const int32 NumRequests = 16;
+		int32 NumDone = 0;
+		int32 NumSucc = 0;
+		int32 NumOnGameThread = 0;
+		for (int32 i = 0; i < NumRequests; ++i)
+		{
+			Client->Post<FGMPTestPayload, FGMPTestPayload>(TEXT("http://loopback/echo"), Payload, [&](bool bSucc, int32 Code, const FGMPTestPayload& Rsp) {
+				++NumDone;
+				NumOnGameThread += IsInGameThread();
+				NumSucc += bSucc && FGMPTestPayload::StaticStruct()->CompareScriptStruct(&Rsp, &Payload, PPF_None);
+			});
+		}
+
+		const FString Mode = bDecodeOnWorker ? TEXT("worker decode") : TEXT("game thread decode");
+		TestTrue(Mode + TEXT(" delivers every response"), Tests::PumpGameThreadUntil([&] { return NumDone == NumRequests; }));
+		TestEqual(Mode + TEXT(" sends every request"), Transport->GetNumSent(), NumRequests);
+		TestEqual(Mode + TEXT(" delivers on the game thread"), NumOnGameThread, NumRequests);
+		TestEqual(Mode + TEXT(" decodes every response"), NumSucc, NumRequests);
+		TestEqual(Mode + TEXT(" decodes off the game thread"), Client->GetNumDecodedOnWorker(), bDecodeOnWorker ? NumRequests : 0);
+		TestEqual(Mode + TEXT(" drains the pool"), Client->GetNumInFlight(TEXT("loopback")), 0);
+	}
+	return true;
+}
+
+GMP_IMPLEMENT_TEST(FGMPHttpFailureTest, "Http.Failure")
+bool FGMPHttpFailureTest::RunTest(const FString& Parameters)
+{
+	using namespace GMP;
+	using namespace GMP::Json::Http;
+	auto Transport = MakeShared<FLoopbackTransport, ESPMode::ThreadSafe>([](const FRequest& Req, FResponse& Rsp) {
+		if (Req.Url.EndsWith(TEXT("missing")))
+			Rsp.Code = EHttpResponseCodes::NotFound;
+		else
+			Rsp.Content = TArray<uint8>((const uint8*)"{\"Id\":", 6);
+	});
+	auto Client = FJsonHttpClient::Create(Transport);
+
+	TArray<int32> Codes;
+	int32 NumFailed = 0;
+	auto OnRsp = [&](bool bSucc, int32 Code, const FGMPTestPayload& Rsp) {
+		Codes.Add(Code);
+		NumFailed += !bSucc && IsInGameThread();
+	};
+	Client->Get<FGMPTestPayload>(TEXT("http://loopback/missing"), OnRsp);
+	Client->Get<FGMPTestPayload>(TEXT("http://loopback/truncated"), OnRsp);
+
+	TestTrue(TEXT("failures are delivered"), Tests::PumpGameThreadUntil([&] { return Codes.Num() == 2; }));
+	TestEqual(TEXT("failures are reported on the game thread"), NumFailed, 2);
+	TestTrue(TEXT("error code is passed through"), Codes.Contains(EHttpResponseCodes::NotFound));
+	TestTrue(TEXT("malformed body keeps the ok code"), Codes.Contains(EHttpResponseCodes::Ok));
+	return true;
+}
+
+#endif  // WITH_DEV_AUTOMATION_TESTS
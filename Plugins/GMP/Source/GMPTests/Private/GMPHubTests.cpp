@@ -0,0 +1,339 @@
+//  Copyright GenericMessagePlugin, Inc. All Rights Reserved.
+
+#include "GMPTestUtils.h"
+#include "Engine/World.h"
+#include "GMPUtils.h"
+#include "GMPWorldLocals.h"
+#include "Misc/ScopeExit.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace GMP
+{
+namespace Tests
+{
+	static FMessageHub* GetTestHub(FAutomationTestBase& Test)
+	{
+		auto Hub = FMessageUtils::GetMessageHub();
+		Test.TestTrue(TEXT("message hub is available"), Hub && Hub->IsValidHub());
+		return Hub && Hub->IsValidHub() ? Hub : nullptr;
+	}
+}  // namespace Tests
+}  // namespace GMP
+
+GMP_IMPLEMENT_TEST(FGMPHubListenNotifyTest, "Hub.ListenNotify")
+bool FGMPHubListenNotifyTest::RunTest(const FString& Parameters)
+{
+	using namespace GMP;
+	auto Hub = Tests::GetTestHub(*this);
+	if (!Hub)
+		return false;
+
+	const FMSGKEY Key(TEXT("GMP.Tests.Hub.ListenNotify"));
+	FSigHandle Listener;
+	int32 Calls = 0;
+	int32 Sum = 0;
+	FString LastName;
+	auto ListenKey = Hub->ListenMessage(Key, &Listener, [&](int32 Value, const FString& Name) {
+		++Calls;
+		Sum += Value;
+		LastName = Name;
+	});
+	TestTrue(TEXT("listen returns a key"), !!ListenKey);
+	TestTrue(TEXT("listener is alive"), Hub->IsAlive(Key, ListenKey));
+
+	int32 Value = 7;
+	FString Name = TEXT("seven");
+	Hub->SendObjectMessage(FMSGKEYFind(Key), FSigSource::NullSigSrc, Value, Name);
+	Value = 5;
+	Hub->SendObjectMessage(FMSGKEYFind(Key), FSigSource::NullSigSrc, Value, Name);
+
+	TestEqual(TEXT("listener called per notify"), Calls, 2);
+	TestEqual(TEXT("arguments delivered"), Sum, 12);
+	TestEqual(TEXT("string argument delivered"), LastName, Name);
+
+	Hub->UnbindMessage(FMSGKEYFind(Key), ListenKey);
+	return true;
+}
+
+GMP_IMPLEMENT_TEST(FGMPHubUnlistenTest, "Hub.Unlisten")
+bool FGMPHubUnlistenTest::RunTest(const FString& Parameters)
+{
+	using namespace GMP;
+	auto Hub = Tests::GetTestHub(*this);
+	if (!Hub)
+		return false;
+
+	const FMSGKEY Key(TEXT("GMP.Tests.Hub.Unlisten"));
+	int32 Calls = 0;
+	int32 Value = 1;
+
+	// by key
+	{
+		FSigHandle Listener;
+		auto ListenKey = Hub->ListenMessage(Key, &Listener, [&](int32) { ++Calls; });
+		Hub->UnbindMessage(FMSGKEYFind(Key), ListenKey);
+		TestFalse(TEXT("unbound key is not alive"), Hub->IsAlive(Key, ListenKey));
+		Hub->SendObjectMessage(FMSGKEYFind(Key), FSigSource::NullSigSrc, Value);
+		TestEqual(TEXT("unbound listener is not called"), Calls, 0);
+	}
+
+	// by the lifetime of the collection
+	FGMPKey ScopedKey;
+	{
+		FSigHandle Listener;
+		ScopedKey = Hub->ListenMessage(Key, &Listener, [&](int32) { ++Calls; });
+		Hub->SendObjectMessage(FMSGKEYFind(Key), FSigSource::NullSigSrc, Value);
+		TestEqual(TEXT("scoped listener is called"), Calls, 1);
+	}
+	TestFalse(TEXT("destroyed collection unbinds"), Hub->IsAlive(Key, ScopedKey));
+	Hub->SendObjectMessage(FMSGKEYFind(Key), FSigSource::NullSigSrc, Value);
+	TestEqual(TEXT("destroyed listener is not called"), Calls, 1);
+
+	// by times
+	{
+		FSigHandle Listener;
+		Hub->ListenMessage(Key, &Listener, [&](int32) { ++Calls; }, FGMPListenOptions(1));
+		Hub->SendObjectMessage(FMSGKEYFind(Key), FSigSource::NullSigSrc, Value);
+		Hub->SendObjectMessage(FMSGKEYFind(Key), FSigSource::NullSigSrc, Value);
+		TestEqual(TEXT("single time listener is called once"), Calls, 2);
+	}
+
+	// from inside its own callback
+	{
+		FSigHandle Listener;
+		FGMPKey SelfKey;
+		SelfKey = Hub->ListenMessage(Key, &Listener, [&](int32) {
+			++Calls;
+			Hub->UnbindMessage(FMSGKEYFind(Key), SelfKey);
+		});
+		Hub->SendObjectMessage(FMSGKEYFind(Key), FSigSource::NullSigSrc, Value);
+		Hub->SendObjectMessage(FMSGKEYFind(Key), FSigSource::NullSigSrc, Value);
+		TestEqual(TEXT("listener unbinding itself is called once"), Calls, 3);
+	}
+	return true;
+}
+
+GMP_IMPLEMENT_TEST(FGMPHubRequestResponseTest, "Hub.RequestResponse")
+bool FGMPHubRequestResponseTest::RunTest(const FString& Parameters)
+{
+	using namespace GMP;
+	auto Hub = Tests::GetTestHub(*this);
+	if (!Hub)
+		return false;
+
+	// immediate response
+	{
+		const FMSGKEY Key(TEXT("GMP.Tests.Hub.Request"));
+		FSigHandle Listener;
+		Hub->ListenMessage(Key, &Listener, [](int32 Value, FGMPResponder& Responder) { Responder.Response(Value * 2); });
+
+		int32 Result = 0;
+		int32 Value = 21;
+		Hub->RequestMessage(FMSGKEYFind(Key), FSigSource::NullSigSrc, [&](int32 Rsp) { Result = Rsp; }, Value);
+		TestEqual(TEXT("response delivered synchronously"), Result, 42);
+	}
+
+	// deferred response through a held responder
+	{
+		const FMSGKEY Key(TEXT("GMP.Tests.Hub.RequestDeferred"));
+		FSigHandle Listener;
+		FGMPResponder Held;
+		Hub->ListenMessage(Key, &Listener, [&](int32 Value, FGMPResponder& Responder) { Held = Responder; });
+
+		int32 Calls = 0;
+		int32 Result = 0;
+		int32 Value = 3;
+		auto RspKey = Hub->RequestMessage(FMSGKEYFind(Key), FSigSource::NullSigSrc, [&](int32 Rsp) {
+			++Calls;
+			Result = Rsp;
+		}, Value);
+		TestTrue(TEXT("responder is held"), !!Held);
+		TestTrue(TEXT("response is pending"), Hub->IsResponseOn(RspKey));
+		TestEqual(TEXT("no response before Response"), Calls, 0);
+
+		int32 Deferred = 9;
+		Held.ResponseAndCear(Deferred);
+		TestEqual(TEXT("deferred response delivered"), Result, 9);
+		TestFalse(TEXT("response is consumed"), Hub->IsResponseOn(RspKey));
+		TestFalse(TEXT("responder is cleared"), !!Held);
+		TestEqual(TEXT("response callback is single shot"), Calls, 1);
+	}
+	return true;
+}
+
+GMP_IMPLEMENT_TEST(FGMPHubPerWorldTest, "Hub.PerWorld")
+bool FGMPHubPerWorldTest::RunTest(const FString& Parameters)
+{
+	using namespace GMP;
+	if (!Tests::GetTestHub(*this))
+		return false;
+
+	TGuardValue<bool> PerWorld(FMessageUtils::bPerWorldHub, true);
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("GMPTestsPerWorld"));
+	ON_SCOPE_EXIT
+	{
+		RemoveWorldLocal<FMessageHub>(World);
+		World->DestroyWorld(false);
+	};
+	TestTrue(TEXT("game world owns a hub"), FMessageUtils::GetWorldHub(World) != FMessageUtils::GetMessageHub());
+
+	const FMSGKEY Key(TEXT("GMP.Tests.Hub.PerWorld"));
+	FSigHandle AnyListener;
+	FSigHandle WorldListener;
+	int32 AnyCalls = 0;
+	int32 WorldCalls = 0;
+	auto AnyKey = FMessageUtils::ListenMessage(Key, &AnyListener, [&](int32) { ++AnyCalls; });
+	auto WorldKey = FMessageUtils::ListenWorldMessage(World, Key, &WorldListener, [&](int32) { ++WorldCalls; });
+	TestTrue(TEXT("listener without a source stays global"), FMessageUtils::GetMessageHub()->IsAlive(Key, AnyKey));
+	TestTrue(TEXT("world listener goes to the world hub"), FMessageUtils::GetWorldHub(World)->IsAlive(Key, WorldKey));
+
+	// notify by key reaches the listener by key, not the world bound one
+	int32 Value = 1;
+	FMessageUtils::GetMessageHub()->SendObjectMessage(FMSGKEYFind(Key), FSigSource::NullSigSrc, Value);
+	TestEqual(TEXT("global send reaches global listener"), AnyCalls, 1);
+	TestEqual(TEXT("global send skips world listener"), WorldCalls, 0);
+
+	// world bound sends still reach listeners without a source
+	FMessageUtils::SendWorldMessage(World, FMSGKEYFind(Key), Value);
+	TestEqual(TEXT("world send reaches world listener"), WorldCalls, 1);
+	TestEqual(TEXT("world send reaches global listener"), AnyCalls, 2);
+
+	// also when the world hub has no listener of its own for the key
+	FMessageUtils::UnbindMessage(FMSGKEYFind(Key), WorldKey);
+	FMessageUtils::SendWorldMessage(World, FMSGKEYFind(Key), Value);
+	TestEqual(TEXT("world send without world listeners reaches global listener"), AnyCalls, 3);
+
+	FMessageUtils::UnbindMessage(FMSGKEYFind(Key), AnyKey);
+
+	// world slots run before global ones whatever their order, a consumed message still reaches global observers
+	{
+		TArray<int32> Order;
+		FSigHandle Listeners;
+		FMessageUtils::ListenMessage(Key, &Listeners, [&](int32) { Order.Add(1); }, FGMPListenOptions(FGMPListenOrder::MinOrder).ObserveConsumed());
+		FMessageUtils::ListenMessage(Key, &Listeners, [&](int32) { Order.Add(2); }, FGMPListenOptions(FGMPListenOrder::MinOrder));
+		FMessageUtils::ListenWorldMessage(World, Key, &Listeners, [&](int32) {
+			Order.Add(3);
+			FMessageUtils::GetWorldHub(World)->GetCurrentMessageBody()->Consume();
+		}, FGMPListenOptions(FGMPListenOrder::MaxOrder));
+		FMessageUtils::SendWorldMessage(World, FMSGKEYFind(Key), Value);
+		TestTrue(TEXT("world slot runs first, consumed message reaches only the global observer"), Order == TArray<int32>{3, 1});
+	}
+	return true;
+}
+
+GMP_IMPLEMENT_TEST(FGMPHubBatchRemovalTest, "Hub.BatchRemoval")
+bool FGMPHubBatchRemovalTest::RunTest(const FString& Parameters)
+{
+	using namespace GMP;
+	auto Hub = Tests::GetTestHub(*this);
+	if (!Hub)
+		return false;
+
+	const FMSGKEY Key(TEXT("GMP.Tests.Hub.BatchRemoval"));
+	FSigHandle Listener;
+	TOptional<ISigSource> Source;
+	Source.Emplace();
+	int32 Value = 1;
+	int32 MutedCalls = 0;
+	int32 ReusedCalls = 0;
+
+	// a source destroyed in a burst mutes its slots before the sweep
+	auto MutedKey = Hub->ListenObjectMessage(Key, &Source.GetValue(), &Listener, [&](int32) { ++MutedCalls; });
+	{
+		FSigSource::FBatchRemovalScope Batch;
+		Source.Reset();
+	}
+	TestFalse(TEXT("muted slot is not alive"), Hub->IsAlive(Key, MutedKey));
+
+	// the address is reused before the sweep
+	Source.Emplace();
+	auto ReusedKey = Hub->ListenObjectMessage(Key, &Source.GetValue(), &Listener, [&](int32) { ++ReusedCalls; });
+	TestTrue(TEXT("slot on a reused address is alive"), Hub->IsAlive(Key, ReusedKey));
+	Hub->SendObjectMessage(FMSGKEYFind(Key), &Source.GetValue(), Value);
+	TestEqual(TEXT("muted slot never fires"), MutedCalls, 0);
+	TestEqual(TEXT("slot on a reused address fires"), ReusedCalls, 1);
+
+	TestEqual(TEXT("idle store is swept"), FSigSource::FlushRemovedSources(), 0);
+	TestTrue(TEXT("slot on a reused address survives the sweep"), Hub->IsAlive(Key, ReusedKey));
+	Hub->SendObjectMessage(FMSGKEYFind(Key), &Source.GetValue(), Value);
+	TestEqual(TEXT("swept slot never fires"), MutedCalls, 0);
+	TestEqual(TEXT("slot on a reused address still fires"), ReusedCalls, 2);
+	Hub->UnbindMessage(FMSGKEYFind(Key), ReusedKey);
+
+	// a burst while the store is firing mutes the slots still to come, the sweep waits for the fire
+	int32 LaterCalls = 0;
+	FGMPKey LaterKey;
+	auto FiringKey = Hub->ListenObjectMessage(Key, &Source.GetValue(), &Listener, [&](int32) {
+		{
+			FSigSource::FBatchRemovalScope Batch;
+			Source.Reset();
+		}
+		TestFalse(TEXT("pending slot is muted"), Hub->IsAlive(Key, LaterKey));
+		TestEqual(TEXT("firing store is kept for the next flush"), FSigSource::FlushRemovedSources(), 1);
+	});
+	LaterKey = Hub->ListenObjectMessage(Key, &Source.GetValue(), &Listener, [&](int32) { ++LaterCalls; });
+	Hub->SendObjectMessage(FMSGKEYFind(Key), &Source.GetValue(), Value);
+	TestEqual(TEXT("slot muted while firing never fires"), LaterCalls, 0);
+	TestEqual(TEXT("retried store is swept"), FSigSource::FlushRemovedSources(), 0);
+	TestFalse(TEXT("firing slot is gone"), Hub->IsAlive(Key, FiringKey));
+	TestFalse(TEXT("muted slot is gone"), Hub->IsAlive(Key, LaterKey));
+	return true;
+}
+
+GMP_IMPLEMENT_TEST(FGMPSignalReentrancyTest, "Signal.Reentrancy")
+bool FGMPSignalReentrancyTest::RunTest(const FString& Parameters)
+{
+	using namespace GMP;
+	TSignal<false, int32> Signal;
+	FSigHandle Owner;
+
+	TArray<int32> Order;
+	FGMPKey SecondKey;
+	FGMPKey LateKey;
+	auto First = Signal.Connect(&Owner, [&](int32 Value) {
+		Order.Add(1);
+		if (Value == 0)
+		{
+			// removing a pending slot and adding a new one while firing
+			Signal.Disconnect(SecondKey);
+			auto Late = Signal.Connect(&Owner, [&](int32) { Order.Add(3); });
+			LateKey = Late ? Late->GetGMPKey() : FGMPKey{};
+		}
+	});
+	auto Second = Signal.Connect(&Owner, [&](int32) { Order.Add(2); });
+	TestTrue(TEXT("slots connected"), First && Second);
+	SecondKey = Second ? Second->GetGMPKey() : FGMPKey{};
+
+	Signal.Fire(0);
+	TestTrue(TEXT("removed slot skipped, added slot deferred"), Order == TArray<int32>{1});
+
+	Order.Reset();
+	Signal.Fire(1);
+	Order.Sort();
+	TestTrue(TEXT("added slot joins the next fire"), Order == TArray<int32>{1, 3});
+	TestFalse(TEXT("removed slot is gone"), Signal.IsAlive(SecondKey));
+	TestTrue(TEXT("added slot is alive"), Signal.IsAlive(LateKey));
+
+	// nested fire of the same signal
+	int32 Depth = 0;
+	int32 MaxDepth = 0;
+	TSignal<false, int32> Nested;
+	Nested.Connect(&Owner, [&](int32 Value) {
+		++Depth;
+		MaxDepth = FMath::Max(MaxDepth, Depth);
+		if (Value > 0)
+			Nested.Fire(Value - 1);
+		--Depth;
+	});
+	Nested.Fire(3);
+	TestEqual(TEXT("nested fire reaches every level"), MaxDepth, 4);
+
+	Owner.DisconnectAll();
+	Order.Reset();
+	Signal.Fire(1);
+	TestEqual(TEXT("collection disconnects every slot"), Order.Num(), 0);
+	return true;
+}
+
+#endif  // WITH_DEV_AUTOMATION_TESTS
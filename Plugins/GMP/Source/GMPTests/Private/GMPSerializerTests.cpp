@@ -0,0 +1,284 @@
+//  Copyright GenericMessagePlugin, Inc. All Rights Reserved.
+
+#include "GMPArchive.h"
+#include "GMPClass2Prop.h"
+#include "GMPJsonSerializer.h"
+#include "GMPProtoSerializer.h"
+#include "GMPTestUtils.h"
+#include "GMPSerializer.h"
+#include "GMPValueOneOf.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/App.h"
+#include "UObject/StructOnScope.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace GMP
+{
+namespace Tests
+{
+	static bool PayloadEquals(const FGMPTestPayload& A, const FGMPTestPayload& B)
+	{
+		return FGMPTestPayload::StaticStruct()->CompareScriptStruct(&A, &B, PPF_None);
+	}
+
+	// switches chunked container serialization on for its lifetime
+	struct FParallelSerializerScope
+	{
+		FParallelSerializerScope(int32 MinElements, int32 ChunkSize)
+			: MinElementsVar(IConsoleManager::Get().FindConsoleVariable(TEXT("gmp.serializer.parallel.minelements")))
+			, ChunkSizeVar(IConsoleManager::Get().FindConsoleVariable(TEXT("gmp.serializer.parallel.chunksize")))
+		{
+			PrevMinElements = MinElementsVar->GetInt();
+			PrevChunkSize = ChunkSizeVar->GetInt();
+			ChunkSizeVar->Set(ChunkSize, ECVF_SetByCode);
+			MinElementsVar->Set(MinElements, ECVF_SetByCode);
+		}
+		~FParallelSerializerScope()
+		{
+			MinElementsVar->Set(PrevMinElements, ECVF_SetByCode);
+			ChunkSizeVar->Set(PrevChunkSize, ECVF_SetByCode);
+		}
+
+		IConsoleVariable* MinElementsVar;
+		IConsoleVariable* ChunkSizeVar;
+		int32 PrevMinElements = 0;
+		int32 PrevChunkSize = 0;
+	};
+
+#if defined(GMP_WITH_UPB)
+	// gives every top level repeated field NumElements elements, false when the struct has none
+	static bool FillRepeatedFields(const UScriptStruct* Struct, void* Data, int32 NumElements)
+	{
+		bool bFilled = false;
+		for (TFieldIterator<FArrayProperty> It(Struct); It; ++It)
+		{
+			FScriptArrayHelper Helper(*It, It->ContainerPtrToValuePtr<void>(Data));
+			const FProperty* Inner = It->Inner;
+			auto StructProp = CastField<FStructProperty>(Inner);
+			auto NumProp = CastField<FNumericProperty>(Inner);
+			auto StrProp = CastField<FStrProperty>(Inner);
+			if (!StructProp && !StrProp && !(NumProp && !NumProp->GetIntPropertyEnum()))
+				continue;
+
+			Helper.AddValues(NumElements);
+			for (int32 i = 0; i < NumElements; ++i)
+			{
+				if (StructProp)
+					FillStruct(StructProp->Struct, Helper.GetRawPtr(i), i);
+				else if (StrProp)
+					StrProp->SetPropertyValue(Helper.GetRawPtr(i), FString::Printf(TEXT("element_%d"), i));
+				else if (NumProp->IsFloatingPoint())
+					NumProp->SetFloatingPointPropertyValue(Helper.GetRawPtr(i), i + 0.5);
+				else
+					NumProp->SetIntPropertyValue(Helper.GetRawPtr(i), int64(i + 1));
+			}
+			bFilled = true;
+		}
+		return bFilled;
+	}
+#endif
+}  // namespace Tests
+}  // namespace GMP
+
+GMP_IMPLEMENT_TEST(FGMPJsonRoundTripTest, "Serializer.JsonRoundTrip")
+bool FGMPJsonRoundTripTest::RunTest(const FString& Parameters)
+{
+	using namespace GMP;
+	for (int32 NumItems : {0, 1, 64})
+	{
+		const FGMPTestPayload Payload = Tests::MakePayload(NumItems);
+
+		FString Str;
+		Json::UStructToJson(Str, Payload);
+		FGMPTestPayload FromStr;
+		TestTrue(FString::Printf(TEXT("decode string of %d items"), NumItems), Json::UStructFromJson(Str, FromStr));
+		TestTrue(FString::Printf(TEXT("string round trip of %d items"), NumItems), Tests::PayloadEquals(Payload, FromStr));
+
+		TArray<uint8> Buf;
+		Json::UStructToJson(Buf, Payload);
+		FGMPTestPayload FromBuf;
+		TestTrue(FString::Printf(TEXT("decode utf8 of %d items"), NumItems), Json::UStructFromJson(Buf, FromBuf));
+		TestTrue(FString::Printf(TEXT("utf8 round trip of %d items"), NumItems), Tests::PayloadEquals(Payload, FromBuf));
+	}
+
+	FGMPTestPayload Broken;
+	FString Truncated = TEXT("{\"Id\":1,\"Items\":[{\"Id\":");
+	TestFalse(TEXT("truncated input is rejected"), Json::UStructFromJson(Truncated, Broken));
+	return true;
+}
+
+GMP_IMPLEMENT_TEST(FGMPJsonLazyOneOfTest, "Serializer.JsonLazyOneOf")
+bool FGMPJsonLazyOneOfTest::RunTest(const FString& Parameters)
+{
+	FGMPValueOneOf Value;
+	TestTrue(TEXT("valid text is accepted"), Value.FromJsonStr(TEXT("{\"Id\":7,\"Name\":\"a\\u0041\",\"List\":[1,-2.5e3,true,null],\"Sub\":{}}")));
+	int32 Id = 0;
+	TestTrue(TEXT("member decoded"), Value.AsValue(Id, TEXT("Id")) && Id == 7);
+	FString Name;
+	TestTrue(TEXT("escaped string decoded"), Value.AsValue(Name, TEXT("Name")) && Name == TEXT("aA"));
+
+	// comments and trailing commas are accepted like UStructFromJson does
+	const TCHAR* Lenient[] = {
+		TEXT("{\"Id\":7,}"),
+		TEXT("[1,2,]"),
+		TEXT("// head\n{/* id */\"Id\":7 // tail\n}"),
+	};
+	for (auto Text : Lenient)
+	{
+		FGMPValueOneOf Loose;
+		TestTrue(FString::Printf(TEXT("accepts %s"), Text), Loose.FromJsonStr(Text));
+	}
+	FGMPValueOneOf Commented;
+	TestTrue(TEXT("commented text is accepted"), Commented.FromJsonStr(TEXT("{\"List\":[1,/* two */2,],\"Id\":7,}")));
+	TArray<int32> List;
+	TestTrue(TEXT("member with comments and trailing commas decoded"), Commented.AsValue(List, TEXT("List")) && List == TArray<int32>{1, 2});
+	TestTrue(TEXT("member after a commented one decoded"), Commented.AsValue(Id, TEXT("Id")) && Id == 7);
+
+	// rejected by the structure pass, FromJsonStr reports them instead of the first lookup
+	const TCHAR* Malformed[] = {
+		TEXT("{\"Id\":/* open"),
+		TEXT("[1,,2]"),
+		TEXT("{\"Id\":tru}"),
+		TEXT("{\"Id\":01}"),
+		TEXT("{\"Id\":1.}"),
+		TEXT("{\"Id\":\"a\\x\"}"),
+		TEXT("{\"Id\" 7}"),
+		TEXT("[1 2]"),
+		TEXT("{\"Id\":[1}"),
+		TEXT("   "),
+	};
+	for (auto Text : Malformed)
+	{
+		FGMPValueOneOf Broken;
+		TestFalse(FString::Printf(TEXT("rejects %s"), Text), Broken.FromJsonStr(Text));
+	}
+	return true;
+}
+
+GMP_IMPLEMENT_TEST(FGMPNetRoundTripTest, "Serializer.NetRoundTrip")
+bool FGMPNetRoundTripTest::RunTest(const FString& Parameters)
+{
+	using namespace GMP;
+	using MyTraits = Class2Prop::TPropertiesTraits<int32, FString, TArray<int32>, FVector>;
+	const auto& Props = MyTraits::GetProperties();
+
+	int32 Id = 42;
+	FString Name = TEXT("net \"packed\" message");
+	TArray<int32> Values{1, -2, 3, INT32_MAX, INT32_MIN};
+	FVector Location(1.5, -2.25, 1024.0);
+
+	FGMPNetBitWriter Writer(static_cast<UPackageMap*>(nullptr), 0);
+	Serializer::NetSerializeWithProps(nullptr, Writer, Props, Id, Name, Values, Location);
+	TestFalse(TEXT("writer has no error"), Writer.IsError());
+
+	int32 OutId = 0;
+	FString OutName;
+	TArray<int32> OutValues;
+	FVector OutLocation = FVector::ZeroVector;
+	FGMPNetBitReader Reader(static_cast<UPackageMap*>(nullptr), Writer.GetData(), Writer.GetNumBits());
+	Serializer::NetSerializeWithProps(nullptr, Reader, Props, OutId, OutName, OutValues, OutLocation);
+	TestFalse(TEXT("reader has no error"), Reader.IsError());
+	TestTrue(TEXT("reader consumed every bit"), Reader.AtEnd());
+
+	TestEqual(TEXT("int round trip"), OutId, Id);
+	TestEqual(TEXT("string round trip"), OutName, Name);
+	TestTrue(TEXT("array round trip"), OutValues == Values);
+	TestTrue(TEXT("vector round trip"), OutLocation.Equals(Location));
+	return true;
+}
+
+GMP_IMPLEMENT_TEST(FGMPProtoRoundTripTest, "Serializer.ProtoRoundTrip")
+bool FGMPProtoRoundTripTest::RunTest(const FString& Parameters)
+{
+#if defined(GMP_WITH_UPB)
+	using namespace GMP;
+	auto Structs = Tests::GetProtoStructs();
+	if (Structs.Num() == 0)
+	{
+		AddInfo(TEXT("no proto defined structs are loaded, nothing to round trip"));
+		return true;
+	}
+
+	for (UScriptStruct* Struct : Structs)
+	{
+		// containers and nested messages are populated, a default value would encode to nothing
+		FStructOnScope Value(Struct);
+		Tests::FillStruct(Struct, Value.GetStructMemory());
+		if (Struct->PropertyLink)
+		{
+			FStructOnScope Default(Struct);
+			TestFalse(FString::Printf(TEXT("%s is filled"), *Struct->GetName()), Struct->CompareScriptStruct(Value.GetStructMemory(), Default.GetStructMemory(), PPF_None));
+		}
+
+		TArray<uint8> Buf;
+		TestTrue(FString::Printf(TEXT("encode %s"), *Struct->GetName()), Proto::UStructToProto(Buf, Struct, Value.GetStructMemory()));
+
+		FStructOnScope Decoded(Struct);
+		TestTrue(FString::Printf(TEXT("decode %s"), *Struct->GetName()), Proto::UStructFromProto(TConstArrayView<uint8>(Buf), Struct, Decoded.GetStructMemory()));
+		TestTrue(FString::Printf(TEXT("round trip %s"), *Struct->GetName()), Struct->CompareScriptStruct(Value.GetStructMemory(), Decoded.GetStructMemory(), PPF_None));
+	}
+#else
+	AddInfo(TEXT("built without upb"));
+#endif
+	return true;
+}
+
+GMP_IMPLEMENT_TEST(FGMPParallelSerializerTest, "Serializer.Parallel")
+bool FGMPParallelSerializerTest::RunTest(const FString& Parameters)
+{
+	using namespace GMP;
+	if (!FApp::ShouldUseThreadingForPerformance())
+	{
+		AddWarning(TEXT("threading is disabled, containers are never split"));
+		return true;
+	}
+
+	// the threshold is far below the payload sizes, so arrays and maps are chunked
+	const int32 NumItems = 4096;
+	const FGMPTestPayload Payload = Tests::MakePayload(NumItems);
+	TArray<uint8> JsonSequential;
+	Json::UStructToJson(JsonSequential, Payload);
+	FString StrSequential;
+	Json::UStructToJson(StrSequential, Payload);
+	{
+		Tests::FParallelSerializerScope ParallelScope(128, 64);
+		TestEqual(TEXT("parallel mode is on"), Serializer::Parallel::GetMinElements(), 128);
+
+		TArray<uint8> JsonParallel;
+		Json::UStructToJson(JsonParallel, Payload);
+		TestTrue(TEXT("json bytes match the sequential output"), JsonParallel == JsonSequential);
+		FString StrParallel;
+		Json::UStructToJson(StrParallel, Payload);
+		TestTrue(TEXT("json string matches the sequential output"), StrParallel.Equals(StrSequential, ESearchCase::CaseSensitive));
+
+		FGMPTestPayload Decoded;
+		TestTrue(TEXT("parallel json decodes"), Json::UStructFromJson(JsonParallel, Decoded));
+		TestTrue(TEXT("parallel json round trip"), Tests::PayloadEquals(Payload, Decoded));
+	}
+
+#if defined(GMP_WITH_UPB)
+	bool bAnyRepeated = false;
+	for (UScriptStruct* Struct : Tests::GetProtoStructs())
+	{
+		FStructOnScope Value(Struct);
+		if (!Tests::FillRepeatedFields(Struct, Value.GetStructMemory(), 1000))
+			continue;
+		bAnyRepeated = true;
+
+		TArray<uint8> ProtoSequential;
+		TestTrue(FString::Printf(TEXT("sequential encode %s"), *Struct->GetName()), Proto::UStructToProto(ProtoSequential, Struct, Value.GetStructMemory()));
+		TArray<uint8> ProtoParallel;
+		{
+			Tests::FParallelSerializerScope ParallelScope(128, 64);
+			TestTrue(FString::Printf(TEXT("parallel encode %s"), *Struct->GetName()), Proto::UStructToProto(ProtoParallel, Struct, Value.GetStructMemory()));
+		}
+		TestTrue(FString::Printf(TEXT("proto bytes of %s match the sequential output"), *Struct->GetName()), ProtoParallel == ProtoSequential);
+	}
+	if (!bAnyRepeated)
+		AddInfo(TEXT("no loaded proto struct has a repeated field, proto is not compared"));
+#endif
+	return true;
+}
+
+#endif  // WITH_DEV_AUTOMATION_TESTS
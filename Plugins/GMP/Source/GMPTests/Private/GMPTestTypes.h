@@ -0,0 +1,40 @@
+//  Copyright GenericMessagePlugin, Inc. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+
+#include "GMPTestTypes.generated.h"
+
+USTRUCT()
+struct FGMPTestItem
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	int32 Id = 0;
+
+	UPROPERTY()
+	float Weight = 0.f;
+
+	UPROPERTY()
+	FString Name;
+};
+
+// payload of the serializer cases, its size is driven by the number of items
+USTRUCT()
+struct FGMPTestPayload
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	int32 Id = 0;
+
+	UPROPERTY()
+	FString Name;
+
+	UPROPERTY()
+	TArray<FGMPTestItem> Items;
+
+	UPROPERTY()
+	TMap<FString, int32> Tags;
+};
@@ -0,0 +1,148 @@
+//  Copyright GenericMessagePlugin, Inc. All Rights Reserved.
+
+#include "GMPTestUtils.h"
+
+#include "Async/TaskGraphInterfaces.h"
+#include "GMPValueOneOf.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformProcess.h"
+#include "UObject/UObjectIterator.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+DEFINE_LOG_CATEGORY_STATIC(LogGMPTests, Log, All);
+
+namespace GMP
+{
+namespace Tests
+{
+	float BenchScale = 1.f;
+	FAutoConsoleVariableRef CVar_BenchScale(TEXT("GMP.Tests.BenchScale"), BenchScale, TEXT("iteration scale of the GMP.Bench automation tests"), ECVF_Default);
+
+	void ReportBench(FAutomationTestBase& Test, const FString& Case, double NsPerOp)
+	{
+		// one line per case so CI can scrape the log for regressions
+		const FString Line = FString::Printf(TEXT("GMPBench %s : %.1f ns/op"), *Case, NsPerOp);
+		UE_LOG(LogGMPTests, Display, TEXT("%s"), *Line);
+		Test.AddInfo(Line);
+	}
+
+	bool PumpGameThreadUntil(TFunctionRef<bool()> Done, double TimeoutSecs)
+	{
+		check(IsInGameThread());
+		const double EndTime = FPlatformTime::Seconds() + TimeoutSecs;
+		while (!Done())
+		{
+			if (FPlatformTime::Seconds() > EndTime)
+				return false;
+			FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+			FPlatformProcess::Sleep(0.f);
+		}
+		return true;
+	}
+
+	FGMPTestPayload MakePayload(int32 NumItems)
+	{
+		FGMPTestPayload Payload;
+		Payload.Id = NumItems;
+		Payload.Name = FString::Printf(TEXT("payload_%d"), NumItems);
+		Payload.Items.Reserve(NumItems);
+		for (int32 i = 0; i < NumItems; ++i)
+		{
+			auto& Item = Payload.Items.AddDefaulted_GetRef();
+			Item.Id = i;
+			// exact in binary so text round trips compare equal
+			Item.Weight = i * 0.5f;
+			Item.Name = FString::Printf(TEXT("item \"%d\""), i);
+			if (i % 8 == 0)
+				Payload.Tags.Add(Item.Name, i);
+		}
+		return Payload;
+	}
+
+	// odd seeds set bools, two container elements always get distinct keys
+	static void FillValue(const FProperty* Prop, void* Addr, int32 Seed, int32 Depth)
+	{
+		if (auto NumProp = CastField<FNumericProperty>(Prop))
+		{
+			if (UEnum* Enum = NumProp->GetIntPropertyEnum())
+				NumProp->SetIntPropertyValue(Addr, Enum->GetValueByIndex(FMath::Min(1, Enum->NumEnums() - 1)));
+			else if (NumProp->IsFloatingPoint())
+				NumProp->SetFloatingPointPropertyValue(Addr, Seed + 0.5);
+			else
+				NumProp->SetIntPropertyValue(Addr, int64(Seed + 1));
+		}
+		else if (auto EnumProp = CastField<FEnumProperty>(Prop))
+		{
+			UEnum* Enum = EnumProp->GetEnum();
+			EnumProp->GetUnderlyingProperty()->SetIntPropertyValue(Addr, Enum->GetValueByIndex(FMath::Min(1, Enum->NumEnums() - 1)));
+		}
+		else if (auto BoolProp = CastField<FBoolProperty>(Prop))
+		{
+			BoolProp->SetPropertyValue(Addr, (Seed & 1) != 0);
+		}
+		else if (auto StrProp = CastField<FStrProperty>(Prop))
+		{
+			StrProp->SetPropertyValue(Addr, FString::Printf(TEXT("str_%d"), Seed));
+		}
+		else if (auto NameProp = CastField<FNameProperty>(Prop))
+		{
+			NameProp->SetPropertyValue(Addr, FName(*FString::Printf(TEXT("name_%d"), Seed)));
+		}
+		else if (Depth >= 0)
+		{
+			if (auto StructProp = CastField<FStructProperty>(Prop))
+			{
+				if (StructProp->Struct != FGMPValueOneOf::StaticStruct())
+					FillStruct(StructProp->Struct, Addr, Seed, Depth - 1);
+			}
+			else if (auto ArrProp = CastField<FArrayProperty>(Prop))
+			{
+				FScriptArrayHelper Helper(ArrProp, Addr);
+				const int32 First = Helper.AddValues(2);
+				for (int32 i = 0; i < 2; ++i)
+					FillValue(ArrProp->Inner, Helper.GetRawPtr(First + i), Seed + i + 1, Depth - 1);
+			}
+			else if (auto MapProp = CastField<FMapProperty>(Prop))
+			{
+				FScriptMapHelper Helper(MapProp, Addr);
+				for (int32 i = 0; i < 2; ++i)
+				{
+					const int32 Idx = Helper.AddDefaultValue_Invalid_NeedsRehash();
+					FillValue(MapProp->KeyProp, Helper.GetKeyPtr(Idx), Seed + i + 1, Depth - 1);
+					FillValue(MapProp->ValueProp, Helper.GetValuePtr(Idx), Seed + i + 1, Depth - 1);
+				}
+				Helper.Rehash();
+			}
+		}
+	}
+
+	void FillStruct(const UScriptStruct* Struct, void* Data, int32 Seed, int32 MaxDepth)
+	{
+		int32 Idx = 0;
+		for (TFieldIterator<FProperty> It(Struct); It; ++It)
+		{
+			for (int32 Dim = 0; Dim < It->ArrayDim; ++Dim, ++Idx)
+				FillValue(*It, It->ContainerPtrToValuePtr<void>(Data, Dim), 2 * (Seed + Idx) + 1, MaxDepth);
+		}
+	}
+
+#if defined(GMP_WITH_UPB)
+	TArray<UScriptStruct*> GetProtoStructs()
+	{
+		// UProtoDefinedStruct is private to GMP, match it by class name
+		static const FName ProtoStructClassName(TEXT("ProtoDefinedStruct"));
+		TArray<UScriptStruct*> Structs;
+		for (TObjectIterator<UScriptStruct> It; It; ++It)
+		{
+			if (It->GetClass()->GetFName() == ProtoStructClassName)
+				Structs.Add(*It);
+		}
+		Structs.Sort([](const UScriptStruct& A, const UScriptStruct& B) { return A.GetStructureSize() < B.GetStructureSize(); });
+		return Structs;
+	}
+#endif
+}  // namespace Tests
+}  // namespace GMP
+
+#endif  // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,67 @@
+//  Copyright GenericMessagePlugin, Inc. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+
+#include "GMPTestTypes.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+#include "UnrealCompatibility.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#if UE_5_05_OR_LATER
+#define GMP_TEST_FLAGS(Filter) (EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::Filter)
+#else
+#define GMP_TEST_FLAGS(Filter) (EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::Filter)
+#endif
+
+// Automation RunTests GMP runs every case, Automation RunTests GMP.Bench only the benchmarks
+#define GMP_IMPLEMENT_TEST(Class, Name) IMPLEMENT_SIMPLE_AUTOMATION_TEST(Class, "GMP." Name, GMP_TEST_FLAGS(EngineFilter))
+#define GMP_IMPLEMENT_BENCH(Class, Name) IMPLEMENT_SIMPLE_AUTOMATION_TEST(Class, "GMP.Bench." Name, GMP_TEST_FLAGS(PerfFilter))
+
+namespace GMP
+{
+namespace Tests
+{
+	// scales the iteration count of every benchmark, GMP.Tests.BenchScale
+	extern float BenchScale;
+
+	FORCEINLINE int32 BenchIterations(int32 Base)
+	{
+		return FMath::Max(1, FMath::RoundToInt(Base * BenchScale));
+	}
+
+	// runs a tenth of the iterations as warmup and returns the mean over the measured ones
+	template<typename F>
+	double MeasureNsPerOp(int32 Iterations, const F& Op)
+	{
+		for (int32 i = 0; i < FMath::Max(1, Iterations / 10); ++i)
+			Op();
+
+		const uint64 Start = FPlatformTime::Cycles64();
+		for (int32 i = 0; i < Iterations; ++i)
+			Op();
+		const uint64 End = FPlatformTime::Cycles64();
+		return FPlatformTime::ToSeconds64(End - Start) * 1e9 / Iterations;
+	}
+
+	void ReportBench(FAutomationTestBase& Test, const FString& Case, double NsPerOp);
+
+	FGMPTestPayload MakePayload(int32 NumItems);
+
+	// runs queued game thread tasks until Done holds, false on timeout
+	bool PumpGameThreadUntil(TFunctionRef<bool()> Done, double TimeoutSecs = 10.0);
+
+	// sets every scalar, string, enum, container and nested struct field to a value other than its default
+	// containers get two elements, nesting stops at MaxDepth
+	void FillStruct(const UScriptStruct* Struct, void* Data, int32 Seed = 0, int32 MaxDepth = 3);
+
+#if defined(GMP_WITH_UPB)
+	// structs generated from registered protos, smallest first, only these have a message definition
+	TArray<UScriptStruct*> GetProtoStructs();
+#endif
+}  // namespace Tests
+}  // namespace GMP
+
+#endif  // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,5 @@
+//  Copyright GenericMessagePlugin, Inc. All Rights Reserved.
+
+#include "Modules/ModuleManager.h"
+
+IMPLEMENT_MODULE(FDefaultModuleImpl, GMPTests)